@@ -0,0 +1,18 @@
+#ifndef GDEXTENSION_ALLEGIANCE_H
+#define GDEXTENSION_ALLEGIANCE_H
+
+#include <cstdint>
+
+/// Allegiance filter bits for unit queries, relative to a reference unit
+/// Combine with | (e.g. ALLY | SELF for "my team including me")
+namespace Allegiance {
+constexpr uint32_t SELF = 1u << 0;     // The reference unit itself
+constexpr uint32_t ALLY = 1u << 1;     // Same team, excluding self
+constexpr uint32_t ENEMY = 1u << 2;    // Hostile team
+constexpr uint32_t NEUTRAL = 1u << 3;  // Neither (e.g. neutral creeps)
+
+constexpr uint32_t OTHERS = ALLY | ENEMY | NEUTRAL;
+constexpr uint32_t ANY = SELF | OTHERS;
+}  // namespace Allegiance
+
+#endif  // GDEXTENSION_ALLEGIANCE_H
@@ -0,0 +1,21 @@
+#ifndef GDEXTENSION_CROWD_CONTROL_H
+#define GDEXTENSION_CROWD_CONTROL_H
+
+#include <cstdint>
+
+/// Aggregated crowd-control state word stored on each Unit
+/// Written by StatusEffectSystem whenever a unit's active effects change;
+/// components only test bits, they never look at individual effects.
+namespace CrowdControl {
+constexpr uint32_t NONE = 0;
+constexpr uint32_t STUNNED = 1u << 0;    // No movement, attacks or casting
+constexpr uint32_t SLOWED = 1u << 1;     // Movement speed reduced
+constexpr uint32_t DISPLACED = 1u << 2;  // Knocked back; position is forced
+
+// What each kind of action is blocked by
+constexpr uint32_t BLOCKS_MOVEMENT = STUNNED | DISPLACED;
+constexpr uint32_t BLOCKS_ATTACKS = STUNNED | DISPLACED;
+constexpr uint32_t BLOCKS_CASTING = STUNNED | DISPLACED;
+}  // namespace CrowdControl
+
+#endif  // GDEXTENSION_CROWD_CONTROL_H
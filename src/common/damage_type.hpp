@@ -0,0 +1,18 @@
+#ifndef GDEXTENSION_DAMAGE_TYPE_H
+#define GDEXTENSION_DAMAGE_TYPE_H
+
+#include <cstdint>
+
+/// Damage type decides which resistance stat mitigates a hit
+enum class DamageType : uint8_t {
+  // Basic attacks and physical abilities - reduced by ARMOR
+  PHYSICAL = 0,
+
+  // Spells - reduced by MAGIC_RESIST
+  MAGICAL = 1,
+
+  // Never mitigated
+  PURE = 2,
+};
+
+#endif  // GDEXTENSION_DAMAGE_TYPE_H
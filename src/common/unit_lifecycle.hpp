@@ -0,0 +1,23 @@
+#ifndef GDEXTENSION_UNIT_LIFECYCLE_H
+#define GDEXTENSION_UNIT_LIFECYCLE_H
+
+#include <cstdint>
+
+/// Where a Unit is in its life (see Unit::set_lifecycle)
+/// Components suspend outside ALIVE instead of being freed, so deaths,
+/// revives and pool reuse allocate nothing.
+enum class UnitLifecycle : uint8_t {
+  // In play - collides, components tick
+  ALIVE = 0,
+
+  // Died with no revive pending - no collision, components suspended
+  DEAD = 1,
+
+  // Died, ReviveComponent counting down - like DEAD
+  REVIVING = 2,
+
+  // Parked by a spawner for reuse - like DEAD, and hidden
+  POOLED = 3,
+};
+
+#endif  // GDEXTENSION_UNIT_LIFECYCLE_H
@@ -18,6 +18,13 @@ inline const StringName& get_attack_requested() {
   return signal;
 }
 
+// Attack order on a proxy minion (ProxyMinionSystem handle, see
+// AttackComponent)
+inline const StringName& get_attack_proxy_requested() {
+  static StringName signal = StringName("attack_proxy_requested");
+  return signal;
+}
+
 inline const StringName& get_chase_requested() {
   static StringName signal = StringName("chase_requested");
   return signal;
@@ -50,14 +57,29 @@ inline const StringName& get_chase_range_reached() {
   return signal;
 }
 
+// Stat signals - emitted by Unit when a stat's final value changes
+inline const StringName& get_stat_changed() {
+  static StringName signal = StringName("stat_changed");
+  return signal;
+}
+
+// Lifecycle signals - emitted by Unit when its UnitLifecycle state changes
+inline const StringName& get_lifecycle_changed() {
+  static StringName signal = StringName("lifecycle_changed");
+  return signal;
+}
+
 // Convenience aliases for backwards compatibility
 #define move_requested get_move_requested()
 #define attack_requested get_attack_requested()
+#define attack_proxy_requested get_attack_proxy_requested()
 #define chase_requested get_chase_requested()
 #define chase_to_range_requested get_chase_to_range_requested()
 #define interact_requested get_interact_requested()
 #define stop_requested get_stop_requested()
 #define take_damage get_take_damage()
 #define chase_range_reached get_chase_range_reached()
+#define stat_changed get_stat_changed()
+#define lifecycle_changed get_lifecycle_changed()
 
 #endif  // GDEXTENSION_UNIT_SIGNALS_H
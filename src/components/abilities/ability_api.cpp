@@ -1,12 +1,17 @@
 #include "ability_api.hpp"
 
+#include <algorithm>
 #include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/classes/scene_tree.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
 #include "../../common/unit_signals.hpp"
+#include "../../core/faction_table.hpp"
 #include "../../core/unit.hpp"
 #include "../../debug/debug_macros.hpp"
+#include "../../systems/damage_queue.hpp"
+#include "../../systems/proxy_minion_system.hpp"
+#include "../../systems/status_effect_system.hpp"
 
 using godot::Node;
 using godot::Object;
@@ -15,73 +20,92 @@ using godot::String;
 using godot::UtilityFunctions;
 using godot::Vector3;
 
-float AbilityAPI::apply_damage(Unit* target, float damage, Unit* source) {
+float AbilityAPI::apply_damage(Unit* target,
+                               float damage,
+                               Unit* source,
+                               DamageType type) {
   if (target == nullptr || !target->is_inside_tree()) {
     return 0.0f;
   }
 
-  // Apply damage via relay signal (fire-and-forget)
-  target->relay(take_damage, damage, source);
-  return damage;
+  // Queued; the damage phase mitigates and relays take_damage once per target
+  DamageQueue::submit(target, damage, type, source);
+  return DamageQueue::mitigate(target, damage, type);
 }
 
-Array AbilityAPI::apply_aoe_damage(const Vector3& center,
-                                   float radius,
-                                   float damage,
-                                   Unit* source,
-                                   Unit* exclude_unit) {
-  Array hit_units = get_units_in_sphere(center, radius, exclude_unit);
-  Array result;
+UnitSpan AbilityAPI::apply_aoe_damage(const Vector3& center,
+                                      float radius,
+                                      float damage,
+                                      Unit* source,
+                                      uint32_t allegiance,
+                                      DamageType type) {
+  if (damage <= 0.0f) {
+    return UnitSpan();
+  }
 
-  for (int i = 0; i < hit_units.size(); i++) {
-    Unit* unit = Object::cast_to<Unit>(hit_units[i]);
-    if (unit == nullptr || unit == source) {
-      continue;
-    }
+  UnitSpan hit_units = UnitQuery::sphere(center, radius, source, allegiance);
 
-    float applied_damage = apply_damage(unit, damage, source);
-    if (applied_damage > 0.0f) {
-      result.append(unit);
-    }
+  for (Unit* unit : hit_units) {
+    DamageQueue::submit(unit, damage, type, source);
   }
 
-  return result;
+  // Proxy minions in the area take the same hit
+  apply_proxy_aoe_damage(center, radius, damage, source, allegiance, type);
+  return hit_units;
 }
 
-Array AbilityAPI::get_units_in_sphere(const Vector3& center,
-                                      float radius,
-                                      Unit* exclude_unit) {
-  Array result;
-
-  // Find all Unit nodes within radius using scene tree traversal
-  // This is a brute-force approach but works for smaller scenes
-  // For larger scenes, consider using physics queries or spatial partitioning
-
-  // Get a node to work with - use exclude_unit if available
-  Node* node = exclude_unit;
-  if (node == nullptr || !node->is_inside_tree()) {
-    return result;
+float AbilityAPI::apply_proxy_damage(int64_t proxy,
+                                     float damage,
+                                     DamageType type) {
+  ProxyMinionSystem* proxies = ProxyMinionSystem::get_singleton();
+  if (proxies == nullptr) {
+    return 0.0f;
   }
+  return proxies->submit_damage(proxy, damage, type);
+}
 
-  // Get the scene tree using Godot's built-in method
-  SceneTree* scene_tree = get_scene_tree(node);
-  if (scene_tree == nullptr) {
-    return result;
+int32_t AbilityAPI::apply_proxy_aoe_damage(const Vector3& center,
+                                           float radius,
+                                           float damage,
+                                           Unit* source,
+                                           uint32_t allegiance,
+                                           DamageType type) {
+  ProxyMinionSystem* proxies = ProxyMinionSystem::get_singleton();
+  if (proxies == nullptr || proxies->get_count() == 0 || damage <= 0.0f) {
+    return 0;
   }
+  return proxies->damage_radius(center, radius,
+                                _faction_mask(source, allegiance), damage,
+                                type);
+}
 
-  // Find the root by traversing up from exclude_unit
-  Node* current = exclude_unit;
-  Node* root = exclude_unit;
-  while (current != nullptr) {
-    root = current;
-    current = current->get_parent();
+int64_t AbilityAPI::find_nearest_proxy(const Vector3& center,
+                                       float max_range,
+                                       Unit* reference_unit,
+                                       uint32_t allegiance) {
+  ProxyMinionSystem* proxies = ProxyMinionSystem::get_singleton();
+  if (proxies == nullptr) {
+    return ProxyMinionSystem::INVALID_HANDLE;
   }
+  return proxies->find_nearest(center, max_range,
+                               _faction_mask(reference_unit, allegiance));
+}
 
-  // Traverse from root
-  float radius_sq = radius * radius;
-  _search_units_recursive(root, center, radius_sq, exclude_unit, result);
+uint32_t AbilityAPI::_faction_mask(const Unit* reference_unit,
+                                   uint32_t allegiance) {
+  if (reference_unit == nullptr) {
+    return FactionTable::ALL_FACTIONS;
+  }
+  return FactionTable::get_faction_mask(reference_unit->get_faction_id(),
+                                        allegiance);
+}
 
-  return result;
+Array AbilityAPI::get_units_in_sphere(const Vector3& center,
+                                      float radius,
+                                      Unit* reference_unit,
+                                      uint32_t allegiance) {
+  return UnitQuery::sphere(center, radius, reference_unit, allegiance)
+      .to_array();
 }
 
 SceneTree* AbilityAPI::get_scene_tree(Node* node) {
@@ -96,21 +120,91 @@ SceneTree* AbilityAPI::get_scene_tree(Node* node) {
 Array AbilityAPI::get_enemy_units_in_sphere(const Vector3& center,
                                             float radius,
                                             Unit* reference_unit) {
-  Array all_units = get_units_in_sphere(center, radius, reference_unit);
-  Array enemies;
+  if (reference_unit == nullptr) {
+    return Array();
+  }
+  return get_units_in_sphere(center, radius, reference_unit,
+                             Allegiance::ENEMY);
+}
 
-  for (int i = 0; i < all_units.size(); i++) {
-    Unit* unit = Object::cast_to<Unit>(all_units[i]);
-    if (unit == nullptr) {
-      continue;
-    }
+Array AbilityAPI::get_units_in_cone(const Vector3& apex,
+                                    const Vector3& direction,
+                                    float range,
+                                    float half_angle,
+                                    Unit* reference_unit,
+                                    uint32_t allegiance) {
+  return UnitQuery::cone(apex, direction, range, half_angle, reference_unit,
+                         allegiance)
+      .to_array();
+}
 
-    if (are_enemies(reference_unit, unit)) {
-      enemies.append(unit);
-    }
+Array AbilityAPI::get_units_in_capsule(const Vector3& start,
+                                       const Vector3& end,
+                                       float radius,
+                                       Unit* reference_unit,
+                                       uint32_t allegiance) {
+  return UnitQuery::capsule(start, end, radius, reference_unit, allegiance)
+      .to_array();
+}
+
+Array AbilityAPI::get_units_in_oriented_rect(const Vector3& center,
+                                             const Vector3& forward,
+                                             float half_length,
+                                             float half_width,
+                                             Unit* reference_unit,
+                                             uint32_t allegiance) {
+  return UnitQuery::oriented_rect(center, forward, half_length, half_width,
+                                  reference_unit, allegiance)
+      .to_array();
+}
+
+Array AbilityAPI::get_k_nearest_units(const Vector3& center,
+                                      int32_t k,
+                                      float max_range,
+                                      Unit* reference_unit,
+                                      uint32_t allegiance) {
+  return UnitQuery::k_nearest(center, k, max_range, reference_unit,
+                              allegiance)
+      .to_array();
+}
+
+int32_t AbilityAPI::find_nearest_units(const Vector3& center,
+                                       int32_t k,
+                                       float max_range,
+                                       Unit* reference_unit,
+                                       uint32_t allegiance,
+                                       UnitSpan exclude,
+                                       Unit** out) {
+  k = std::min(k, MAX_CHAIN_TARGETS);
+  return UnitQuery::k_nearest(center, k, max_range, reference_unit,
+                              allegiance, exclude, out);
+}
+
+int32_t AbilityAPI::select_chain_hops(Unit* first,
+                                      int32_t max_hops,
+                                      float hop_range,
+                                      Unit* reference_unit,
+                                      uint32_t allegiance,
+                                      Unit** hops) {
+  max_hops = std::min(max_hops, MAX_CHAIN_TARGETS);
+  if (first == nullptr || !first->is_inside_tree() || max_hops <= 0 ||
+      hops == nullptr) {
+    return 0;
   }
 
-  return enemies;
+  // Everything already hit is the exclusion set for the next hop
+  hops[0] = first;
+  int32_t count = 1;
+  while (count < max_hops) {
+    Vector3 from = hops[count - 1]->get_global_position();
+    UnitSpan hit{hops, count};
+    if (UnitQuery::k_nearest(from, 1, hop_range, reference_unit, allegiance,
+                             hit, hops + count) == 0) {
+      break;
+    }
+    count++;
+  }
+  return count;
 }
 
 void AbilityAPI::apply_slow(Unit* target, float slow_percent, float duration) {
@@ -118,10 +212,11 @@ void AbilityAPI::apply_slow(Unit* target, float slow_percent, float duration) {
     return;
   }
 
-  // TODO: Implement status effect system
-  // For now, this is a placeholder
-  // Would apply movement speed reduction for duration seconds
-  DBG_INFO("AbilityAPI", "Slow applied (not yet implemented)");
+  StatusEffectSystem* effects = StatusEffectSystem::ensure_singleton(target);
+  if (effects == nullptr) {
+    return;
+  }
+  effects->apply_slow(target, slow_percent, duration);
 }
 
 void AbilityAPI::apply_stun(Unit* target, float duration) {
@@ -129,10 +224,11 @@ void AbilityAPI::apply_stun(Unit* target, float duration) {
     return;
   }
 
-  // TODO: Implement status effect system
-  // For now, this is a placeholder
-  // Would disable movement and ability casting for duration seconds
-  DBG_INFO("AbilityAPI", "Stun applied (not yet implemented)");
+  StatusEffectSystem* effects = StatusEffectSystem::ensure_singleton(target);
+  if (effects == nullptr) {
+    return;
+  }
+  effects->apply_stun(target, duration);
 }
 
 void AbilityAPI::knockback_unit(Unit* target,
@@ -142,10 +238,11 @@ void AbilityAPI::knockback_unit(Unit* target,
     return;
   }
 
-  // TODO: Implement knockback physics
-  // For now, this is a placeholder
-  // Would apply velocity in direction for force amount
-  DBG_INFO("AbilityAPI", "Knockback applied (not yet implemented)");
+  StatusEffectSystem* effects = StatusEffectSystem::ensure_singleton(target);
+  if (effects == nullptr) {
+    return;
+  }
+  effects->apply_knockback(target, direction, force);
 }
 
 bool AbilityAPI::are_enemies(Unit* unit_a, Unit* unit_b) {
@@ -153,9 +250,7 @@ bool AbilityAPI::are_enemies(Unit* unit_a, Unit* unit_b) {
     return false;
   }
 
-  // TODO: Implement team/faction system
-  // For now, assume all units are enemies except themselves
-  return unit_a != unit_b;
+  return FactionTable::matches(unit_a, unit_b, Allegiance::ENEMY);
 }
 
 float AbilityAPI::distance_between(Unit* unit_a, Unit* unit_b) {
@@ -211,32 +306,3 @@ bool AbilityAPI::chase_and_prepare_execution(Unit* caster,
   // Caller should return early without executing the ability
   return false;
 }
-
-void AbilityAPI::_search_units_recursive(Node* node,
-                                         const Vector3& center,
-                                         float radius_sq,
-                                         Unit* exclude_unit,
-                                         Array& result) {
-  if (node == nullptr) {
-    return;
-  }
-
-  // Check if current node is a Unit
-  Unit* unit = Object::cast_to<Unit>(node);
-  if (unit != nullptr && unit != exclude_unit && unit->is_inside_tree()) {
-    Vector3 unit_pos = unit->get_global_position();
-    float distance_sq = center.distance_squared_to(unit_pos);
-
-    if (distance_sq <= radius_sq) {
-      result.append(unit);
-    }
-  }
-
-  // Recursively search children
-  for (int i = 0; i < node->get_child_count(); i++) {
-    Node* child = node->get_child(i);
-    if (child != nullptr) {
-      _search_units_recursive(child, center, radius_sq, exclude_unit, result);
-    }
-  }
-}
@@ -1,10 +1,15 @@
 #ifndef GDEXTENSION_ABILITY_API_H
 #define GDEXTENSION_ABILITY_API_H
 
+#include <cstdint>
 #include <godot_cpp/classes/scene_tree.hpp>
 #include <godot_cpp/variant/array.hpp>
 #include <godot_cpp/variant/vector3.hpp>
 
+#include "../../common/allegiance.hpp"
+#include "../../common/damage_type.hpp"
+#include "../../systems/unit_query.hpp"
+
 using godot::Array;
 using godot::SceneTree;
 using godot::Vector3;
@@ -19,47 +24,141 @@ class Node;
 ///
 /// Usage:
 /// - AbilityAPI::apply_damage(target, damage, caster)
-/// - AbilityAPI::get_units_in_sphere(center, radius)
+/// - UnitQuery::sphere(center, radius, caster, Allegiance::ENEMY)
 /// - etc.
 ///
 /// This centralizes common ability logic to reduce code duplication
 /// and provide consistent behavior across all abilities
 class AbilityAPI {
  public:
-  // Damage application
-  /// Apply damage to a unit with knockback
-  /// Returns actual damage applied (may be reduced by resistances)
-  static float apply_damage(Unit* target, float damage, Unit* source = nullptr);
+  /// Upper bound for multi-target and chain hop lists, so callers can keep
+  /// them in fixed-size arrays
+  static constexpr int32_t MAX_CHAIN_TARGETS = 16;
 
-  /// Apply area damage to all units in a sphere
-  /// Returns array of units hit
-  static Array apply_aoe_damage(const Vector3& center,
+  // Damage application
+  /// Queue damage on a unit (resolved in the tick's damage phase)
+  /// Returns the damage after the target's current resistances
+  static float apply_damage(Unit* target,
+                            float damage,
+                            Unit* source = nullptr,
+                            DamageType type = DamageType::MAGICAL);
+
+  /// Apply area damage to the units in radius whose allegiance toward source
+  /// matches (everyone but source by default, as before faction filtering;
+  /// without a source every unit is hit)
+  /// Proxy minions in the area are hit too (see ProxyMinionSystem)
+  /// Returns the units hit (frame arena, see UnitQuery)
+  static UnitSpan apply_aoe_damage(const Vector3& center,
                                 float radius,
                                 float damage,
                                 Unit* source = nullptr,
-                                Unit* exclude_unit = nullptr);
+                                uint32_t allegiance = Allegiance::OTHERS,
+                                DamageType type = DamageType::MAGICAL);
+
+  // Proxy minions (node-less, see ProxyMinionSystem); proxies are handles
+  /// Queue damage on a proxy minion; returns the damage after resistances
+  static float apply_proxy_damage(int64_t proxy,
+                                  float damage,
+                                  DamageType type = DamageType::MAGICAL);
+
+  /// Queue damage on the proxies within radius (XZ) whose faction's
+  /// allegiance toward source matches; returns the number of proxies hit
+  static int32_t apply_proxy_aoe_damage(
+      const Vector3& center,
+      float radius,
+      float damage,
+      Unit* source = nullptr,
+      uint32_t allegiance = Allegiance::OTHERS,
+      DamageType type = DamageType::MAGICAL);
+
+  /// Nearest proxy within max_range (XZ) whose faction's allegiance toward
+  /// reference_unit matches, or ProxyMinionSystem::INVALID_HANDLE
+  static int64_t find_nearest_proxy(const Vector3& center,
+                                    float max_range,
+                                    Unit* reference_unit = nullptr,
+                                    uint32_t allegiance = Allegiance::ENEMY);
 
   // Unit queries
-  /// Get all units within a sphere
-  /// Returns array of Unit pointers
+  // Variant wrappers over UnitQuery::sphere for script bindings; C++ callers
+  // should use UnitQuery directly and avoid the Array boxing
+  /// Get the living units within radius (XZ) whose allegiance toward
+  /// reference_unit matches the Allegiance bits; without a reference unit
+  /// every unit matches
   static Array get_units_in_sphere(const Vector3& center,
                                    float radius,
-                                   Unit* exclude_unit = nullptr);
+                                   Unit* reference_unit = nullptr,
+                                   uint32_t allegiance = Allegiance::OTHERS);
 
   /// Get all enemy units within a sphere relative to a reference unit
-  /// Returns array of Unit pointers
   static Array get_enemy_units_in_sphere(const Vector3& center,
                                          float radius,
                                          Unit* reference_unit);
 
+  /// Units within range of apex and half_angle (radians) of direction
+  static Array get_units_in_cone(const Vector3& apex,
+                                 const Vector3& direction,
+                                 float range,
+                                 float half_angle,
+                                 Unit* reference_unit = nullptr,
+                                 uint32_t allegiance = Allegiance::OTHERS);
+
+  /// Units within radius of the segment start-end (line skillshots)
+  static Array get_units_in_capsule(const Vector3& start,
+                                    const Vector3& end,
+                                    float radius,
+                                    Unit* reference_unit = nullptr,
+                                    uint32_t allegiance = Allegiance::OTHERS);
+
+  /// Units inside a rectangle centered on center and aligned with forward
+  static Array get_units_in_oriented_rect(
+      const Vector3& center,
+      const Vector3& forward,
+      float half_length,
+      float half_width,
+      Unit* reference_unit = nullptr,
+      uint32_t allegiance = Allegiance::OTHERS);
+
+  /// Up to k units within max_range, nearest first
+  static Array get_k_nearest_units(
+      const Vector3& center,
+      int32_t k,
+      float max_range,
+      Unit* reference_unit = nullptr,
+      uint32_t allegiance = Allegiance::OTHERS);
+
+  /// Up to k (clamped to MAX_CHAIN_TARGETS) units nearest to center within
+  /// max_range, skipping the units in exclude, written into out nearest first
+  /// Returns the number written; no allocation, for per-tick hop selection
+  static int32_t find_nearest_units(const Vector3& center,
+                                    int32_t k,
+                                    float max_range,
+                                    Unit* reference_unit,
+                                    uint32_t allegiance,
+                                    UnitSpan exclude,
+                                    Unit** out);
+
+  /// Chain from first: each hop is the nearest matching unit within
+  /// hop_range of the previous hop that hasn't been hit yet
+  /// hops needs room for max_hops (clamped to MAX_CHAIN_TARGETS); hops[0] is
+  /// first. Returns the number of hops written, 0 if first is invalid
+  static int32_t select_chain_hops(Unit* first,
+                                   int32_t max_hops,
+                                   float hop_range,
+                                   Unit* reference_unit,
+                                   uint32_t allegiance,
+                                   Unit** hops);
+
   // Status effects / Control
   /// Apply slow effect to unit
+  /// slow_percent is a fraction (0.3 = 30% slower); the strongest slow wins
   static void apply_slow(Unit* target, float slow_percent, float duration);
 
   /// Stun a unit (disable movement and abilities)
   static void apply_stun(Unit* target, float duration);
 
   /// Knockback a unit in a direction
+  /// force is the initial push speed (m/s), decelerating to zero over
+  /// StatusEffectSystem::KNOCKBACK_DURATION
   static void knockback_unit(Unit* target,
                              const Vector3& direction,
                              float force);
@@ -82,7 +181,7 @@ class AbilityAPI {
                                           float ability_range);
 
   // Utility
-  /// Check if two units are enemies
+  /// Check if two units are enemies (see FactionTable)
   static bool are_enemies(Unit* unit_a, Unit* unit_b);
 
   /// Calculate distance between two units
@@ -93,12 +192,9 @@ class AbilityAPI {
   static godot::SceneTree* get_scene_tree(godot::Node* node);
 
  private:
-  /// Recursive helper to search scene tree for units within radius
-  static void _search_units_recursive(godot::Node* node,
-                                      const Vector3& center,
-                                      float radius_sq,
-                                      Unit* exclude_unit,
-                                      Array& result);
+  // Factions matching allegiance toward reference_unit (all without one)
+  static uint32_t _faction_mask(const Unit* reference_unit,
+                                uint32_t allegiance);
 };
 
 #endif  // GDEXTENSION_ABILITY_API_H
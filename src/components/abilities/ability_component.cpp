@@ -1,16 +1,18 @@
 #include "ability_component.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/packed_scene.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/core/property_info.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
+#include "../../common/crowd_control.hpp"
 #include "../../common/unit_signals.hpp"
 #include "../../core/unit.hpp"
 #include "../../debug/debug_macros.hpp"
-#include "../../debug/visual_debugger.hpp"
+#include "../../systems/channel_system.hpp"
 #include "../resources/resource_pool_component.hpp"
 #include "../ui/label_registry.hpp"
 #include "ability_node.hpp"
@@ -206,6 +208,12 @@ void AbilityComponent::_physics_process(double delta) {
     }
   }
 
+  // Stuns and knockbacks break an ongoing cast
+  if (casting_slot >= 0 && _is_crowd_controlled()) {
+    interrupt_casting();
+    return;
+  }
+
   // Handle casting state machine
   if (casting_slot >= 0 &&
       casting_slot < static_cast<int>(ability_scenes.size())) {
@@ -215,6 +223,11 @@ void AbilityComponent::_physics_process(double delta) {
       return;
     }
 
+    // After its cast point a channel is ticked by ChannelSystem
+    if (channel_registered) {
+      return;
+    }
+
     // Advance casting timer
     casting_timer += delta;
 
@@ -223,31 +236,22 @@ void AbilityComponent::_physics_process(double delta) {
     int cast_type = ability->get_cast_type();
     int targeting_type = ability->get_targeting_type();
 
-    // Check range for channel abilities with unit targets
+    // Check range while winding up channel abilities with unit targets
     if (cast_type == static_cast<int>(CastType::CHANNEL) &&
         targeting_type == static_cast<int>(TargetingType::UNIT_TARGET) &&
         casting_target != nullptr) {
       Unit* caster = get_unit();
       Unit* target_unit = Object::cast_to<Unit>(casting_target);
       if (target_unit != nullptr && target_unit->is_inside_tree()) {
-        Vector3 caster_pos = caster->get_global_position();
-        Vector3 target_pos = target_unit->get_global_position();
-        float distance = caster_pos.distance_to(target_pos);
+        float distance_sq = caster->get_global_position().distance_squared_to(
+            target_unit->get_global_position());
         float range = ability->get_range();
 
-        // Debug visualization: Draw line between caster and target
-        VisualDebugger* debugger = VisualDebugger::get_singleton();
-        if (debugger != nullptr && debugger->is_debug_enabled()) {
-          // Draw white line from caster to target with thickness
-          debugger->draw_line(caster_pos, target_pos, godot::Color(1, 1, 1, 1),
-                              1.0f);
-        }
-
-        if (range > 0.0f && distance > range) {
+        if (range > 0.0f && distance_sq > range * range) {
           // Target out of range - interrupt channel
           DBG_INFO("AbilityComponent",
                    "Channel interrupted: target out of range (" +
-                       String::num(distance, 1) + "m > " +
+                       String::num(std::sqrt(distance_sq), 1) + "m > " +
                        String::num(range, 1) + "m)");
           _finish_casting();
           return;
@@ -278,10 +282,12 @@ void AbilityComponent::_physics_process(double delta) {
         _execute_ability(casting_slot);
         casting_state = static_cast<int>(CastState::ON_COOLDOWN);
 
-        // Initialize tick timer for channel abilities
+        // The first tick fired at the cast point; the rest are batched
         if (cast_type == static_cast<int>(CastType::CHANNEL)) {
-          float tick_interval = ability->get_channel_tick_interval();
-          next_tick_time = (tick_interval > 0.0f) ? tick_interval : 999999.0f;
+          _begin_channel(ability);
+          if (channel_registered) {
+            return;
+          }
         }
       }
     } else {
@@ -293,18 +299,6 @@ void AbilityComponent::_physics_process(double delta) {
       }
     }
 
-    // Handle channel ticking (periodic damage)
-    if (cast_type == static_cast<int>(CastType::CHANNEL) &&
-        casting_state == static_cast<int>(CastState::ON_COOLDOWN)) {
-      float tick_interval = ability->get_channel_tick_interval();
-      if (tick_interval > 0.0f && casting_timer >= next_tick_time) {
-        // Fire a tick of damage
-        emit_signal("ability_channel_tick", casting_slot, casting_target);
-        _execute_ability(casting_slot);
-        next_tick_time += tick_interval;
-      }
-    }
-
     // Check if casting is finished
     if (casting_timer >= cast_duration && cast_duration > 0.0f) {
       _finish_casting();
@@ -496,6 +490,28 @@ void AbilityComponent::interrupt_casting() {
   }
 }
 
+void AbilityComponent::_on_lifecycle_changed(UnitLifecycle state) {
+  if (state != UnitLifecycle::ALIVE) {
+    interrupt_casting();
+  }
+  if (state == UnitLifecycle::POOLED) {
+    std::fill(cooldown_timers.begin(), cooldown_timers.end(), 0.0f);
+  }
+}
+
+bool AbilityComponent::is_idle() const {
+  if (casting_slot >= 0) {
+    return false;
+  }
+
+  for (float timer : cooldown_timers) {
+    if (timer > 0.0f) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool AbilityComponent::is_on_cooldown(int slot) const {
   if (slot < 0 || slot >= static_cast<int>(cooldown_timers.size())) {
     return false;
@@ -551,6 +567,16 @@ bool AbilityComponent::_can_cast(int slot) {
     return false;
   }
 
+  // Check if stunned or knocked back
+  if (_is_crowd_controlled()) {
+    return false;
+  }
+
+  // Dead units don't cast
+  if (owner_unit != nullptr && !owner_unit->is_alive()) {
+    return false;
+  }
+
   // Check if ability exists
   if (get_ability(slot) == nullptr) {
     return false;
@@ -564,6 +590,12 @@ bool AbilityComponent::_can_cast(int slot) {
   return true;
 }
 
+bool AbilityComponent::_is_crowd_controlled() const {
+  Unit* owner = get_unit();
+  return owner != nullptr &&
+         (owner->get_cc_state() & CrowdControl::BLOCKS_CASTING) != 0;
+}
+
 ResourcePoolComponent* AbilityComponent::_get_resource_pool(
     const String& pool_id) {
   Unit* owner = get_unit();
@@ -636,6 +668,11 @@ void AbilityComponent::_begin_cast(int slot, Object* target) {
     return;
   }
 
+  // A new cast ends a channel still running from another slot
+  if (channel_registered) {
+    _finish_casting();
+  }
+
   casting_slot = slot;
   casting_target = target;
   casting_timer = 0.0f;
@@ -708,7 +745,50 @@ void AbilityComponent::_apply_cooldown(int slot) {
   emit_signal("ability_cooldown_started", slot, cooldown);
 }
 
+void AbilityComponent::_begin_channel(AbilityNode* ability) {
+  ChannelSystem* channels = ChannelSystem::ensure_singleton(this);
+  if (channels == nullptr) {
+    return;
+  }
+
+  // Only unit-target channels are range-checked
+  Unit* target_unit = nullptr;
+  if (ability->get_targeting_type() ==
+      static_cast<int>(TargetingType::UNIT_TARGET)) {
+    target_unit = Object::cast_to<Unit>(casting_target);
+  }
+
+  double remaining = ability->get_channel_duration() - casting_timer;
+  channels->begin_channel(this, get_unit(), target_unit, ability->get_range(),
+                          remaining, ability->get_channel_tick_interval());
+  channel_registered = true;
+}
+
+bool AbilityComponent::channel_tick() {
+  if (!channel_registered || casting_slot < 0) {
+    return false;
+  }
+
+  emit_signal("ability_channel_tick", casting_slot, casting_target);
+  _execute_ability(casting_slot);
+  return casting_state == static_cast<int>(CastState::ON_COOLDOWN);
+}
+
+void AbilityComponent::finish_channel() {
+  if (channel_registered) {
+    _finish_casting();
+  }
+}
+
 void AbilityComponent::_finish_casting() {
+  if (channel_registered) {
+    channel_registered = false;
+    ChannelSystem* channels = ChannelSystem::get_singleton();
+    if (channels != nullptr) {
+      channels->end_channel(this);
+    }
+  }
+
   casting_slot = -1;
   casting_target = nullptr;
   casting_timer = 0.0f;
@@ -720,21 +800,22 @@ void AbilityComponent::register_debug_labels(LabelRegistry* registry) {
     return;
   }
 
-  String casting_status;
+  registry->register_property("Ability", "status",
+                              is_casting() ? "CASTING" : "IDLE");
   if (is_casting()) {
-    casting_status = String("CASTING_") + String::num(casting_slot);
-  } else {
-    casting_status = "IDLE";
+    registry->register_property("Ability", "casting", casting_slot);
   }
 
-  registry->register_property("Ability", "status", casting_status);
-
   // Register cooldowns for first few ability slots
+  static constexpr const char* SLOT_KEYS[] = {"slot_0_cd", "slot_1_cd",
+                                              "slot_2_cd", "slot_3_cd"};
   for (int i = 0; i < static_cast<int>(cooldown_timers.size()) && i < 4; ++i) {
-    String slot_key = String("slot_") + String::num(i) + "_cd";
     float cd = get_cooldown_remaining(i);
-    registry->register_property("Ability", slot_key,
-                                cd > 0.0f ? String::num(cd) : "ready");
+    if (cd > 0.0f) {
+      registry->register_property("Ability", SLOT_KEYS[i], cd);
+    } else {
+      registry->register_property("Ability", SLOT_KEYS[i], "ready");
+    }
   }
 }
 
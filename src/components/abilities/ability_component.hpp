@@ -50,8 +50,9 @@ class AbilityComponent : public UnitComponent {
   float casting_timer = 0.0f;
   int casting_state = static_cast<int>(CastState::IDLE);
 
-  // Channel ticking (for periodic damage abilities)
-  float next_tick_time = 0.0f;  // When the next tick should occur
+  // Set once the cast point of a channel has fired; ChannelSystem then owns
+  // range checks, ticks and the channel's end
+  bool channel_registered = false;
 
   // Resource pool reference (for mana checks)
   ResourcePoolComponent* resource_pool = nullptr;
@@ -93,13 +94,28 @@ class AbilityComponent : public UnitComponent {
   float get_cooldown_duration(int slot) const;
   int get_cast_state(int slot) const;
 
+  // Idle when not casting and every slot is off cooldown (ActivitySystem)
+  bool is_idle() const override;
+
   // ========== CASTING CONTROL ==========
   // Interrupt active channel or cast (applies cooldown)
   void interrupt_casting();
 
+  // ========== CHANNEL CALLBACKS (ChannelSystem) ==========
+  // Fire one channel tick; returns false if the ability didn't execute
+  bool channel_tick();
+
+  // The channel ended (duration elapsed, target lost or out of range)
+  void finish_channel();
+
   // Debug label registration
   void register_debug_labels(LabelRegistry* registry) override;
 
+ protected:
+  // Death interrupts the cast; cooldowns keep running while dead, so the
+  // component stays processing. Pooling clears them
+  void _on_lifecycle_changed(UnitLifecycle state) override;
+
   // ========== INTERNAL METHODS ==========
  private:
   // Get resource pool by ID, or return default if not found
@@ -108,6 +124,9 @@ class AbilityComponent : public UnitComponent {
   // Validation: check if ability can be cast
   bool _can_cast(int slot);
 
+  // Check the owner's crowd-control state for stuns/knockbacks
+  bool _is_crowd_controlled() const;
+
   // Check if we have enough resources (mana)
   bool _can_afford(int slot);
 
@@ -120,6 +139,9 @@ class AbilityComponent : public UnitComponent {
   // Apply cooldown after ability executes
   void _apply_cooldown(int slot);
 
+  // Hand the running channel over to ChannelSystem after its cast point
+  void _begin_channel(AbilityNode* ability);
+
   // Transition out of casting state
   void _finish_casting();
 
@@ -13,7 +13,7 @@ enum class TargetingType {
   UNIT_TARGET,   // Must target a specific unit (enemy/ally/self)
   POINT_TARGET,  // Targets a point in the world
   AREA,          // Affects all units in an area around a point
-  SKILLSHOT,     // Directional ability (line, cone, etc.) - future
+  SKILLSHOT,     // Directional ability (line, cone, rect; see UnitQuery)
   SELF_CAST      // No targeting required, affects caster
 };
 
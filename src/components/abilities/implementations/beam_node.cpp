@@ -1,16 +1,21 @@
 #include "beam_node.hpp"
 #include "../../../debug/debug_macros.hpp"
 
+#include <algorithm>
+#include <array>
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/property_info.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
-#include "../../../common/unit_signals.hpp"
 #include "../../../core/unit.hpp"
+#include "../ability_api.hpp"
 
 using godot::ClassDB;
 using godot::D_METHOD;
+using godot::PropertyInfo;
 using godot::String;
 using godot::UtilityFunctions;
+using godot::Variant;
 
 BeamNode::BeamNode() {
   // Set sensible defaults for beam
@@ -28,7 +33,14 @@ BeamNode::BeamNode() {
 BeamNode::~BeamNode() = default;
 
 void BeamNode::_bind_methods() {
-  // No custom properties for BeamNode, inherits all from AbilityNode
+  ClassDB::bind_method(D_METHOD("set_max_targets", "count"),
+                       &BeamNode::set_max_targets);
+  ClassDB::bind_method(D_METHOD("get_max_targets"),
+                       &BeamNode::get_max_targets);
+  ADD_PROPERTY(PropertyInfo(Variant::INT, "max_targets",
+                            godot::PROPERTY_HINT_RANGE, "1,16,1"),
+               "set_max_targets", "get_max_targets");
+
   ClassDB::bind_method(D_METHOD("execute", "caster", "target", "position"),
                        &BeamNode::execute);
   ClassDB::bind_method(D_METHOD("can_execute_on_target", "caster", "target"),
@@ -59,14 +71,36 @@ bool BeamNode::execute(Unit* caster, Unit* target, godot::Vector3 position) {
 
   float tick_damage = calculate_damage(caster, target);
 
-  // Fire-and-forget: emit take_damage signal, don't wait for response
-  target->relay(take_damage, tick_damage, caster);
+  // Fire-and-forget: queued for this tick's damage phase
+  AbilityAPI::apply_damage(target, tick_damage, caster);
 
   DBG_INFO("Beam", String(caster->get_name()) + " hit " + target->get_name() +
                        " for " + String::num(tick_damage) + " damage (tick)");
+
+  // Extra beams go to the enemies nearest the caster, re-picked every tick
+  if (max_targets > 1) {
+    std::array<Unit*, AbilityAPI::MAX_CHAIN_TARGETS> extra_targets;
+    Unit* primary[] = {target};
+    int32_t count = AbilityAPI::find_nearest_units(
+        caster->get_global_position(), max_targets - 1, get_range(), caster,
+        Allegiance::ENEMY, UnitSpan{primary, 1}, extra_targets.data());
+    for (int32_t i = 0; i < count; i++) {
+      AbilityAPI::apply_damage(extra_targets[i],
+                               calculate_damage(caster, extra_targets[i]),
+                               caster);
+    }
+  }
   return true;
 }
 
+void BeamNode::set_max_targets(int count) {
+  max_targets = std::clamp(count, 1, AbilityAPI::MAX_CHAIN_TARGETS);
+}
+
+int BeamNode::get_max_targets() const {
+  return max_targets;
+}
+
 bool BeamNode::can_execute_on_target(Unit* caster, Unit* target) const {
   if (caster == nullptr || target == nullptr) {
     return false;
@@ -78,9 +112,9 @@ bool BeamNode::can_execute_on_target(Unit* caster, Unit* target) const {
   }
 
   // Check if target is in range
-  float distance =
-      caster->get_global_position().distance_to(target->get_global_position());
-  if (distance > get_range()) {
+  float distance_sq = caster->get_global_position().distance_squared_to(
+      target->get_global_position());
+  if (distance_sq > get_range() * get_range()) {
     return false;
   }
 
@@ -17,16 +17,23 @@ class Unit;
 /// - Applies base_damage per tick at channel_tick_interval
 /// - Total damage = base_damage * (channel_duration / channel_tick_interval)
 /// - Channeling can be interrupted if player releases button
+/// - max_targets > 1 splits extra beams to the enemies nearest the caster
+///   within range (re-picked every tick, up to AbilityAPI::MAX_CHAIN_TARGETS)
 class BeamNode : public AbilityNode {
   GDCLASS(BeamNode, AbilityNode)
 
  protected:
   static void _bind_methods();
 
+  int max_targets = 1;
+
  public:
   BeamNode();
   ~BeamNode();
 
+  void set_max_targets(int count);
+  int get_max_targets() const;
+
   // Virtual method implementations
   bool execute(Unit* caster,
                Unit* target,
@@ -0,0 +1,147 @@
+#include "chain_lightning_node.hpp"
+#include "../../../debug/debug_macros.hpp"
+
+#include <algorithm>
+#include <array>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/property_info.hpp>
+
+#include "../../../core/unit.hpp"
+#include "../ability_api.hpp"
+
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::PropertyInfo;
+using godot::String;
+using godot::Variant;
+
+ChainLightningNode::ChainLightningNode() {
+  // Set sensible defaults for chain lightning
+  set_ability_name("Chain Lightning");
+  set_description("Lightning that jumps between nearby enemies");
+  set_cast_type(static_cast<int>(CastType::INSTANT));
+  set_targeting_type(static_cast<int>(TargetingType::UNIT_TARGET));
+  set_base_damage(60.0f);
+  set_range(9.0f);
+  set_cooldown(8.0f);
+}
+
+ChainLightningNode::~ChainLightningNode() = default;
+
+void ChainLightningNode::_bind_methods() {
+  ClassDB::bind_method(D_METHOD("set_max_bounces", "bounces"),
+                       &ChainLightningNode::set_max_bounces);
+  ClassDB::bind_method(D_METHOD("get_max_bounces"),
+                       &ChainLightningNode::get_max_bounces);
+  ADD_PROPERTY(PropertyInfo(Variant::INT, "max_bounces",
+                            godot::PROPERTY_HINT_RANGE, "0,15,1"),
+               "set_max_bounces", "get_max_bounces");
+
+  ClassDB::bind_method(D_METHOD("set_bounce_range", "range"),
+                       &ChainLightningNode::set_bounce_range);
+  ClassDB::bind_method(D_METHOD("get_bounce_range"),
+                       &ChainLightningNode::get_bounce_range);
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "bounce_range"),
+               "set_bounce_range", "get_bounce_range");
+
+  ClassDB::bind_method(D_METHOD("set_damage_falloff", "falloff"),
+                       &ChainLightningNode::set_damage_falloff);
+  ClassDB::bind_method(D_METHOD("get_damage_falloff"),
+                       &ChainLightningNode::get_damage_falloff);
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "damage_falloff",
+                            godot::PROPERTY_HINT_RANGE, "0,1,0.01"),
+               "set_damage_falloff", "get_damage_falloff");
+
+  ClassDB::bind_method(D_METHOD("execute", "caster", "target", "position"),
+                       &ChainLightningNode::execute);
+  ClassDB::bind_method(D_METHOD("can_execute_on_target", "caster", "target"),
+                       &ChainLightningNode::can_execute_on_target);
+  ClassDB::bind_method(D_METHOD("calculate_damage", "caster", "target"),
+                       &ChainLightningNode::calculate_damage);
+}
+
+void ChainLightningNode::set_max_bounces(int bounces) {
+  max_bounces = std::clamp(bounces, 0, AbilityAPI::MAX_CHAIN_TARGETS - 1);
+}
+
+int ChainLightningNode::get_max_bounces() const {
+  return max_bounces;
+}
+
+void ChainLightningNode::set_bounce_range(float range) {
+  bounce_range = std::max(0.0f, range);
+}
+
+float ChainLightningNode::get_bounce_range() const {
+  return bounce_range;
+}
+
+void ChainLightningNode::set_damage_falloff(float falloff) {
+  damage_falloff = std::clamp(falloff, 0.0f, 1.0f);
+}
+
+float ChainLightningNode::get_damage_falloff() const {
+  return damage_falloff;
+}
+
+bool ChainLightningNode::execute(Unit* caster,
+                                 Unit* target,
+                                 godot::Vector3 position) {
+  if (caster == nullptr) {
+    DBG_ERROR("ChainLightning", "No caster provided");
+    return false;
+  }
+
+  if (target == nullptr) {
+    DBG_ERROR("ChainLightning", "No target provided");
+    return false;
+  }
+
+  if (!target->is_inside_tree()) {
+    DBG_ERROR("ChainLightning", "Target is not in tree");
+    return false;
+  }
+
+  // Hop list on the stack: no allocation however often this fires
+  std::array<Unit*, AbilityAPI::MAX_CHAIN_TARGETS> hops;
+  int32_t hop_count = AbilityAPI::select_chain_hops(
+      target, max_bounces + 1, bounce_range, caster, Allegiance::ENEMY,
+      hops.data());
+
+  // Fire-and-forget: queued for this tick's damage phase
+  float damage = calculate_damage(caster, target);
+  for (int32_t i = 0; i < hop_count; i++) {
+    AbilityAPI::apply_damage(hops[i], damage, caster);
+    damage *= 1.0f - damage_falloff;
+  }
+
+  DBG_INFO("ChainLightning", String(caster->get_name()) + " hit " +
+                                 String::num(hop_count) + " units from " +
+                                 String(target->get_name()));
+  return true;
+}
+
+bool ChainLightningNode::can_execute_on_target(Unit* caster,
+                                               Unit* target) const {
+  if (caster == nullptr || target == nullptr) {
+    return false;
+  }
+
+  if (!AbilityAPI::are_enemies(caster, target)) {
+    return false;
+  }
+
+  // Check if target is in range
+  float distance_sq = caster->get_global_position().distance_squared_to(
+      target->get_global_position());
+  if (distance_sq > get_range() * get_range()) {
+    return false;
+  }
+
+  return true;
+}
+
+float ChainLightningNode::calculate_damage(Unit* caster, Unit* target) const {
+  // Damage of the first hop; later hops lose damage_falloff each
+  return get_base_damage();
+}
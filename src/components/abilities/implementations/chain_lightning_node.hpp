@@ -0,0 +1,52 @@
+#ifndef GDEXTENSION_CHAIN_LIGHTNING_NODE_H
+#define GDEXTENSION_CHAIN_LIGHTNING_NODE_H
+
+#include "../ability_node.hpp"
+
+using godot::String;
+
+class Unit;
+
+/// Chain Lightning - Bouncing single-target damage ability
+/// Strikes the target, then jumps to the nearest enemy not yet hit
+///
+/// Properties:
+/// - Instant cast, targets a specific enemy unit
+/// - Jumps up to max_bounces times, each to the nearest enemy within
+///   bounce_range of the previous hop (hops are never hit twice per cast)
+/// - Each hop deals damage_falloff less than the one before it
+/// - Set cast_type to CHANNEL for an arc that re-chains on every channel tick
+class ChainLightningNode : public AbilityNode {
+  GDCLASS(ChainLightningNode, AbilityNode)
+
+ protected:
+  static void _bind_methods();
+
+  int max_bounces = 3;
+  float bounce_range = 6.0f;
+  float damage_falloff = 0.15f;  // Fraction lost per hop
+
+ public:
+  ChainLightningNode();
+  ~ChainLightningNode();
+
+  void set_max_bounces(int bounces);
+  int get_max_bounces() const;
+
+  void set_bounce_range(float range);
+  float get_bounce_range() const;
+
+  void set_damage_falloff(float falloff);
+  float get_damage_falloff() const;
+
+  // Virtual method implementations
+  bool execute(Unit* caster,
+               Unit* target,
+               godot::Vector3 position = godot::Vector3()) override;
+
+  bool can_execute_on_target(Unit* caster, Unit* target) const override;
+
+  float calculate_damage(Unit* caster, Unit* target = nullptr) const override;
+};
+
+#endif  // GDEXTENSION_CHAIN_LIGHTNING_NODE_H
@@ -1,23 +1,31 @@
 #include "explosion_node.hpp"
 #include "../../../debug/debug_macros.hpp"
 
+#include <algorithm>
 #include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/classes/scene_tree.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/core/math.hpp>
+#include <godot_cpp/core/property_info.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
+#include "../../../common/allegiance.hpp"
 #include "../../../common/unit_signals.hpp"
 #include "../../../core/unit.hpp"
+#include "../../../systems/unit_query.hpp"
+#include "../../../systems/zone_system.hpp"
 #include "../../../visual/vfx_node.hpp"
+#include "../ability_api.hpp"
 
 using godot::Array;
 using godot::ClassDB;
 using godot::D_METHOD;
 using godot::Node;
+using godot::PropertyInfo;
 using godot::SceneTree;
 using godot::String;
 using godot::UtilityFunctions;
+using godot::Variant;
 using godot::Vector3;
 
 ExplosionNode::ExplosionNode() {
@@ -37,7 +45,29 @@ ExplosionNode::ExplosionNode() {
 ExplosionNode::~ExplosionNode() = default;
 
 void ExplosionNode::_bind_methods() {
-  // No custom properties for ExplosionNode, inherits all from AbilityNode
+  ClassDB::bind_method(D_METHOD("set_burn_duration", "duration"),
+                       &ExplosionNode::set_burn_duration);
+  ClassDB::bind_method(D_METHOD("get_burn_duration"),
+                       &ExplosionNode::get_burn_duration);
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "burn_duration",
+                            godot::PROPERTY_HINT_RANGE, "0,30,0.1"),
+               "set_burn_duration", "get_burn_duration");
+
+  ClassDB::bind_method(D_METHOD("set_burn_damage_per_tick", "damage"),
+                       &ExplosionNode::set_burn_damage_per_tick);
+  ClassDB::bind_method(D_METHOD("get_burn_damage_per_tick"),
+                       &ExplosionNode::get_burn_damage_per_tick);
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "burn_damage_per_tick"),
+               "set_burn_damage_per_tick", "get_burn_damage_per_tick");
+
+  ClassDB::bind_method(D_METHOD("set_burn_tick_interval", "interval"),
+                       &ExplosionNode::set_burn_tick_interval);
+  ClassDB::bind_method(D_METHOD("get_burn_tick_interval"),
+                       &ExplosionNode::get_burn_tick_interval);
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "burn_tick_interval",
+                            godot::PROPERTY_HINT_RANGE, "0.05,5,0.05"),
+               "set_burn_tick_interval", "get_burn_tick_interval");
+
   ClassDB::bind_method(D_METHOD("execute", "caster", "target", "position"),
                        &ExplosionNode::execute);
   ClassDB::bind_method(D_METHOD("can_execute_on_target", "caster", "target"),
@@ -62,18 +92,6 @@ bool ExplosionNode::execute(Unit* caster, Unit* target, Vector3 position) {
   // For point-target abilities, use the clicked position
   Vector3 impact_point = position;
 
-  // Get the root node to search from
-  // SceneTree::get_root() returns a Window, but we need to search the scene
-  // tree Instead, use the caster's parent hierarchy to find the scene root
-  Node* root = caster;
-  while (root->get_parent() != nullptr) {
-    root = root->get_parent();
-  }
-  if (root == nullptr) {
-    DBG_ERROR("Explosion", "Cannot find scene root");
-    return false;
-  }
-
   // Trigger explosion VFX at impact position with animation-driven damage
   // callback
   godot::Dictionary explosion_params;
@@ -96,104 +114,97 @@ bool ExplosionNode::execute(Unit* caster, Unit* target, Vector3 position) {
   auto vfx = Object::cast_to<VFXNode>(vfx_node);
   if (vfx != nullptr) {
     vfx->register_callback(
-        "explosion_damage", [this, caster, root, impact_point]() {
-          // Calculate radius squared for distance checks
-          float radius = get_aoe_radius();
-          float radius_sq = radius * radius;
-
-          // Find all units in the area
-          Array units_in_area;
-          _search_units_in_tree(root, impact_point, radius_sq, units_in_area);
+        "explosion_damage", [this, caster, impact_point]() {
+          // Every unit in the area except the caster
+          UnitSpan units_in_area = UnitQuery::sphere(
+              impact_point, get_aoe_radius(), caster, Allegiance::OTHERS);
 
           // Apply damage to all units in area
           int hit_count = 0;
-          for (int i = 0; i < units_in_area.size(); i++) {
-            Unit* affected_unit = Object::cast_to<Unit>(units_in_area[i]);
-
-            if (affected_unit == nullptr || !affected_unit->is_inside_tree()) {
-              continue;
-            }
-
-            // Don't damage the caster
-            if (affected_unit == caster) {
-              continue;
-            }
-
-            // Apply damage via fire-and-forget signal
+          for (Unit* affected_unit : units_in_area) {
+            // Queued for this tick's damage phase
             float damage = calculate_damage(caster, affected_unit);
-            affected_unit->relay("take_damage", damage, caster);
+            AbilityAPI::apply_damage(affected_unit, damage, caster);
             hit_count++;
           }
+
+          // Proxy minions caught in the blast take the untargeted damage
+          hit_count += AbilityAPI::apply_proxy_aoe_damage(
+              impact_point, get_aoe_radius(), calculate_damage(caster), caster,
+              Allegiance::OTHERS);
+
+          _create_burning_ground(caster, impact_point);
         });
   }
 
   return true;
 }
 
-bool ExplosionNode::can_execute_on_target(Unit* caster, Unit* target) const {
-  if (caster == nullptr) {
-    return false;
+void ExplosionNode::_create_burning_ground(Unit* caster,
+                                           const Vector3& center) {
+  if (burn_duration <= 0.0f || burn_damage_per_tick <= 0.0f ||
+      caster == nullptr || !caster->is_inside_tree()) {
+    return;
   }
 
-  // Self-cast ability - only needs a valid caster
-  return true;
-}
+  ZoneSystem* zones = ZoneSystem::ensure_singleton(caster);
+  if (zones == nullptr) {
+    return;
+  }
 
-float ExplosionNode::calculate_damage(Unit* caster, Unit* target) const {
-  // Simple damage: just return base damage
-  // Subclasses can override to add scaling (e.g., based on caster stats)
-  return get_base_damage();
+  // Same targets as the blast: everyone but the caster
+  ZoneSystem::ZoneParams params;
+  params.center = center;
+  params.radius = get_aoe_radius();
+  params.duration = burn_duration;
+  params.tick_interval = burn_tick_interval;
+  params.source = caster;
+  params.allegiance = Allegiance::OTHERS;
+  params.damage_per_tick = burn_damage_per_tick;
+  params.damage_type = DamageType::MAGICAL;
+  zones->add_zone(params);
 }
 
-Array ExplosionNode::query_units_in_area(const Vector3& center) const {
-  Array result;
+void ExplosionNode::set_burn_duration(float duration) {
+  burn_duration = std::max(0.0f, duration);
+}
 
-  // This method needs to be called with a caster that's in the scene tree
-  // For now, we'll search from the current node's perspective
-  // Note: ExplosionNode itself is not in the tree, but is called from
-  // AbilityComponent which is in the tree
+float ExplosionNode::get_burn_duration() const {
+  return burn_duration;
+}
 
-  // Since we can't reliably access the scene tree from here, we'll use a
-  // different approach: The caster is responsible for being in the tree, so we
-  // search from the root by finding any Unit in the scene
+void ExplosionNode::set_burn_damage_per_tick(float damage) {
+  burn_damage_per_tick = std::max(0.0f, damage);
+}
 
-  // Calculate radius squared for distance checks
-  float radius = get_aoe_radius();
-  float radius_sq = radius * radius;
+float ExplosionNode::get_burn_damage_per_tick() const {
+  return burn_damage_per_tick;
+}
 
-  // We need the scene root - try to get it from the owner if available
-  // This is a limitation of the current design - abilities are data objects
-  // that don't have direct scene tree access
+void ExplosionNode::set_burn_tick_interval(float interval) {
+  burn_tick_interval = std::max(0.05f, interval);
+}
 
-  // For now, just return empty - the caster should provide units to search
-  DBG_WARN("Explosion", "query_units_in_area called without scene context");
-  return result;
+float ExplosionNode::get_burn_tick_interval() const {
+  return burn_tick_interval;
 }
 
-void ExplosionNode::_search_units_in_tree(Node* node,
-                                          const Vector3& center,
-                                          float radius_sq,
-                                          Array& result) const {
-  if (node == nullptr) {
-    return;
+bool ExplosionNode::can_execute_on_target(Unit* caster, Unit* target) const {
+  if (caster == nullptr) {
+    return false;
   }
 
-  // Check if current node is a Unit
-  Unit* unit = Object::cast_to<Unit>(node);
-  if (unit != nullptr && unit->is_inside_tree()) {
-    Vector3 unit_pos = unit->get_global_position();
-    float distance_sq = center.distance_squared_to(unit_pos);
+  // Self-cast ability - only needs a valid caster
+  return true;
+}
 
-    if (distance_sq <= radius_sq) {
-      result.append(unit);
-    }
-  }
+float ExplosionNode::calculate_damage(Unit* caster, Unit* target) const {
+  // Simple damage: just return base damage
+  // Subclasses can override to add scaling (e.g., based on caster stats)
+  return get_base_damage();
+}
 
-  // Recursively search children (limit depth to avoid stack overflow)
-  for (int i = 0; i < node->get_child_count(); i++) {
-    Node* child = node->get_child(i);
-    if (child != nullptr) {
-      _search_units_in_tree(child, center, radius_sq, result);
-    }
-  }
+Array ExplosionNode::query_units_in_area(const Vector3& center) const {
+  // Script binding; no caster here, so every faction is included
+  return AbilityAPI::get_units_in_sphere(center, get_aoe_radius());
 }
@@ -14,18 +14,35 @@ class Unit;
 /// Properties:
 /// - Instant cast (no windup)
 /// - Self-cast (no target selection needed)
-/// - Targets all units in area around caster
-/// - Applies base_damage to all units in radius
+/// - Targets enemy units in area around the impact point
+/// - Applies base_damage to all enemies in radius
+/// - With burn_duration > 0, leaves burning ground (a ZoneSystem zone) that
+///   deals burn_damage_per_tick every burn_tick_interval to units inside
 class ExplosionNode : public AbilityNode {
   GDCLASS(ExplosionNode, AbilityNode)
 
  protected:
   static void _bind_methods();
 
+  float burn_duration = 0.0f;  // 0 = no burning ground
+  float burn_damage_per_tick = 10.0f;
+  float burn_tick_interval = 0.5f;
+
+  void _create_burning_ground(Unit* caster, const godot::Vector3& center);
+
  public:
   ExplosionNode();
   ~ExplosionNode();
 
+  void set_burn_duration(float duration);
+  float get_burn_duration() const;
+
+  void set_burn_damage_per_tick(float damage);
+  float get_burn_damage_per_tick() const;
+
+  void set_burn_tick_interval(float interval);
+  float get_burn_tick_interval() const;
+
   // Virtual method implementations
   bool execute(Unit* caster,
                Unit* target,
@@ -37,13 +54,6 @@ class ExplosionNode : public AbilityNode {
 
   // Helper method to find all units in area
   godot::Array query_units_in_area(const godot::Vector3& center) const;
-
- private:
-  // Recursive helper to search scene tree for units within radius
-  void _search_units_in_tree(godot::Node* node,
-                             const godot::Vector3& center,
-                             float radius_sq,
-                             godot::Array& result) const;
 };
 
 #endif  // GDEXTENSION_EXPLOSION_NODE_H
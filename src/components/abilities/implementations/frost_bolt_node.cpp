@@ -4,8 +4,8 @@
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
-#include "../../../common/unit_signals.hpp"
 #include "../../../core/unit.hpp"
+#include "../ability_api.hpp"
 
 using godot::ClassDB;
 using godot::D_METHOD;
@@ -59,15 +59,13 @@ bool FrostBoltNode::execute(Unit* caster,
   // Calculate damage
   float damage = calculate_damage(caster, target);
 
-  // Fire-and-forget: emit take_damage signal, don't wait for response
-  caster->relay(take_damage, damage, target);
+  // Fire-and-forget: queued for this tick's damage phase
+  AbilityAPI::apply_damage(target, damage, caster);
   DBG_INFO("FrostBolt", String(caster->get_name()) + " dealt " +
                             String::num(damage) + " damage to " +
                             String(target->get_name()));
 
-  // TODO: Apply slow effect to target
-  // For now, just damage. Slow effect can be added with a status effect system
-  // later.
+  AbilityAPI::apply_slow(target, SLOW_PERCENT, SLOW_DURATION);
   return true;
 }
 
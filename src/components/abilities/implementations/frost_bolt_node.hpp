@@ -9,12 +9,13 @@ class Unit;
 
 /// Frost Bolt - Single-target cast-time damage ability with slow effect
 /// Ranged attack that has a windup time before executing
-/// Applies damage to target unit and can apply slow effect
+/// Applies damage to target unit and slows it
 ///
 /// Properties:
 /// - Cast time ability (0.7s windup)
 /// - Targets a specific unit
 /// - Applies base_damage to target
+/// - Slows the target by SLOW_PERCENT for SLOW_DURATION seconds
 /// - Cast point at 0.5 means ability fires at 50% through cast time
 class FrostBoltNode : public AbilityNode {
   GDCLASS(FrostBoltNode, AbilityNode)
@@ -23,6 +24,9 @@ class FrostBoltNode : public AbilityNode {
   static void _bind_methods();
 
  public:
+  static constexpr float SLOW_PERCENT = 0.3f;
+  static constexpr float SLOW_DURATION = 2.0f;
+
   FrostBoltNode();
   ~FrostBoltNode();
 
@@ -4,7 +4,6 @@
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
-#include "../../../common/unit_signals.hpp"
 #include "../../../core/unit.hpp"
 #include "../ability_api.hpp"
 
@@ -67,8 +66,8 @@ bool InstantStrikeNode::execute(Unit* caster,
   // Calculate damage
   float damage = calculate_damage(caster, target);
 
-  // Fire-and-forget: emit take_damage signal, don't wait for response
-  caster->relay(take_damage, damage, target);
+  // Fire-and-forget: queued for this tick's damage phase
+  AbilityAPI::apply_damage(target, damage, caster, DamageType::PHYSICAL);
 
   DBG_INFO("InstantStrike", String(caster->get_name()) + " dealt " +
                                 String::num(damage) + " damage to " +
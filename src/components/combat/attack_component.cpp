@@ -9,9 +9,14 @@
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
+#include "../../common/crowd_control.hpp"
 #include "../../common/unit_signals.hpp"
 #include "../../core/unit.hpp"
 #include "../../debug/debug_macros.hpp"
+#include "../../systems/damage_queue.hpp"
+#include "../../systems/proxy_minion_system.hpp"
+#include "../../systems/target_acquisition.hpp"
+#include "../../systems/unit_index.hpp"
 #include "../health/health_component.hpp"
 #include "../ui/label_registry.hpp"
 #include "projectile.hpp"
@@ -34,8 +39,12 @@ void AttackComponent::_bind_methods() {
                        &AttackComponent::_on_move_requested);
   ClassDB::bind_method(D_METHOD("_on_attack_requested", "target", "position"),
                        &AttackComponent::_on_attack_requested);
+  ClassDB::bind_method(D_METHOD("_on_attack_proxy_requested", "proxy"),
+                       &AttackComponent::_on_attack_proxy_requested);
   ClassDB::bind_method(D_METHOD("_on_stop_requested"),
                        &AttackComponent::_on_stop_requested);
+  ClassDB::bind_method(D_METHOD("_on_owner_damaged", "damage", "source"),
+                       &AttackComponent::_on_owner_damaged);
 
   // Bind all methods first
   ClassDB::bind_method(D_METHOD("set_base_attack_time", "bat"),
@@ -88,6 +97,16 @@ void AttackComponent::_bind_methods() {
   ClassDB::bind_method(D_METHOD("get_projectile_scene"),
                        &AttackComponent::get_projectile_scene);
 
+  ClassDB::bind_method(D_METHOD("set_auto_acquire_targets", "enabled"),
+                       &AttackComponent::set_auto_acquire_targets);
+  ClassDB::bind_method(D_METHOD("get_auto_acquire_targets"),
+                       &AttackComponent::get_auto_acquire_targets);
+
+  ClassDB::bind_method(D_METHOD("set_target_priority", "priority"),
+                       &AttackComponent::set_target_priority);
+  ClassDB::bind_method(D_METHOD("get_target_priority"),
+                       &AttackComponent::get_target_priority);
+
   ClassDB::bind_method(D_METHOD("try_fire_at", "target", "delta"),
                        &AttackComponent::try_fire_at);
   ClassDB::bind_method(D_METHOD("get_attack_interval"),
@@ -122,6 +141,14 @@ void AttackComponent::_bind_methods() {
   ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "attack_buffer_range"),
                "set_attack_buffer_range", "get_attack_buffer_range");
 
+  ADD_GROUP("Auto Acquisition", "");
+  ADD_PROPERTY(PropertyInfo(Variant::BOOL, "auto_acquire_targets"),
+               "set_auto_acquire_targets", "get_auto_acquire_targets");
+  ADD_PROPERTY(
+      PropertyInfo(Variant::INT, "target_priority", godot::PROPERTY_HINT_ENUM,
+                   "Closest,Lowest Health,Last Attacker"),
+      "set_target_priority", "get_target_priority");
+
   ADD_SIGNAL(godot::MethodInfo("attack_started",
                                PropertyInfo(Variant::OBJECT, "target")));
   ADD_SIGNAL(godot::MethodInfo("attack_point_reached",
@@ -143,12 +170,18 @@ void AttackComponent::_ready() {
     return;
   }
 
+  // Exported values are the base stats; modifiers apply on top
+  _set_base_stat(Stat::ATTACK_SPEED, attack_speed);
+  _set_base_stat(Stat::ATTACK_DAMAGE, attack_damage);
+  _set_base_stat(Stat::ATTACK_RANGE, attack_range);
+
   // Register signals that this component uses
   owner->register_signal(move_requested);
   owner->register_signal(attack_requested);
   owner->register_signal(chase_requested);
   owner->register_signal(chase_to_range_requested);
   owner->register_signal(stop_requested);
+  owner->register_signal(attack_proxy_requested);
 
   // Connect to the Unit's movement-related signals
   // move_requested cancels any active attack
@@ -156,6 +189,26 @@ void AttackComponent::_ready() {
   owner->connect(attack_requested,
                  godot::Callable(this, "_on_attack_requested"));
   owner->connect(stop_requested, godot::Callable(this, "_on_stop_requested"));
+  owner->connect(attack_proxy_requested,
+                 godot::Callable(this, "_on_attack_proxy_requested"));
+
+  // Remember who hit us last (LAST_ATTACKER priority)
+  owner->register_signal(take_damage);
+  owner->connect(take_damage, godot::Callable(this, "_on_owner_damaged"));
+
+  if (auto_acquire_targets) {
+    TargetAcquisition* acquisition = TargetAcquisition::ensure_singleton(this);
+    if (acquisition != nullptr) {
+      acquisition->add_seeker(this);
+    }
+  }
+}
+
+void AttackComponent::_exit_tree() {
+  TargetAcquisition* acquisition = TargetAcquisition::get_singleton();
+  if (acquisition != nullptr) {
+    acquisition->remove_seeker(this);
+  }
 }
 
 void AttackComponent::_physics_process(double delta) {
@@ -168,14 +221,27 @@ void AttackComponent::_physics_process(double delta) {
     time_until_next_attack -= delta;
   }
 
+  // Stunned or knocked back: cancel any windup but keep the attack order so
+  // it resumes once the crowd control ends
+  Unit* self = get_unit();
+  if (self != nullptr &&
+      (self->get_cc_state() & CrowdControl::BLOCKS_ATTACKS) != 0) {
+    in_attack_windup = false;
+    current_attack_target = nullptr;
+    current_proxy_target = ProxyMinionSystem::INVALID_HANDLE;
+    return;
+  }
+
   // Advance windup timer if in windup
   if (in_attack_windup) {
     attack_windup_timer += delta;
 
     // Check if we've reached the attack point
     if (attack_windup_timer >= attack_point) {
-      if (current_attack_target != nullptr &&
-          current_attack_target->is_inside_tree()) {
+      if (current_proxy_target != ProxyMinionSystem::INVALID_HANDLE) {
+        _fire_at_proxy(current_proxy_target);
+      } else if (current_attack_target != nullptr &&
+                 current_attack_target->is_inside_tree()) {
         // Fire the attack if target is still valid
         if (current_attack_target->is_inside_tree()) {
           if (delivery_type == AttackDelivery::MELEE) {
@@ -192,9 +258,15 @@ void AttackComponent::_physics_process(double delta) {
       // Exit windup regardless
       in_attack_windup = false;
       current_attack_target = nullptr;
+      current_proxy_target = ProxyMinionSystem::INVALID_HANDLE;
     }
   }
 
+  if (active_proxy_target != ProxyMinionSystem::INVALID_HANDLE) {
+    _update_proxy_attack();
+    return;
+  }
+
   // Handle active attack target
   if (active_attack_target != nullptr &&
       active_attack_target->is_inside_tree()) {
@@ -204,7 +276,7 @@ void AttackComponent::_physics_process(double delta) {
       float distance = owner->get_global_position().distance_to(
           active_attack_target->get_global_position());
 
-      if (distance <= attack_range) {
+      if (distance <= _get_stat(Stat::ATTACK_RANGE, attack_range)) {
         // In range: attempt to attack if cooldown is over
         if (!in_attack_windup && time_until_next_attack <= 0.0) {
           try_fire_at(active_attack_target, delta);
@@ -230,6 +302,7 @@ float AttackComponent::get_base_attack_time() const {
 
 void AttackComponent::set_attack_speed(float speed) {
   attack_speed = std::max(1.0f, speed);
+  _set_base_stat(Stat::ATTACK_SPEED, attack_speed);
 }
 
 float AttackComponent::get_attack_speed() const {
@@ -246,6 +319,7 @@ float AttackComponent::get_attack_point() const {
 
 void AttackComponent::set_attack_range(float range) {
   attack_range = std::max(0.1f, range);
+  _set_base_stat(Stat::ATTACK_RANGE, attack_range);
 }
 
 float AttackComponent::get_attack_range() const {
@@ -254,6 +328,7 @@ float AttackComponent::get_attack_range() const {
 
 void AttackComponent::set_attack_damage(float damage) {
   attack_damage = std::max(0.0f, damage);
+  _set_base_stat(Stat::ATTACK_DAMAGE, attack_damage);
 }
 
 float AttackComponent::get_attack_damage() const {
@@ -304,6 +379,100 @@ float AttackComponent::get_attack_buffer_range() const {
   return attack_buffer_range;
 }
 
+void AttackComponent::set_auto_acquire_targets(bool enabled) {
+  if (auto_acquire_targets == enabled) {
+    return;
+  }
+  auto_acquire_targets = enabled;
+
+  // Runtime toggles (re)register with the service; scene-loaded values are
+  // picked up in _ready
+  if (!is_inside_tree() || Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  if (enabled) {
+    TargetAcquisition* acquisition = TargetAcquisition::ensure_singleton(this);
+    if (acquisition != nullptr) {
+      acquisition->add_seeker(this);
+    }
+  } else if (TargetAcquisition::get_singleton() != nullptr) {
+    TargetAcquisition::get_singleton()->remove_seeker(this);
+  }
+}
+
+bool AttackComponent::get_auto_acquire_targets() const {
+  return auto_acquire_targets;
+}
+
+void AttackComponent::set_target_priority(int priority) {
+  if (priority >= static_cast<int>(TargetPriority::CLOSEST) &&
+      priority <= static_cast<int>(TargetPriority::LAST_ATTACKER)) {
+    target_priority = static_cast<TargetPriority>(priority);
+  }
+}
+
+int AttackComponent::get_target_priority() const {
+  return static_cast<int>(target_priority);
+}
+
+TargetPriority AttackComponent::get_target_priority_enum() const {
+  return target_priority;
+}
+
+bool AttackComponent::wants_auto_target() const {
+  if (!auto_acquire_targets || in_attack_windup) {
+    return false;
+  }
+  if (owner_unit != nullptr && !owner_unit->is_alive()) {
+    return false;
+  }
+  if (active_proxy_target != ProxyMinionSystem::INVALID_HANDLE) {
+    return false;
+  }
+
+  // Keep the current order while its target is alive; a dead target frees
+  // the unit to pick a new one
+  return active_attack_target == nullptr ||
+         !active_attack_target->is_inside_tree() ||
+         !UnitIndex::is_alive(active_attack_target);
+}
+
+bool AttackComponent::is_idle() const {
+  if (in_attack_windup || time_until_next_attack > 0.0 ||
+      active_proxy_target != ProxyMinionSystem::INVALID_HANDLE) {
+    return false;
+  }
+
+  return active_attack_target == nullptr ||
+         !active_attack_target->is_inside_tree() ||
+         !UnitIndex::is_alive(active_attack_target);
+}
+
+float AttackComponent::get_wake_radius() const {
+  return auto_acquire_targets ? auto_attack_range : 0.0f;
+}
+
+void AttackComponent::acquire_target(Unit* target) {
+  if (owner_unit == nullptr || target == nullptr) {
+    return;
+  }
+
+  DBG_DEBUG("AttackComponent", "" + owner_unit->get_name() +
+                                   " auto-acquired " + target->get_name());
+
+  // Issue a normal attack order so movement chases and attacking starts
+  owner_unit->relay(attack_requested, target, target->get_global_position());
+}
+
+Unit* AttackComponent::get_last_attacker() const {
+  if (last_attacker_id == 0) {
+    return nullptr;
+  }
+  return Object::cast_to<Unit>(
+      godot::ObjectDB::get_instance(last_attacker_id));
+}
+
 bool AttackComponent::try_fire_at(Unit* target, double delta) {
   if (target == nullptr || !target->is_inside_tree()) {
     return false;
@@ -330,7 +499,10 @@ bool AttackComponent::try_fire_at(Unit* target, double delta) {
 }
 
 float AttackComponent::get_attack_interval() const {
-  float attack_speed_factor = attack_speed / 100.0f;
+  // Modifiers may push attack speed below the property's minimum
+  float current_attack_speed =
+      std::max(1.0f, _get_stat(Stat::ATTACK_SPEED, attack_speed));
+  float attack_speed_factor = current_attack_speed / 100.0f;
   return base_attack_time / attack_speed_factor;
 }
 
@@ -339,31 +511,28 @@ void AttackComponent::_fire_melee(Unit* target) {
     return;
   }
 
-  // Relay damage event through target unit
-  target->relay("take_damage", attack_damage, owner_unit);
+  float damage = _get_stat(Stat::ATTACK_DAMAGE, attack_damage);
+
+  // Queue the hit; the damage phase applies armor and relays take_damage
+  DamageQueue::submit(target, damage, DamageType::PHYSICAL, owner_unit);
 
   if (owner_unit != nullptr) {
     DBG_INFO("AttackComponent",
              "" + owner_unit->get_name() + " hit " + target->get_name() +
-                 " for " + String::num(attack_damage) + " damage (MELEE)");
+                 " for " + String::num(damage) + " damage (MELEE)");
   }
 
-  emit_signal("attack_hit", target, attack_damage);
+  emit_signal("attack_hit", target, damage);
 }
 
-void AttackComponent::_fire_projectile(Unit* target) {
-  if (target == nullptr) {
-    return;
-  }
-
+Projectile* AttackComponent::_spawn_projectile() {
   if (projectile_scene.is_null()) {
     UtilityFunctions::push_error(
         "[AttackComponent] Projectile attack configured but projectile_scene "
         "is not set");
-    return;
+    return nullptr;
   }
 
-  // Spawn projectile
   Node* projectile_node = projectile_scene->instantiate();
   auto projectile = Object::cast_to<Projectile>(projectile_node);
 
@@ -371,7 +540,7 @@ void AttackComponent::_fire_projectile(Unit* target) {
     UtilityFunctions::push_error(
         "[AttackComponent] Projectile scene root must be a Projectile node");
     projectile_node->queue_free();
-    return;
+    return nullptr;
   }
 
   // Add to parent first
@@ -379,25 +548,45 @@ void AttackComponent::_fire_projectile(Unit* target) {
   if (parent != nullptr) {
     parent->add_child(projectile);
   }
+  return projectile;
+}
+
+void AttackComponent::_fire_projectile(Unit* target) {
+  if (target == nullptr) {
+    return;
+  }
+
+  Projectile* projectile = _spawn_projectile();
+  if (projectile == nullptr) {
+    return;
+  }
+
+  float damage = _get_stat(Stat::ATTACK_DAMAGE, attack_damage);
 
   if (owner_unit != nullptr) {
-    DBG_INFO("AttackComponent",
-             "" + owner_unit->get_name() + " fired projectile at " +
-                 target->get_name() +
-                 " (damage: " + String::num(attack_damage) + ")");
+    DBG_INFO("AttackComponent", "" + owner_unit->get_name() +
+                                    " fired projectile at " +
+                                    target->get_name() +
+                                    " (damage: " + String::num(damage) + ")");
   }
 
   // Configure projectile with pre-calculated damage
-  projectile->setup(owner_unit, target, attack_damage, projectile_speed);
+  projectile->setup(owner_unit, target, damage, projectile_speed);
 
-  emit_signal("attack_hit", target, attack_damage);
+  emit_signal("attack_hit", target, damage);
 }
 
 void AttackComponent::_on_attack_requested(godot::Object* target,
                                            const Vector3& position) {
+  // Dead units take no attack orders
+  if (owner_unit != nullptr && !owner_unit->is_alive()) {
+    return;
+  }
+
   // Handle attack request
   Unit* target_unit = Object::cast_to<Unit>(target);
   if (target_unit != nullptr) {
+    _clear_proxy_order();
     // Set the active attack target
     active_attack_target = target_unit;
     // Try to fire at the target if in range
@@ -406,15 +595,125 @@ void AttackComponent::_on_attack_requested(godot::Object* target,
   }
 }
 
+void AttackComponent::_on_attack_proxy_requested(int64_t proxy) {
+  if (owner_unit != nullptr && !owner_unit->is_alive()) {
+    return;
+  }
+
+  ProxyMinionSystem* proxies = ProxyMinionSystem::get_singleton();
+  if (proxies == nullptr || !proxies->is_alive(proxy)) {
+    return;
+  }
+
+  active_attack_target = nullptr;
+  active_proxy_target = proxy;
+  chasing_proxy = false;
+}
+
 void AttackComponent::_on_move_requested(const Vector3& position) {
+  // Our own walk toward a proxy target isn't a new order
+  if (issuing_proxy_chase) {
+    return;
+  }
+
   // Cancel any active attack when player issues a move command
   // Movement takes priority over attacking
   active_attack_target = nullptr;
+  _clear_proxy_order();
 }
 
 void AttackComponent::_on_stop_requested() {
+  if (issuing_proxy_chase) {
+    return;
+  }
+
   // Clear attack order when stopping
   active_attack_target = nullptr;
+  _clear_proxy_order();
+}
+
+void AttackComponent::_update_proxy_attack() {
+  ProxyMinionSystem* proxies = ProxyMinionSystem::get_singleton();
+  Vector3 proxy_position;
+  if (owner_unit == nullptr || proxies == nullptr ||
+      !proxies->get_position(active_proxy_target, proxy_position)) {
+    _clear_proxy_order();
+    return;
+  }
+
+  float range = _get_stat(Stat::ATTACK_RANGE, attack_range) +
+                proxies->get_radius(active_proxy_target);
+  Vector3 own_position = owner_unit->get_global_position();
+  own_position.y = proxy_position.y;
+  issuing_proxy_chase = true;
+  if (own_position.distance_squared_to(proxy_position) <= range * range) {
+    if (chasing_proxy) {
+      owner_unit->relay(stop_requested);
+      chasing_proxy = false;
+    }
+    if (!in_attack_windup && time_until_next_attack <= 0.0) {
+      in_attack_windup = true;
+      attack_windup_timer = 0.0;
+      current_proxy_target = active_proxy_target;
+    }
+  } else if (!chasing_proxy ||
+             proxy_chase_position.distance_squared_to(proxy_position) >
+                 1.0f) {
+    // Re-path only once the proxy has moved a meter from the last order
+    owner_unit->relay(move_requested, proxy_position);
+    proxy_chase_position = proxy_position;
+    chasing_proxy = true;
+  }
+  issuing_proxy_chase = false;
+}
+
+void AttackComponent::_fire_at_proxy(int64_t proxy) {
+  ProxyMinionSystem* proxies = ProxyMinionSystem::get_singleton();
+  if (proxies == nullptr || !proxies->is_alive(proxy)) {
+    return;
+  }
+
+  float damage = _get_stat(Stat::ATTACK_DAMAGE, attack_damage);
+  if (delivery_type == AttackDelivery::MELEE) {
+    proxies->submit_damage(proxy, damage, DamageType::PHYSICAL);
+  } else {
+    Projectile* projectile = _spawn_projectile();
+    if (projectile == nullptr) {
+      return;
+    }
+    projectile->setup_proxy(owner_unit, proxy, damage, projectile_speed);
+  }
+  time_until_next_attack = get_attack_interval();
+}
+
+void AttackComponent::_clear_proxy_order() {
+  active_proxy_target = ProxyMinionSystem::INVALID_HANDLE;
+  chasing_proxy = false;
+}
+
+void AttackComponent::_on_lifecycle_changed(UnitLifecycle state) {
+  UnitComponent::_on_lifecycle_changed(state);
+  if (state != UnitLifecycle::ALIVE) {
+    active_attack_target = nullptr;
+    current_attack_target = nullptr;
+    current_proxy_target = ProxyMinionSystem::INVALID_HANDLE;
+    in_attack_windup = false;
+    _clear_proxy_order();
+  }
+
+  // Back in the pool: the next spawn starts a fresh life
+  if (state == UnitLifecycle::POOLED) {
+    time_until_next_attack = 0.0;
+    last_attacker_id = 0;
+  }
+}
+
+void AttackComponent::_on_owner_damaged(float damage,
+                                        godot::Object* source) {
+  Unit* attacker = Object::cast_to<Unit>(source);
+  if (attacker != nullptr) {
+    last_attacker_id = attacker->get_instance_id();
+  }
 }
 
 void AttackComponent::register_debug_labels(LabelRegistry* registry) {
@@ -422,9 +721,11 @@ void AttackComponent::register_debug_labels(LabelRegistry* registry) {
     return;
   }
 
-  registry->register_property("Attack", "cooldown",
-                              godot::String::num(time_until_next_attack));
-  registry->register_property(
-      "Attack", "target",
-      current_attack_target ? current_attack_target->get_unit_name() : "none");
+  registry->register_property("Attack", "cooldown", time_until_next_attack);
+  if (current_attack_target != nullptr) {
+    registry->register_property("Attack", "target",
+                                current_attack_target->get_unit_name());
+  } else {
+    registry->register_property("Attack", "target", "none");
+  }
 }
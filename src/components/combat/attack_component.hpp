@@ -14,15 +14,21 @@ using godot::PropertyInfo;
 using godot::Ref;
 using godot::Vector3;
 
+class Projectile;
+
 enum class AttackDelivery { MELEE, PROJECTILE };
 
+// How auto-acquisition picks among enemies inside auto_attack_range
+enum class TargetPriority { CLOSEST, LOWEST_HEALTH, LAST_ATTACKER };
+
 class AttackComponent : public UnitComponent {
   GDCLASS(AttackComponent, UnitComponent)
 
  protected:
   static void _bind_methods();
 
-  // Attack stats
+  // Attack stats - speed, range and damage are base values; the Unit's
+  // StatBlock applies modifiers on top
   float base_attack_time = 1.7f;  // BAT
   float attack_speed = 100.0f;    // IAS (100 = 1.0x)
   float attack_point = 0.3f;      // Seconds until damage/projectile release
@@ -33,6 +39,12 @@ class AttackComponent : public UnitComponent {
   AttackDelivery delivery_type = AttackDelivery::MELEE;
   float projectile_speed = 20.0f;
 
+  // Auto-acquisition (see TargetAcquisition) - idle units attack enemies
+  // that come within auto_attack_range
+  bool auto_acquire_targets = false;
+  TargetPriority target_priority = TargetPriority::CLOSEST;
+  uint64_t last_attacker_id = 0;  // Instance id of the last damage source
+
   // Timing state
   double time_until_next_attack = 0.0;
   double attack_windup_timer = 0.0;
@@ -40,11 +52,20 @@ class AttackComponent : public UnitComponent {
   Unit* current_attack_target = nullptr;  // Target currently in windup
   Unit* active_attack_target = nullptr;   // Target from current ATTACK order
 
+  // Proxy minion orders (ProxyMinionSystem handles, -1 = none); proxies
+  // have no node to chase, so the unit walks to their last seen position
+  int64_t current_proxy_target = -1;
+  int64_t active_proxy_target = -1;
+  Vector3 proxy_chase_position = Vector3(0, 0, 0);
+  bool chasing_proxy = false;
+  bool issuing_proxy_chase = false;  // Our own move/stop relays keep the order
+
  public:
   AttackComponent();
   ~AttackComponent();
 
   void _ready() override;
+  void _exit_tree() override;
   void _physics_process(double delta) override;
 
   // Properties
@@ -78,6 +99,23 @@ class AttackComponent : public UnitComponent {
   void set_projectile_scene(const Ref<PackedScene>& scene);
   Ref<PackedScene> get_projectile_scene() const;
 
+  void set_auto_acquire_targets(bool enabled);
+  bool get_auto_acquire_targets() const;
+
+  void set_target_priority(int priority);
+  int get_target_priority() const;
+  TargetPriority get_target_priority_enum() const;
+
+  // Auto-acquisition hooks used by TargetAcquisition
+  bool wants_auto_target() const;
+  void acquire_target(Unit* target);
+  Unit* get_last_attacker() const;
+
+  // Sleep/wake (see ActivitySystem): idle without a live target, windup or
+  // cooldown; auto-acquiring units wake when enemies near their range
+  bool is_idle() const override;
+  float get_wake_radius() const override;
+
   // Core logic
   bool try_fire_at(Unit* target, double delta);
   float get_attack_interval() const;
@@ -85,16 +123,29 @@ class AttackComponent : public UnitComponent {
   // Debug label registration
   void register_debug_labels(LabelRegistry* registry) override;
 
+ protected:
+  // Dead or pooled: drop the attack order and any windup (pooled: and the
+  // cooldown)
+  void _on_lifecycle_changed(UnitLifecycle state) override;
+
  private:
   Ref<PackedScene> projectile_scene = nullptr;
 
   void _fire_melee(Unit* target);
   void _fire_projectile(Unit* target);
+  Projectile* _spawn_projectile();
+
+  // Proxy minion orders
+  void _update_proxy_attack();
+  void _fire_at_proxy(int64_t proxy);
+  void _clear_proxy_order();
 
   // Signal handlers for Unit's movement request signals
   void _on_move_requested(const Vector3& position);
   void _on_attack_requested(godot::Object* target, const Vector3& position);
+  void _on_attack_proxy_requested(int64_t proxy);
   void _on_stop_requested();
+  void _on_owner_damaged(float damage, godot::Object* source);
 };
 
 #endif  // GDEXTENSION_ATTACK_COMPONENT_H
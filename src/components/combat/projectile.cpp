@@ -8,6 +8,11 @@
 
 #include "../../core/unit.hpp"
 #include "../../debug/debug_macros.hpp"
+#include "../../systems/damage_queue.hpp"
+#include "../../systems/projectile_scheduler.hpp"
+#include "../../systems/proxy_minion_system.hpp"
+#include "../../systems/transform_writeback.hpp"
+#include "../../visual/projectiles/projectile_renderer.hpp"
 #include "../health/health_component.hpp"
 
 using godot::ClassDB;
@@ -27,6 +32,64 @@ void Projectile::_bind_methods() {
   ClassDB::bind_method(D_METHOD("get_hit_radius"), &Projectile::get_hit_radius);
   ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "hit_radius"), "set_hit_radius",
                "get_hit_radius");
+
+  ClassDB::bind_method(D_METHOD("set_analytic", "enabled"),
+                       &Projectile::set_analytic);
+  ClassDB::bind_method(D_METHOD("is_analytic"), &Projectile::is_analytic);
+  ADD_PROPERTY(PropertyInfo(Variant::BOOL, "analytic"), "set_analytic",
+               "is_analytic");
+
+  ClassDB::bind_method(D_METHOD("set_batched_mesh", "mesh"),
+                       &Projectile::set_batched_mesh);
+  ClassDB::bind_method(D_METHOD("get_batched_mesh"),
+                       &Projectile::get_batched_mesh);
+  ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "batched_mesh",
+                            godot::PROPERTY_HINT_RESOURCE_TYPE, "Mesh"),
+               "set_batched_mesh", "get_batched_mesh");
+
+  ClassDB::bind_method(D_METHOD("set_batched_scale", "scale"),
+                       &Projectile::set_batched_scale);
+  ClassDB::bind_method(D_METHOD("get_batched_scale"),
+                       &Projectile::get_batched_scale);
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "batched_scale"),
+               "set_batched_scale", "get_batched_scale");
+}
+
+void Projectile::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  sim_position = get_global_position();
+  if (batched_mesh.is_valid()) {
+    _attach_renderer();
+    return;
+  }
+
+  TransformWriteback* writeback = TransformWriteback::ensure_singleton(this);
+  if (writeback != nullptr) {
+    writeback_slot = writeback->acquire_slot(this);
+  }
+}
+
+void Projectile::_exit_tree() {
+  ProjectileScheduler* scheduler = ProjectileScheduler::get_singleton();
+  if (scheduler != nullptr) {
+    scheduler->cancel(flight_slot, this);
+  }
+  flight_slot = ProjectileScheduler::INVALID_SLOT;
+
+  TransformWriteback* writeback = TransformWriteback::get_singleton();
+  if (writeback != nullptr) {
+    writeback->release_slot(writeback_slot, this);
+  }
+  writeback_slot = TransformWriteback::INVALID_SLOT;
+
+  ProjectileRenderer* renderer = ProjectileRenderer::get_singleton();
+  if (renderer != nullptr) {
+    renderer->release(render_slot);
+  }
+  render_slot = ProjectileRenderer::INVALID_SLOT;
 }
 
 void Projectile::_physics_process(double delta) {
@@ -34,13 +97,22 @@ void Projectile::_physics_process(double delta) {
     return;
   }
 
-  if (target == nullptr || !target->is_inside_tree()) {
+  Vector3 target_pos;
+  if (target_proxy != ProxyMinionSystem::INVALID_HANDLE) {
+    ProxyMinionSystem* proxies = ProxyMinionSystem::get_singleton();
+    if (proxies == nullptr ||
+        !proxies->get_position(target_proxy, target_pos)) {
+      queue_free();
+      return;
+    }
+  } else if (target == nullptr || !target->is_inside_tree()) {
     queue_free();
     return;
+  } else {
+    target_pos = target->get_global_position();
   }
 
-  Vector3 current_pos = get_global_position();
-  Vector3 target_pos = target->get_global_position();
+  Vector3 current_pos = sim_position;
 
   // Recompute direction each frame (target might be moving)
   Vector3 to_target = target_pos - current_pos;
@@ -48,15 +120,7 @@ void Projectile::_physics_process(double delta) {
 
   // Check if we've arrived (close enough)
   if (distance_to_target <= hit_radius) {
-    // Apply damage via relay signal
-    if (attacker != nullptr) {
-      DBG_INFO("Projectile", "" + attacker->get_name() + "'s projectile hit " +
-                                 target->get_name() + " for " +
-                                 godot::String::num(damage) + " damage");
-    }
-    target->relay("take_damage", damage, attacker);
-
-    queue_free();
+    _hit_target();
     return;
   }
 
@@ -64,7 +128,7 @@ void Projectile::_physics_process(double delta) {
   if (distance_to_target > 0.001f) {
     direction = to_target / distance_to_target;
     Vector3 velocity = direction * speed;
-    set_global_position(current_pos + velocity * static_cast<float>(delta));
+    _write_position(current_pos + velocity * static_cast<float>(delta));
     travel_distance += speed * delta;
   }
 }
@@ -81,7 +145,7 @@ void Projectile::setup(Unit* attacker_unit,
   if (target != nullptr) {
     Vector3 start_pos = attacker_unit != nullptr
                             ? attacker_unit->get_global_position()
-                            : get_global_position();
+                            : sim_position;
     Vector3 target_pos = target_unit->get_global_position();
     Vector3 to_target = target_pos - start_pos;
     float distance = to_target.length();
@@ -90,6 +154,99 @@ void Projectile::setup(Unit* attacker_unit,
       direction = to_target / distance;
     }
   }
+
+  ProjectileRenderer* renderer = ProjectileRenderer::get_singleton();
+  if (renderer != nullptr) {
+    renderer->teleport(render_slot, sim_position, direction);
+  }
+
+  if (!analytic || target == nullptr) {
+    return;
+  }
+
+  // Hand the flight to the scheduler; if the target can't be intercepted
+  // (it outruns the projectile) keep homing per tick
+  ProjectileScheduler* scheduler = ProjectileScheduler::ensure_singleton(this);
+  if (scheduler != nullptr) {
+    flight_slot =
+        scheduler->schedule(this, target, sim_position, speed, hit_radius);
+  }
+  set_physics_process(flight_slot == ProjectileScheduler::INVALID_SLOT);
+}
+
+void Projectile::setup_proxy(Unit* attacker_unit,
+                             int64_t proxy,
+                             float damage_amount,
+                             float travel_speed) {
+  attacker = attacker_unit;
+  target = nullptr;
+  target_proxy = proxy;
+  damage = damage_amount;
+  speed = travel_speed;
+
+  // The scheduler only tracks Units, so proxies are homed on every tick
+  set_physics_process(true);
+}
+
+void Projectile::advance_flight(const Vector3& position) {
+  _write_position(position);
+}
+
+void Projectile::land_flight() {
+  flight_slot = ProjectileScheduler::INVALID_SLOT;
+  if (target == nullptr || !target->is_inside_tree()) {
+    queue_free();
+    return;
+  }
+
+  _hit_target();
+}
+
+void Projectile::resume_homing(const Vector3& position) {
+  flight_slot = ProjectileScheduler::INVALID_SLOT;
+  _write_position(position);
+  set_physics_process(true);
+}
+
+void Projectile::_hit_target() {
+  if (target_proxy != ProxyMinionSystem::INVALID_HANDLE) {
+    ProxyMinionSystem* proxies = ProxyMinionSystem::get_singleton();
+    if (proxies != nullptr) {
+      proxies->submit_damage(target_proxy, damage, DamageType::PHYSICAL);
+    }
+    queue_free();
+    return;
+  }
+
+  // Queue damage for this tick's damage phase
+  if (attacker != nullptr) {
+    DBG_INFO("Projectile", "" + attacker->get_name() + "'s projectile hit " +
+                               target->get_name() + " for " +
+                               godot::String::num(damage) + " damage");
+  }
+  DamageQueue::submit(target, damage, DamageType::PHYSICAL, attacker);
+
+  queue_free();
+}
+
+void Projectile::_write_position(const Vector3& position) {
+  sim_position = position;
+
+  if (render_slot != ProjectileRenderer::INVALID_SLOT) {
+    ProjectileRenderer* renderer = ProjectileRenderer::get_singleton();
+    if (renderer != nullptr) {
+      renderer->write_position(render_slot, position);
+    }
+    return;
+  }
+
+  TransformWriteback* writeback = TransformWriteback::get_singleton();
+  if (writeback != nullptr &&
+      writeback_slot != TransformWriteback::INVALID_SLOT) {
+    writeback->write_position(writeback_slot, position);
+  } else {
+    set_global_position(position);
+  }
 }
 
 void Projectile::set_hit_radius(float radius) {
@@ -99,3 +256,49 @@ void Projectile::set_hit_radius(float radius) {
 float Projectile::get_hit_radius() const {
   return hit_radius;
 }
+
+void Projectile::set_analytic(bool enabled) {
+  analytic = enabled;
+}
+
+bool Projectile::is_analytic() const {
+  return analytic;
+}
+
+void Projectile::_attach_renderer() {
+  if (batched_mesh.is_null() || !is_inside_tree() ||
+      render_slot != ProjectileRenderer::INVALID_SLOT) {
+    return;
+  }
+
+  ProjectileRenderer* renderer = ProjectileRenderer::ensure_singleton(this);
+  if (renderer == nullptr) {
+    return;
+  }
+  render_slot =
+      renderer->acquire(batched_mesh, sim_position, direction, batched_scale);
+
+  // The node no longer moves, so its transform slot would only cost writes
+  TransformWriteback* writeback = TransformWriteback::get_singleton();
+  if (writeback != nullptr) {
+    writeback->release_slot(writeback_slot, this);
+  }
+  writeback_slot = TransformWriteback::INVALID_SLOT;
+}
+
+void Projectile::set_batched_mesh(const Ref<Mesh>& mesh) {
+  batched_mesh = mesh;
+  _attach_renderer();
+}
+
+Ref<Mesh> Projectile::get_batched_mesh() const {
+  return batched_mesh;
+}
+
+void Projectile::set_batched_scale(float scale) {
+  batched_scale = std::max(0.001f, scale);
+}
+
+float Projectile::get_batched_scale() const {
+  return batched_scale;
+}
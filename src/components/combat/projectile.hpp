@@ -1,10 +1,13 @@
 #ifndef GDEXTENSION_PROJECTILE_H
 #define GDEXTENSION_PROJECTILE_H
 
+#include <godot_cpp/classes/mesh.hpp>
 #include <godot_cpp/classes/node3d.hpp>
 #include <godot_cpp/variant/vector3.hpp>
 
+using godot::Mesh;
 using godot::Node3D;
+using godot::Ref;
 using godot::Vector3;
 
 class Unit;
@@ -17,10 +20,33 @@ class Projectile : public Node3D {
 
   Unit* attacker = nullptr;
   Unit* target = nullptr;
+  int64_t target_proxy = -1;  // ProxyMinionSystem handle; -1 = unit target
   float damage = 0.0f;
   float speed = 20.0f;
   float hit_radius = 0.5f;  // "Close enough" distance
 
+  // Simulated position; the node transform is updated through the
+  // TransformWriteback stage at the end of the tick
+  Vector3 sim_position = Vector3(0, 0, 0);
+  int32_t writeback_slot = -1;
+
+  void _write_position(const Vector3& position);
+
+  // Batched drawing - with a batched_mesh the flight is drawn by the
+  // ProjectileRenderer and the node itself stays where it was spawned
+  Ref<Mesh> batched_mesh;
+  float batched_scale = 1.0f;
+  int32_t render_slot = -1;
+
+  void _attach_renderer();
+
+  // Analytic mode - the hit is solved when fired and landed by the
+  // ProjectileScheduler on the matching tick instead of homing every tick
+  bool analytic = true;
+  int32_t flight_slot = -1;
+
+  void _hit_target();
+
   Vector3 direction = Vector3(0, 0, 0);
   double travel_distance = 0.0;
 
@@ -28,6 +54,8 @@ class Projectile : public Node3D {
   Projectile();
   ~Projectile();
 
+  void _ready() override;
+  void _exit_tree() override;
   void _physics_process(double delta) override;
 
   // Setup projectile with attacker, target, damage, and speed
@@ -36,8 +64,28 @@ class Projectile : public Node3D {
              float damage_amount,
              float travel_speed);
 
+  // Home on a proxy minion instead (always per tick, never analytic)
+  void setup_proxy(Unit* attacker_unit,
+                   int64_t proxy,
+                   float damage_amount,
+                   float travel_speed);
+
   void set_hit_radius(float radius);
   float get_hit_radius() const;
+
+  void set_analytic(bool enabled);
+  bool is_analytic() const;
+
+  void set_batched_mesh(const Ref<Mesh>& mesh);
+  Ref<Mesh> get_batched_mesh() const;
+
+  void set_batched_scale(float scale);
+  float get_batched_scale() const;
+
+  // ProjectileScheduler callbacks
+  void advance_flight(const Vector3& position);
+  void land_flight();
+  void resume_homing(const Vector3& position);
 };
 
 #endif  // GDEXTENSION_PROJECTILE_H
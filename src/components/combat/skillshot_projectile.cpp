@@ -5,11 +5,17 @@
 #include <godot_cpp/core/property_info.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <godot_cpp/variant/variant.hpp>
-#include <vector>
 
+#include "../../common/allegiance.hpp"
 #include "../../core/unit.hpp"
 #include "../../debug/debug_macros.hpp"
 #include "../../debug/visual_debugger.hpp"
+#include "../../systems/damage_queue.hpp"
+#include "../../systems/proxy_minion_system.hpp"
+#include "../../systems/transform_writeback.hpp"
+#include "../../systems/unit_query.hpp"
+#include "../../visual/projectiles/projectile_renderer.hpp"
+#include "../abilities/ability_api.hpp"
 
 #include "../health/health_component.hpp"
 
@@ -55,6 +61,58 @@ void SkillshotProjectile::_bind_methods() {
                        &SkillshotProjectile::get_hit_radius);
   ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "hit_radius"), "set_hit_radius",
                "get_hit_radius");
+
+  ClassDB::bind_method(D_METHOD("set_batched_mesh", "mesh"),
+                       &SkillshotProjectile::set_batched_mesh);
+  ClassDB::bind_method(D_METHOD("get_batched_mesh"),
+                       &SkillshotProjectile::get_batched_mesh);
+  ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "batched_mesh",
+                            godot::PROPERTY_HINT_RESOURCE_TYPE, "Mesh"),
+               "set_batched_mesh", "get_batched_mesh");
+
+  ClassDB::bind_method(D_METHOD("set_batched_scale", "scale"),
+                       &SkillshotProjectile::set_batched_scale);
+  ClassDB::bind_method(D_METHOD("get_batched_scale"),
+                       &SkillshotProjectile::get_batched_scale);
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "batched_scale"),
+               "set_batched_scale", "get_batched_scale");
+}
+
+void SkillshotProjectile::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  sim_position = get_global_position();
+  if (batched_mesh.is_valid()) {
+    _attach_renderer();
+    return;
+  }
+
+  TransformWriteback* writeback = TransformWriteback::ensure_singleton(this);
+  if (writeback != nullptr) {
+    writeback_slot = writeback->acquire_slot(this);
+  }
+}
+
+void SkillshotProjectile::_exit_tree() {
+  TransformWriteback* writeback = TransformWriteback::get_singleton();
+  if (writeback != nullptr) {
+    writeback->release_slot(writeback_slot, this);
+  }
+  writeback_slot = TransformWriteback::INVALID_SLOT;
+
+  ProjectileRenderer* renderer = ProjectileRenderer::get_singleton();
+  if (renderer != nullptr) {
+    renderer->release(render_slot);
+  }
+  render_slot = ProjectileRenderer::INVALID_SLOT;
+
+  VisualDebugger* debugger = VisualDebugger::get_singleton();
+  if (debugger != nullptr) {
+    debugger->remove_primitive(debug_radius_handle);
+  }
+  debug_radius_handle = VisualDebugger::INVALID_HANDLE;
 }
 
 void SkillshotProjectile::_physics_process(double delta) {
@@ -68,20 +126,23 @@ void SkillshotProjectile::_physics_process(double delta) {
   }
 
   // Move projectile in its direction
-  Vector3 current_pos = get_global_position();
+  Vector3 current_pos = sim_position;
   Vector3 velocity = direction * speed;
-  set_global_position(current_pos + velocity * static_cast<float>(delta));
+  _write_position(current_pos + velocity * static_cast<float>(delta));
   travel_distance += speed * delta;
 
-  Vector3 new_pos = get_global_position();
+  Vector3 new_pos = sim_position;
 
-  // Debug visualization: Draw projectile collision radius
+  // Debug visualization: collision radius follows the projectile (yellow)
   VisualDebugger* debugger = VisualDebugger::get_singleton();
-  if (debugger != nullptr && debugger->is_debug_enabled()) {
-    // Draw collision radius at projectile position (yellow circle with
-    // thickness)
-    debugger->draw_circle_xz(new_pos, hit_radius, godot::Color(1, 1, 0, 1), 16,
-                             1.0f);
+  if (debugger != nullptr) {
+    if (debug_radius_handle == VisualDebugger::INVALID_HANDLE) {
+      debug_radius_handle = debugger->add_circle_xz(
+          new_pos, hit_radius, godot::Color(1, 1, 0, 1),
+          VisualDebugger::LIFETIME_PERSISTENT, DebugCategory::PROJECTILES, 16);
+    } else {
+      debugger->set_primitive_position(debug_radius_handle, new_pos);
+    }
   }
 
   // Check if we've exceeded max distance
@@ -93,51 +154,31 @@ void SkillshotProjectile::_physics_process(double delta) {
   }
 
   // Check for collision with units
-  // Simple sphere-cast style detection
-  Node* start = caster->get_parent();
-  if (start == nullptr) {
+  // Simple sphere-cast style detection; any unit but the caster stops it
+  Unit* hit_target = nullptr;
+  if (UnitQuery::sphere(current_pos, hit_radius, caster, Allegiance::OTHERS,
+                        &hit_target, 1) > 0) {
+    DBG_INFO("SkillshotProjectile", "Hit unit: " + hit_target->get_name());
+    _detonate(hit_target);
     return;
   }
 
-  std::vector<Node*> to_process;
-  to_process.push_back(start);
-
-  bool hit_unit = false;
-  Unit* hit_target = nullptr;
-  while (!to_process.empty() && !hit_unit) {
-    Node* current = to_process.back();
-    to_process.pop_back();
-
-    if (current == nullptr) {
-      continue;
-    }
-
-    Unit* unit = Object::cast_to<Unit>(current);
-    if (unit != nullptr && unit != caster && unit->is_inside_tree()) {
-      float distance = current_pos.distance_to(unit->get_global_position());
-      if (distance <= hit_radius) {
-        DBG_INFO("SkillshotProjectile", "Hit unit: " + unit->get_name());
-        hit_unit = true;
-        hit_target = unit;
-        _detonate(hit_target);
-        break;
-      }
-    }
-
-    // Add children to process queue
-    for (int i = 0; i < current->get_child_count(); i++) {
-      to_process.push_back(current->get_child(i));
-    }
+  // Proxy minions stop it the same way
+  int64_t hit_proxy = AbilityAPI::find_nearest_proxy(
+      current_pos, hit_radius, caster, Allegiance::OTHERS);
+  if (hit_proxy != ProxyMinionSystem::INVALID_HANDLE) {
+    DBG_INFO("SkillshotProjectile", "Hit proxy minion");
+    _detonate(nullptr, hit_proxy);
   }
 }
 
-void SkillshotProjectile::_detonate(Unit* hit_target) {
+void SkillshotProjectile::_detonate(Unit* hit_target, int64_t hit_proxy) {
   if (caster == nullptr || !caster->is_inside_tree()) {
     queue_free();
     return;
   }
 
-  Vector3 explosion_center = get_global_position();
+  Vector3 explosion_center = sim_position;
 
   // Call detonation callback if set (indicates explosion effect)
   bool has_explosion = (on_detonated != nullptr);
@@ -151,11 +192,16 @@ void SkillshotProjectile::_detonate(Unit* hit_target) {
              "Detonating at (" + godot::String::num(explosion_center.x) + ", " +
                  godot::String::num(explosion_center.z) + ")");
 
-    hit_target->relay("take_damage", damage, caster);
+    DamageQueue::submit(hit_target, damage, DamageType::MAGICAL, caster);
     DBG_INFO("SkillshotProjectile", "Hit " + hit_target->get_name() + " for " +
                                         godot::String::num(damage) + " damage");
 
     DBG_INFO("SkillshotProjectile", "Total hits: 1");
+  } else if (hit_proxy != ProxyMinionSystem::INVALID_HANDLE) {
+    float dealt =
+        AbilityAPI::apply_proxy_damage(hit_proxy, damage, DamageType::MAGICAL);
+    DBG_INFO("SkillshotProjectile", "Hit proxy minion for " +
+                                        godot::String::num(dealt) + " damage");
   } else {
     // No specific target - search for units in AoE radius
     _find_and_damage_units();
@@ -164,10 +210,12 @@ void SkillshotProjectile::_detonate(Unit* hit_target) {
   // Draw AoE visualization only if there's an explosion effect
   if (has_explosion) {
     VisualDebugger* debugger = VisualDebugger::get_singleton();
-    if (debugger != nullptr && debugger->is_debug_enabled()) {
-      // Draw AoE explosion radius at detonation point (orange for visibility)
-      debugger->draw_circle_xz(explosion_center, aoe_radius,
-                               godot::Color(1, 0.5f, 0, 1), 32, 1.0f, false);
+    if (debugger != nullptr) {
+      // AoE explosion radius at detonation point (orange), kept for a second
+      // so it's actually readable
+      debugger->add_circle_xz(explosion_center, aoe_radius,
+                              godot::Color(1, 0.5f, 0, 1), 1.0f,
+                              DebugCategory::PROJECTILES);
     }
   }
 
@@ -179,45 +227,13 @@ void SkillshotProjectile::_find_and_damage_units() {
     return;
   }
 
-  Node* start = caster->get_parent();
-  if (start == nullptr) {
-    return;
-  }
-
-  Vector3 explosion_center = get_global_position();
-  std::vector<Unit*> affected_units;
-  std::vector<Node*> to_process;
-  to_process.push_back(start);
-
-  // Find all units in explosion radius
-  while (!to_process.empty()) {
-    Node* current = to_process.back();
-    to_process.pop_back();
-
-    if (current == nullptr) {
-      continue;
-    }
-
-    Unit* unit = Object::cast_to<Unit>(current);
-    if (unit != nullptr && unit != caster && unit->is_inside_tree()) {
-      float distance =
-          explosion_center.distance_to(unit->get_global_position());
-      if (distance <= aoe_radius) {
-        affected_units.push_back(unit);
-      }
-    }
+  // Every unit but the caster, queued for this tick's damage phase
+  UnitSpan hit_units = AbilityAPI::apply_aoe_damage(
+      sim_position, aoe_radius, damage, caster, Allegiance::OTHERS,
+      DamageType::MAGICAL);
 
-    // Add children to process queue
-    for (int i = 0; i < current->get_child_count(); i++) {
-      to_process.push_back(current->get_child(i));
-    }
-  }
-
-  // Apply damage to all units
-  int hit_count = 0;
-  for (Unit* unit : affected_units) {
-    unit->relay("take_damage", damage, caster);
-    hit_count++;
+  int hit_count = hit_units.size();
+  for (Unit* unit : hit_units) {
     DBG_INFO("SkillshotProjectile", "Hit " + unit->get_name() + " for " +
                                         godot::String::num(damage) + " damage");
   }
@@ -248,9 +264,17 @@ void SkillshotProjectile::setup(Unit* caster_unit,
     direction = Vector3(0, 0, -1);  // Default forward
   }
 
-  // Start position at caster
+  // Start position at caster (placed directly so attached VFX start there)
+  // This is a teleport, so don't interpolate from the spawn origin
   if (caster_unit != nullptr) {
-    set_global_position(caster_unit->get_global_position());
+    sim_position = caster_unit->get_global_position();
+    set_global_position(sim_position);
+    reset_physics_interpolation();
+  }
+
+  ProjectileRenderer* renderer = ProjectileRenderer::get_singleton();
+  if (renderer != nullptr) {
+    renderer->teleport(render_slot, sim_position, direction);
   }
 
   DBG_INFO("SkillshotProjectile",
@@ -260,6 +284,26 @@ void SkillshotProjectile::setup(Unit* caster_unit,
                ", aoe_radius=" + godot::String::num(aoe_radius));
 }
 
+void SkillshotProjectile::_write_position(const Vector3& position) {
+  sim_position = position;
+
+  if (render_slot != ProjectileRenderer::INVALID_SLOT) {
+    ProjectileRenderer* renderer = ProjectileRenderer::get_singleton();
+    if (renderer != nullptr) {
+      renderer->write_position(render_slot, position);
+    }
+    return;
+  }
+
+  TransformWriteback* writeback = TransformWriteback::get_singleton();
+  if (writeback != nullptr &&
+      writeback_slot != TransformWriteback::INVALID_SLOT) {
+    writeback->write_position(writeback_slot, position);
+  } else {
+    set_global_position(position);
+  }
+}
+
 void SkillshotProjectile::set_speed(float s) {
   speed = std::max(0.0f, s);
 }
@@ -291,3 +335,41 @@ void SkillshotProjectile::set_hit_radius(float radius) {
 float SkillshotProjectile::get_hit_radius() const {
   return hit_radius;
 }
+
+void SkillshotProjectile::_attach_renderer() {
+  if (batched_mesh.is_null() || !is_inside_tree() ||
+      render_slot != ProjectileRenderer::INVALID_SLOT) {
+    return;
+  }
+
+  ProjectileRenderer* renderer = ProjectileRenderer::ensure_singleton(this);
+  if (renderer == nullptr) {
+    return;
+  }
+  render_slot =
+      renderer->acquire(batched_mesh, sim_position, direction, batched_scale);
+
+  // The node no longer moves, so its transform slot would only cost writes
+  TransformWriteback* writeback = TransformWriteback::get_singleton();
+  if (writeback != nullptr) {
+    writeback->release_slot(writeback_slot, this);
+  }
+  writeback_slot = TransformWriteback::INVALID_SLOT;
+}
+
+void SkillshotProjectile::set_batched_mesh(const Ref<Mesh>& mesh) {
+  batched_mesh = mesh;
+  _attach_renderer();
+}
+
+Ref<Mesh> SkillshotProjectile::get_batched_mesh() const {
+  return batched_mesh;
+}
+
+void SkillshotProjectile::set_batched_scale(float scale) {
+  batched_scale = std::max(0.001f, scale);
+}
+
+float SkillshotProjectile::get_batched_scale() const {
+  return batched_scale;
+}
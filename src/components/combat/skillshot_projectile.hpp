@@ -2,10 +2,13 @@
 #define GDEXTENSION_SKILLSHOT_PROJECTILE_H
 
 #include <functional>
+#include <godot_cpp/classes/mesh.hpp>
 #include <godot_cpp/classes/node3d.hpp>
 #include <godot_cpp/variant/vector3.hpp>
 
+using godot::Mesh;
 using godot::Node3D;
+using godot::Ref;
 using godot::Vector3;
 
 class Unit;
@@ -33,12 +36,31 @@ class SkillshotProjectile : public Node3D {
   float aoe_radius = 5.0f;       // Explosion radius
   float travel_distance = 0.0f;  // Distance traveled so far
 
+  // Simulated position; the node transform is updated through the
+  // TransformWriteback stage at the end of the tick
+  Vector3 sim_position = Vector3(0, 0, 0);
+  int32_t writeback_slot = -1;
+
+  void _write_position(const Vector3& position);
+
+  // Batched drawing - with a batched_mesh the flight is drawn by the
+  // ProjectileRenderer and the node itself stays where it was spawned
+  Ref<Mesh> batched_mesh;
+  float batched_scale = 1.0f;
+  int32_t render_slot = -1;
+
+  void _attach_renderer();
+
+  // Persistent VisualDebugger circle following the projectile
+  int32_t debug_radius_handle = -1;
+
   Vector3 direction = Vector3(0, 0, -1);  // Direction of travel
 
   // Called when projectile hits something
-  // If hit_target is provided, only damage that unit (single-target hit)
+  // If hit_target or hit_proxy (a ProxyMinionSystem handle) is provided,
+  // only damage that one (single-target hit)
   // Otherwise, find all units in aoe_radius and damage them
-  void _detonate(Unit* hit_target = nullptr);
+  void _detonate(Unit* hit_target = nullptr, int64_t hit_proxy = -1);
 
   // Find all units hit by explosion
   void _find_and_damage_units();
@@ -52,6 +74,8 @@ class SkillshotProjectile : public Node3D {
   SkillshotProjectile();
   ~SkillshotProjectile();
 
+  void _ready() override;
+  void _exit_tree() override;
   void _physics_process(double delta) override;
 
   /// Setup projectile with caster, direction, and projectile parameters
@@ -76,6 +100,12 @@ class SkillshotProjectile : public Node3D {
 
   void set_hit_radius(float radius);
   float get_hit_radius() const;
+
+  void set_batched_mesh(const Ref<Mesh>& mesh);
+  Ref<Mesh> get_batched_mesh() const;
+
+  void set_batched_scale(float scale);
+  float get_batched_scale() const;
 };
 
 #endif  // GDEXTENSION_SKILLSHOT_PROJECTILE_H
@@ -1,7 +1,6 @@
 #include "health_component.hpp"
 
 #include <algorithm>
-#include <godot_cpp/classes/collision_shape3d.hpp>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/core/property_info.hpp>
@@ -14,6 +13,7 @@
 #include "../../common/unit_signals.hpp"
 #include "../../core/unit.hpp"
 #include "../../debug/debug_macros.hpp"
+#include "../../systems/unit_index.hpp"
 #include "../ui/label_registry.hpp"
 
 using godot::Callable;
@@ -37,6 +37,21 @@ void HealthComponent::_bind_methods() {
   ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "max_health"), "set_max_health",
                "get_max_health");
 
+  ClassDB::bind_method(D_METHOD("get_effective_max_health"),
+                       &HealthComponent::get_effective_max_health);
+
+  ClassDB::bind_method(D_METHOD("set_armor", "value"),
+                       &HealthComponent::set_armor);
+  ClassDB::bind_method(D_METHOD("get_armor"), &HealthComponent::get_armor);
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "armor"), "set_armor", "get_armor");
+
+  ClassDB::bind_method(D_METHOD("set_magic_resist", "value"),
+                       &HealthComponent::set_magic_resist);
+  ClassDB::bind_method(D_METHOD("get_magic_resist"),
+                       &HealthComponent::get_magic_resist);
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "magic_resist"),
+               "set_magic_resist", "get_magic_resist");
+
   ClassDB::bind_method(D_METHOD("set_current_health", "value"),
                        &HealthComponent::set_current_health);
   ClassDB::bind_method(D_METHOD("get_current_health"),
@@ -52,6 +67,8 @@ void HealthComponent::_bind_methods() {
   // Signal handler for take_damage relay
   ClassDB::bind_method(D_METHOD("_on_take_damage", "damage", "source"),
                        &HealthComponent::_on_take_damage);
+  ClassDB::bind_method(D_METHOD("_on_stat_changed", "stat"),
+                       &HealthComponent::_on_stat_changed);
 
   ADD_SIGNAL(godot::MethodInfo("health_changed",
                                PropertyInfo(Variant::FLOAT, "current"),
@@ -78,13 +95,33 @@ void HealthComponent::_ready() {
   // Connect to Unit's take_damage signal
   owner->connect(take_damage,
                  godot::Callable(this, godot::StringName("_on_take_damage")));
+
+  // Max health is a stat; follow modifier changes
+  _set_base_stat(Stat::MAX_HEALTH, max_health);
+  _set_base_stat(Stat::ARMOR, armor);
+  _set_base_stat(Stat::MAGIC_RESIST, magic_resist);
+  applied_max_health = get_effective_max_health();
+  current_health = std::min(current_health, applied_max_health);
+  owner->register_signal(stat_changed);
+  owner->connect(stat_changed,
+                 godot::Callable(this, godot::StringName("_on_stat_changed")));
+
+  _publish_health();
 }
 
 void HealthComponent::set_max_health(float value) {
   max_health = std::max(0.0f, value);
+  if (owner_unit != nullptr) {
+    // Rescaling and notification happen in _on_stat_changed
+    _set_base_stat(Stat::MAX_HEALTH, max_health);
+    return;
+  }
+
   if (current_health > max_health) {
     current_health = max_health;
   }
+  applied_max_health = max_health;
+  _publish_health();
   emit_signal("health_changed", current_health, max_health);
 }
 
@@ -92,14 +129,39 @@ float HealthComponent::get_max_health() const {
   return max_health;
 }
 
+float HealthComponent::get_effective_max_health() const {
+  return _get_stat(Stat::MAX_HEALTH, max_health);
+}
+
+void HealthComponent::set_armor(float value) {
+  armor = std::max(0.0f, value);
+  _set_base_stat(Stat::ARMOR, armor);
+}
+
+float HealthComponent::get_armor() const {
+  return armor;
+}
+
+void HealthComponent::set_magic_resist(float value) {
+  magic_resist = std::max(0.0f, value);
+  _set_base_stat(Stat::MAGIC_RESIST, magic_resist);
+}
+
+float HealthComponent::get_magic_resist() const {
+  return magic_resist;
+}
+
 void HealthComponent::set_current_health(float value) {
-  current_health = std::clamp(value, 0.0f, max_health);
-  emit_signal("health_changed", current_health, max_health);
+  float effective_max = get_effective_max_health();
+  current_health = std::clamp(value, 0.0f, effective_max);
+  _publish_health();
+  emit_signal("health_changed", current_health, effective_max);
 
   if (current_health <= 0.0f) {
-    is_dead_flag = true;
-    _disable_collision();
-    emit_signal("died", nullptr);
+    _die(nullptr);
+  } else {
+    // Revived (see ReviveComponent)
+    is_dead_flag = false;
   }
 }
 
@@ -112,8 +174,10 @@ bool HealthComponent::apply_damage(float amount, godot::Object* source) {
     amount = 0.0f;
   }
 
+  float effective_max = get_effective_max_health();
   current_health = std::max(0.0f, current_health - amount);
-  emit_signal("health_changed", current_health, max_health);
+  _publish_health();
+  emit_signal("health_changed", current_health, effective_max);
 
   // Log damage
   if (owner_unit != nullptr) {
@@ -121,12 +185,12 @@ bool HealthComponent::apply_damage(float amount, godot::Object* source) {
              "" + owner_unit->get_name() + " took " +
                  godot::String::num(amount) +
                  " damage. HP: " + godot::String::num(current_health) + "/" +
-                 godot::String::num(max_health));
+                 godot::String::num(effective_max));
   } else {
     DBG_INFO("HealthComponent",
              "Took " + godot::String::num(amount) +
                  " damage. HP: " + godot::String::num(current_health) + "/" +
-                 godot::String::num(max_health));
+                 godot::String::num(effective_max));
   }
 
   if (current_health <= 0.0f) {
@@ -136,9 +200,7 @@ bool HealthComponent::apply_damage(float amount, godot::Object* source) {
       DBG_INFO("HealthComponent", "Unit died!");
     }
 
-    is_dead_flag = true;
-    _disable_collision();
-    emit_signal("died", source);
+    _die(source);
     return true;  // Unit died
   }
 
@@ -150,35 +212,46 @@ void HealthComponent::heal(float amount) {
     amount = 0.0f;
   }
 
-  current_health = std::min(max_health, current_health + amount);
-  emit_signal("health_changed", current_health, max_health);
+  float effective_max = get_effective_max_health();
+  current_health = std::min(effective_max, current_health + amount);
+  _publish_health();
+  emit_signal("health_changed", current_health, effective_max);
 }
 
 bool HealthComponent::is_dead() const {
   return current_health <= 0.0f;
 }
 
-void HealthComponent::_disable_collision() {
-  if (owner_unit == nullptr || !owner_unit->is_inside_tree()) {
-    return;
-  }
+void HealthComponent::_die(godot::Object* source) {
+  is_dead_flag = true;
 
-  // Find and disable all CollisionShape3D children of the owner
-  for (int i = 0; i < owner_unit->get_child_count(); i++) {
-    godot::Node* child = owner_unit->get_child(i);
-    godot::CollisionShape3D* collision =
-        godot::Object::cast_to<godot::CollisionShape3D>(child);
-    if (collision != nullptr) {
-      collision->set_disabled(true);
-    }
+  // Components suspend themselves and collision goes off with the lifecycle
+  // change; a ReviveComponent listening to "died" then moves it to REVIVING
+  if (owner_unit != nullptr) {
+    owner_unit->set_lifecycle(UnitLifecycle::DEAD);
   }
+  emit_signal("died", source);
+}
+
+void HealthComponent::_publish_health() {
+  // Pooled units sit at full health but must not be targetable
+  bool alive = current_health > 0.0f &&
+               (owner_unit == nullptr ||
+                owner_unit->get_lifecycle() != UnitLifecycle::POOLED);
+  UnitIndex::update_health(owner_unit, current_health, alive);
+}
 
-  // Also disable the CharacterBody3D collision layers
-  owner_unit->set_collision_layer(0);
-  owner_unit->set_collision_mask(0);
+void HealthComponent::_on_lifecycle_changed(UnitLifecycle state) {
+  UnitComponent::_on_lifecycle_changed(state);
 
-  DBG_INFO("HealthComponent",
-           "Disabled collision for " + owner_unit->get_name());
+  // Parked for reuse: refill now, so a spawn only flips the lifecycle
+  if (state == UnitLifecycle::POOLED) {
+    float effective_max = get_effective_max_health();
+    current_health = effective_max;
+    is_dead_flag = false;
+    emit_signal("health_changed", current_health, effective_max);
+  }
+  _publish_health();
 }
 
 void HealthComponent::_on_take_damage(float damage, godot::Object* source) {
@@ -186,14 +259,30 @@ void HealthComponent::_on_take_damage(float damage, godot::Object* source) {
   apply_damage(damage, source);
 }
 
+void HealthComponent::_on_stat_changed(int stat) {
+  if (stat != static_cast<int>(Stat::MAX_HEALTH)) {
+    return;
+  }
+
+  // Keep the health percentage when max health changes (dead units stay at 0)
+  float effective_max = get_effective_max_health();
+  if (applied_max_health > 0.0f) {
+    current_health *= effective_max / applied_max_health;
+  }
+  current_health = std::min(current_health, effective_max);
+  applied_max_health = effective_max;
+
+  _publish_health();
+  emit_signal("health_changed", current_health, effective_max);
+}
+
 void HealthComponent::register_debug_labels(LabelRegistry* registry) {
   if (!registry) {
     return;
   }
 
-  registry->register_property("Health", "current",
-                              godot::String::num(current_health));
-  registry->register_property("Health", "max", godot::String::num(max_health));
+  registry->register_property("Health", "current", current_health);
+  registry->register_property("Health", "max", get_effective_max_health());
   registry->register_property("Health", "status",
                               is_dead_flag ? "DEAD" : "ALIVE");
 }
@@ -9,13 +9,22 @@ class HealthComponent : public UnitComponent {
  protected:
   static void _bind_methods();
 
-  float max_health = 100.0f;
+  float max_health = 100.0f;  // Base value; see get_effective_max_health()
   float current_health = 100.0f;
+  float applied_max_health = 100.0f;  // Effective max at the last update
+  float armor = 0.0f;                 // Base ARMOR stat
+  float magic_resist = 0.0f;          // Base MAGIC_RESIST stat
   bool is_dead_flag = false;
 
   // Signal handler for take_damage relay signal from Unit
   void _on_take_damage(float damage, godot::Object* source);
 
+  // Signal handler for stat_changed relay signal from Unit
+  void _on_stat_changed(int stat);
+
+  // Pooling refills health; every change republishes targetability
+  void _on_lifecycle_changed(UnitLifecycle state) override;
+
  public:
   HealthComponent();
   ~HealthComponent();
@@ -25,6 +34,16 @@ class HealthComponent : public UnitComponent {
   void set_max_health(float value);
   float get_max_health() const;
 
+  // Max health after StatBlock modifiers (items, buffs, auras)
+  float get_effective_max_health() const;
+
+  // Base resistances (DamageQueue mitigates with the StatBlock values)
+  void set_armor(float value);
+  float get_armor() const;
+
+  void set_magic_resist(float value);
+  float get_magic_resist() const;
+
   void set_current_health(float value);
   float get_current_health() const;
 
@@ -37,8 +56,11 @@ class HealthComponent : public UnitComponent {
   void register_debug_labels(LabelRegistry* registry) override;
 
  private:
-  // Disable collision shapes when unit dies
-  void _disable_collision();
+  // Mark dead, move the owner to UnitLifecycle::DEAD and emit "died"
+  void _die(godot::Object* source);
+
+  // Push current health to the UnitIndex (targeting, dead-unit filtering)
+  void _publish_health();
 };
 
 #endif  // GDEXTENSION_HEALTH_COMPONENT_H
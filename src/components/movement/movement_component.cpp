@@ -1,9 +1,11 @@
 #include "movement_component.hpp"
 
-#include <cmath>
+#include <godot_cpp/classes/camera3d.hpp>
 #include <godot_cpp/classes/character_body3d.hpp>
 #include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/navigation_server3d.hpp>
 #include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/classes/viewport.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/core/object.hpp>
 #include <godot_cpp/core/property_info.hpp>
@@ -13,22 +15,24 @@
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <godot_cpp/variant/vector3.hpp>
 
+#include "../../common/crowd_control.hpp"
 #include "../../common/unit_signals.hpp"
 #include "../../core/unit.hpp"
 #include "../../debug/debug_utils.hpp"
-#include "../health/health_component.hpp"
+#include "../../systems/transform_writeback.hpp"
 #include "../ui/label_registry.hpp"
+#include "movement_lod.hpp"
 
-using godot::Basis;
 using godot::Callable;
+using godot::Camera3D;
 using godot::CharacterBody3D;
 using godot::ClassDB;
 using godot::D_METHOD;
 using godot::Engine;
+using godot::NavigationServer3D;
 using godot::Node;
 using godot::PropertyInfo;
 using godot::StringName;
-using godot::Transform3D;
 using godot::Variant;
 using godot::Vector3;
 
@@ -58,10 +62,12 @@ void MovementComponent::_bind_methods() {
 
   ClassDB::bind_method(D_METHOD("is_at_destination"),
                        &MovementComponent::is_at_destination);
+  ClassDB::bind_method(D_METHOD("get_lod_update_interval"),
+                       &MovementComponent::get_lod_update_interval);
 
   // Bind signal callback methods
-  ClassDB::bind_method(D_METHOD("_on_owner_unit_died", "source"),
-                       &MovementComponent::_on_owner_unit_died);
+  ClassDB::bind_method(D_METHOD("_on_owner_lifecycle_changed", "state"),
+                       &MovementComponent::_on_owner_lifecycle_changed);
   ClassDB::bind_method(D_METHOD("_on_move_requested", "position"),
                        &MovementComponent::_on_move_requested);
   ClassDB::bind_method(D_METHOD("_on_attack_requested", "target", "position"),
@@ -78,9 +84,12 @@ void MovementComponent::_bind_methods() {
 }
 
 void MovementComponent::_ready() {
-  frame_count = 0;
   is_ready = false;
 
+  // Stagger LOD updates so units that spawn together don't all run their
+  // full update on the same tick
+  lod_ticks_until_update = static_cast<int32_t>(get_instance_id() % 4);
+
   Unit* owner = get_owner_unit();
   if (owner != nullptr) {
     // Register signals that this component uses
@@ -91,20 +100,15 @@ void MovementComponent::_ready() {
     owner->register_signal(chase_range_reached);
     owner->register_signal(stop_requested);
     owner->register_signal(interact_requested);
+    owner->register_signal(lifecycle_changed);
 
-    // Connect to health component death signal if it exists
-    // Iterate through siblings to find HealthComponent
-    for (int i = 0; i < owner->get_child_count(); ++i) {
-      Node* child = owner->get_child(i);
-      if (child == nullptr)
-        continue;
-      HealthComponent* health_comp = Object::cast_to<HealthComponent>(child);
-      if (health_comp != nullptr) {
-        health_comp->connect(StringName("died"),
-                             Callable(this, StringName("_on_owner_unit_died")));
-        break;
-      }
-    }
+    // speed is the base move speed; slows and buffs modify it in the StatBlock
+    owner->set_base_stat(Stat::MOVE_SPEED, speed);
+
+    // Dead units keep their movement component, suspended (see
+    // _on_owner_lifecycle_changed)
+    owner->connect(lifecycle_changed,
+                   Callable(this, StringName("_on_owner_lifecycle_changed")));
 
     // Connect to Unit's movement-related signals
     owner->connect(move_requested,
@@ -119,9 +123,22 @@ void MovementComponent::_ready() {
                    Callable(this, StringName("_on_stop_requested")));
     owner->connect(interact_requested,
                    Callable(this, StringName("_on_interact_requested")));
+
+    TransformWriteback* writeback = TransformWriteback::ensure_singleton(this);
+    if (writeback != nullptr) {
+      writeback_slot = writeback->acquire_slot(owner);
+    }
   }
 }
 
+void MovementComponent::_exit_tree() {
+  TransformWriteback* writeback = TransformWriteback::get_singleton();
+  if (writeback != nullptr) {
+    writeback->release_slot(writeback_slot, get_owner_unit());
+  }
+  writeback_slot = TransformWriteback::INVALID_SLOT;
+}
+
 void MovementComponent::_physics_process(double delta) {
   if (Engine::get_singleton()->is_editor_hint()) {
     return;
@@ -133,6 +150,18 @@ void MovementComponent::_physics_process(double delta) {
     return;
   }
 
+  // Stunned or knocked back: stand still (knockback displacement is applied
+  // by the StatusEffectSystem) but keep the current order so movement resumes
+  // as soon as the crowd control ends
+  Unit* unit = get_owner_unit();
+  if (unit != nullptr &&
+      (unit->get_cc_state() & CrowdControl::BLOCKS_MOVEMENT) != 0) {
+    body->set_velocity(Vector3(0, 0, 0));
+    lod_velocity = Vector3(0, 0, 0);
+    _request_full_update();
+    return;
+  }
+
   // Update desired location if actively chasing a target
   if (chase_target != nullptr && chase_target->is_inside_tree()) {
     Vector3 target_pos = chase_target->get_global_position();
@@ -165,6 +194,15 @@ void MovementComponent::_physics_process(double delta) {
     }
   }
 
+  // Movement LOD: between full updates, only step along the cached path
+  // segment. Chasing units always run at full rate so range checks and
+  // chase_range_reached stay tick-exact.
+  if (lod_ticks_until_update > 0 && chase_target == nullptr) {
+    lod_ticks_until_update--;
+    _interpolate_skipped_tick(body, delta);
+    return;
+  }
+
   // Get movement velocity from our logic
   Vector3 movement_velocity = process_movement(delta, desired_location);
 
@@ -182,10 +220,59 @@ void MovementComponent::_physics_process(double delta) {
 
   body->set_velocity(velocity);
   body->move_and_slide();
+
+  // Pick how many ticks may pass before the next full update
+  lod_velocity = movement_velocity;
+  lod_update_interval = 1;
+  if (chase_target == nullptr) {
+    godot::Viewport* viewport = get_viewport();
+    Camera3D* camera =
+        viewport != nullptr ? viewport->get_camera_3d() : nullptr;
+    lod_update_interval =
+        MovementLOD::get_update_interval(camera, body->get_global_position());
+  }
+  lod_ticks_until_update = lod_update_interval - 1;
+}
+
+void MovementComponent::_interpolate_skipped_tick(CharacterBody3D* body,
+                                                  double delta) {
+  // Idle units do no work at all on skipped ticks
+  if (lod_velocity.is_zero_approx()) {
+    return;
+  }
+
+  // Advance along the segment toward the path point chosen by the last full
+  // update, at the same speed the full update would have used. Navigation
+  // path segments are walkable, so no collision query is needed in between.
+  Vector3 current_position = body->get_global_position();
+  Vector3 to_waypoint = lod_next_path_position - current_position;
+  to_waypoint.y = 0.0f;
+
+  Vector3 step = lod_velocity * static_cast<float>(delta);
+  step.y = 0.0f;
+
+  if (step.length_squared() >= to_waypoint.length_squared()) {
+    // Reached the waypoint early - stop here and let the next tick pick the
+    // following path segment with a full update
+    body->set_global_position(current_position + to_waypoint);
+    lod_velocity = Vector3(0, 0, 0);
+    _request_full_update();
+    return;
+  }
+
+  body->set_global_position(current_position + step);
+}
+
+void MovementComponent::_request_full_update() {
+  lod_ticks_until_update = 0;
 }
 
 void MovementComponent::set_speed(float new_speed) {
   speed = new_speed;
+  Unit* owner = get_owner_unit();
+  if (owner != nullptr) {
+    owner->set_base_stat(Stat::MOVE_SPEED, speed);
+  }
 }
 
 float MovementComponent::get_speed() const {
@@ -209,14 +296,13 @@ Vector3 MovementComponent::process_movement(double delta,
   }
 
   // If owner unit is dead, don't move
-  // Death is handled via the "died" signal - when received, component queues
-  // itself for deletion
+  // Death is handled via the lifecycle_changed signal - processing is
+  // suspended until the unit is alive again
 
   // Ensure this component (which IS the NavigationAgent3D) is in tree before
   // using it
   // Also check if we've been queued for deletion
   if (!is_inside_tree()) {
-    frame_count = 0;
     return Vector3(0, 0, 0);
   }
 
@@ -225,10 +311,12 @@ Vector3 MovementComponent::process_movement(double delta,
     return Vector3(0, 0, 0);
   }
 
-  // Wait several frames after entering tree before using navigation
+  // Wait until the navigation map has synchronized at least once before
+  // querying paths (iteration 0 means it has not), independent of tick rate
   if (!is_ready) {
-    frame_count++;
-    if (frame_count < 3) {
+    godot::RID map = get_navigation_map();
+    if (!map.is_valid() ||
+        NavigationServer3D::get_singleton()->map_get_iteration_id(map) == 0) {
       return Vector3(0, 0, 0);
     }
     is_ready = true;
@@ -256,12 +344,14 @@ Vector3 MovementComponent::process_movement(double delta,
   float distance = displacement.length();
 
   Vector3 velocity = Vector3(0, 0, 0);
+  lod_next_path_position = next_position;
 
   // Calculate direction to target for rotation
   Vector3 direction = Vector3(0, 0, 0);
   if (distance > 0.001f) {
     direction = displacement / distance;
-    velocity = direction * speed;
+    // Cached final speed (base speed with slows/buffs applied)
+    velocity = direction * owner->get_stats().get(Stat::MOVE_SPEED);
     // Update last facing direction when moving
     last_facing_direction = direction;
   } else if (distance >= 0.0f) {
@@ -301,20 +391,20 @@ void MovementComponent::_face_horizontal_direction(const Vector3& direction) {
     return;
   }
 
-  float target_angle =
-      std::atan2(-horizontal_direction.x, -horizontal_direction.z);
-
-  float cos_a = std::cos(target_angle);
-  float sin_a = std::sin(target_angle);
-  Vector3 new_forward = Vector3(-sin_a, 0, -cos_a);
-  Vector3 new_right = Vector3(cos_a, 0, -sin_a);
-  Vector3 new_up = Vector3(0, 1, 0);
+  // Unchanged facing produces no scene work at all
+  if (horizontal_direction.dot(applied_facing_direction) >=
+      TransformWriteback::FACING_DOT_THRESHOLD) {
+    return;
+  }
+  applied_facing_direction = horizontal_direction;
 
-  Basis new_basis = Basis();
-  new_basis.set_column(0, new_right);
-  new_basis.set_column(1, new_up);
-  new_basis.set_column(2, -new_forward);
-  owner->set_transform(Transform3D(new_basis, owner->get_transform().origin));
+  TransformWriteback* writeback = TransformWriteback::get_singleton();
+  if (writeback != nullptr &&
+      writeback_slot != TransformWriteback::INVALID_SLOT) {
+    writeback->write_facing(writeback_slot, horizontal_direction);
+  } else {
+    TransformWriteback::apply_facing(owner, horizontal_direction);
+  }
 }
 
 void MovementComponent::set_desired_location(const Vector3& location) {
@@ -325,12 +415,31 @@ Vector3 MovementComponent::get_desired_location() const {
   return desired_location;
 }
 
+bool MovementComponent::is_idle() const {
+  // Navigation not synchronized yet: the first order hasn't been walked
+  if (!is_ready || chase_target != nullptr ||
+      !lod_velocity.is_zero_approx()) {
+    return false;
+  }
+
+  CharacterBody3D* body = Object::cast_to<CharacterBody3D>(get_parent());
+  if (body != nullptr && !body->is_on_floor()) {
+    return false;
+  }
+
+  return is_stopped || is_at_destination();
+}
+
 bool MovementComponent::is_at_destination() const {
   // Cast away const since is_navigation_finished() isn't const but we just
   // query state
   return const_cast<MovementComponent*>(this)->is_navigation_finished();
 }
 
+int32_t MovementComponent::get_lod_update_interval() const {
+  return lod_update_interval;
+}
+
 Unit* MovementComponent::get_owner_unit() const {
   // Check if we're still in the tree - if not, parent might be invalid
   if (!is_inside_tree()) {
@@ -344,12 +453,19 @@ Unit* MovementComponent::get_owner_unit() const {
   return Object::cast_to<Unit>(parent);
 }
 
-void MovementComponent::_on_owner_unit_died(godot::Object* source) {
-  // When the owner unit dies, queue this movement component for deletion
-  // Dead units should not have a movement component
-  if (is_inside_tree()) {
-    queue_free();
+void MovementComponent::_on_owner_lifecycle_changed(int state) {
+  // Drop the current order either way: a dead unit stops where it fell and a
+  // revived one waits for a new order at its spawn point
+  _on_stop_requested();
+  lod_velocity = Vector3(0, 0, 0);
+  CharacterBody3D* body = Object::cast_to<CharacterBody3D>(get_parent());
+  if (body != nullptr) {
+    body->set_velocity(Vector3(0, 0, 0));
   }
+
+  // Not a UnitComponent, so suspend ourselves
+  set_physics_process(static_cast<UnitLifecycle>(state) ==
+                      UnitLifecycle::ALIVE);
 }
 
 void MovementComponent::_on_move_requested(const Vector3& position) {
@@ -358,6 +474,7 @@ void MovementComponent::_on_move_requested(const Vector3& position) {
   is_stopped = false;  // Resume movement
   set_desired_location(position);
   current_target_distance = 0.0f;
+  _request_full_update();
 }
 
 void MovementComponent::_on_attack_requested(godot::Object* target,
@@ -373,6 +490,7 @@ void MovementComponent::_on_attack_requested(godot::Object* target,
     set_desired_location(position);
   }
   current_target_distance = 2.5f;
+  _request_full_update();
 }
 
 void MovementComponent::_on_chase_requested(godot::Object* target,
@@ -387,6 +505,7 @@ void MovementComponent::_on_chase_requested(godot::Object* target,
     set_desired_location(position);
   }
   current_target_distance = 0.0f;
+  _request_full_update();
 }
 
 void MovementComponent::_on_chase_to_range_requested(godot::Object* target,
@@ -404,6 +523,7 @@ void MovementComponent::_on_chase_to_range_requested(godot::Object* target,
     set_desired_location(position);
   }
   current_target_distance = 0.0f;
+  _request_full_update();
 }
 
 void MovementComponent::_on_stop_requested() {
@@ -413,6 +533,7 @@ void MovementComponent::_on_stop_requested() {
   is_stopped = true;
   current_target_distance = 0.0f;
   was_chase_in_range = false;
+  _request_full_update();
 }
 
 void MovementComponent::_on_interact_requested(godot::Object* target,
@@ -422,6 +543,7 @@ void MovementComponent::_on_interact_requested(godot::Object* target,
   is_stopped = false;  // Resume movement
   set_desired_location(position);
   current_target_distance = 0.0f;
+  _request_full_update();
 }
 
 void MovementComponent::register_debug_labels(LabelRegistry* registry) {
@@ -429,10 +551,12 @@ void MovementComponent::register_debug_labels(LabelRegistry* registry) {
     return;
   }
 
-  registry->register_property("Movement", "speed", godot::String::num(speed));
-  registry->register_property(
-      "Movement", "dest",
-      DebugUtils::vector3_to_compact_string(desired_location));
+  Unit* owner = get_owner_unit();
+  float current_speed =
+      owner != nullptr ? owner->get_stats().get(Stat::MOVE_SPEED) : speed;
+  registry->register_property("Movement", "speed", current_speed);
+  registry->register_property("Movement", "dest", desired_location);
   registry->register_property("Movement", "at_dest",
                               is_at_destination() ? "true" : "false");
+  registry->register_property("Movement", "lod", lod_update_interval);
 }
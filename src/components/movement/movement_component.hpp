@@ -5,6 +5,10 @@
 #include <godot_cpp/variant/packed_string_array.hpp>
 #include <godot_cpp/variant/vector3.hpp>
 
+namespace godot {
+class CharacterBody3D;
+}  // namespace godot
+
 using godot::NavigationAgent3D;
 using godot::PackedStringArray;
 using godot::Vector3;
@@ -22,7 +26,6 @@ class MovementComponent : public NavigationAgent3D {
   float speed = 5.0f;
   float rotation_speed = 10.0f;
   bool is_ready = false;
-  int32_t frame_count = 0;
   Vector3 desired_location = Vector3(0, 0, 0);
   float current_target_distance = 0.0f;
 
@@ -37,9 +40,24 @@ class MovementComponent : public NavigationAgent3D {
   // Stop flag - when true, unit should not move or accept movement orders
   bool is_stopped = false;
 
+  // Movement LOD - off-screen units run the full navigation update only every
+  // lod_update_interval ticks; skipped ticks step along the cached path
+  // segment (see MovementLOD)
+  int32_t lod_update_interval = 1;
+  int32_t lod_ticks_until_update = 0;
+  Vector3 lod_velocity = Vector3(0, 0, 0);
+  Vector3 lod_next_path_position = Vector3(0, 0, 0);
+
+  // Transform writeback - facing is buffered and pushed to the scene once per
+  // tick, and only when it actually changed
+  int32_t writeback_slot = -1;
+  Vector3 applied_facing_direction = Vector3(0, 0, 0);
+
   // Private helper methods
   void _face_horizontal_direction(const Vector3& direction);
-  void _on_owner_unit_died(godot::Object* source);
+  void _interpolate_skipped_tick(godot::CharacterBody3D* body, double delta);
+  void _request_full_update();
+  void _on_owner_lifecycle_changed(int state);
   void _on_move_requested(const Vector3& position);
   void _on_attack_requested(godot::Object* target, const Vector3& position);
   void _on_chase_requested(godot::Object* target, const Vector3& position);
@@ -54,6 +72,7 @@ class MovementComponent : public NavigationAgent3D {
   ~MovementComponent();
 
   void _ready() override;
+  void _exit_tree() override;
   void _physics_process(double delta) override;
 
   // Properties
@@ -73,6 +92,13 @@ class MovementComponent : public NavigationAgent3D {
   // Utility
   bool is_at_destination() const;
 
+  // No order left to walk: not chasing, arrived or stopped, standing on the
+  // floor (see ActivitySystem; not a UnitComponent, so not virtual)
+  bool is_idle() const;
+
+  // Ticks between full movement updates chosen by MovementLOD (1 = every tick)
+  int32_t get_lod_update_interval() const;
+
   // Get owner Unit for context (replaces get_component_by_class logic)
   Unit* get_owner_unit() const;
 
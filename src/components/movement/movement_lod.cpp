@@ -0,0 +1,80 @@
+#include "movement_lod.hpp"
+
+#include <algorithm>
+#include <godot_cpp/classes/camera3d.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+
+#include "../../core/game_settings.hpp"
+
+using godot::Camera3D;
+using godot::PackedFloat32Array;
+using godot::PackedInt32Array;
+
+bool MovementLOD::settings_loaded = false;
+bool MovementLOD::enabled = true;
+MovementLOD::Tier MovementLOD::tiers[MovementLOD::MAX_TIERS];
+int MovementLOD::tier_count = 0;
+int MovementLOD::beyond_interval = 1;
+
+int MovementLOD::get_update_interval(const Camera3D* camera,
+                                     const Vector3& position) {
+  _ensure_settings_loaded();
+
+  // No camera (dedicated server, headless tests) - nothing is "on screen",
+  // so fall back to full rate rather than guessing relevance
+  if (!enabled || camera == nullptr) {
+    return 1;
+  }
+
+  if (camera->is_position_in_frustum(position)) {
+    return 1;
+  }
+
+  float distance_sq =
+      camera->get_global_position().distance_squared_to(position);
+  for (int i = 0; i < tier_count; i++) {
+    if (distance_sq <= tiers[i].max_distance_sq) {
+      return tiers[i].tick_interval;
+    }
+  }
+
+  return beyond_interval;
+}
+
+void MovementLOD::reload_settings() {
+  enabled = GameSettings::get_movement_lod_enabled();
+
+  PackedFloat32Array distances =
+      GameSettings::get_movement_lod_tier_distances();
+  PackedInt32Array intervals = GameSettings::get_movement_lod_tier_intervals();
+
+  tier_count = std::min(static_cast<int>(distances.size()), MAX_TIERS);
+  for (int i = 0; i < tier_count; i++) {
+    float distance = std::max(0.0f, distances[i]);
+    tiers[i].max_distance_sq = distance * distance;
+    tiers[i].tick_interval =
+        i < intervals.size() ? std::max(1, static_cast<int>(intervals[i])) : 1;
+  }
+
+  // The entry after the last distance threshold covers everything beyond it;
+  // if it is missing, reuse the last tier's interval
+  if (intervals.size() > tier_count) {
+    beyond_interval = std::max(1, static_cast<int>(intervals[tier_count]));
+  } else {
+    beyond_interval = tier_count > 0 ? tiers[tier_count - 1].tick_interval : 1;
+  }
+
+  settings_loaded = true;
+}
+
+bool MovementLOD::is_enabled() {
+  _ensure_settings_loaded();
+  return enabled;
+}
+
+void MovementLOD::_ensure_settings_loaded() {
+  if (!settings_loaded) {
+    reload_settings();
+  }
+}
@@ -0,0 +1,51 @@
+#ifndef GDEXTENSION_MOVEMENT_LOD_H
+#define GDEXTENSION_MOVEMENT_LOD_H
+
+#include <godot_cpp/variant/vector3.hpp>
+
+namespace godot {
+class Camera3D;
+}  // namespace godot
+
+using godot::Vector3;
+
+/// Movement level-of-detail policy
+/// Decides how many physics ticks may pass between full MovementComponent
+/// updates (navigation query, facing, move_and_slide) for a unit.
+///
+/// Relevance rules:
+/// - On-screen units always update every tick
+/// - Off-screen units pick a tier by distance to the active camera
+/// - Callers force full rate for units in combat (chasing, fresh orders)
+///
+/// Tiers come from GameSettings (gameplay/movement_lod/*) and are cached on
+/// first use. Call reload_settings() after changing them at runtime.
+class MovementLOD {
+ public:
+  static constexpr int MAX_TIERS = 8;
+
+  /// Returns the number of ticks until the next full update (1 = every tick)
+  static int get_update_interval(const godot::Camera3D* camera,
+                                 const Vector3& position);
+
+  /// Re-read tier configuration from ProjectSettings
+  static void reload_settings();
+
+  static bool is_enabled();
+
+ private:
+  struct Tier {
+    float max_distance_sq = 0.0f;
+    int tick_interval = 1;
+  };
+
+  static void _ensure_settings_loaded();
+
+  static bool settings_loaded;
+  static bool enabled;
+  static Tier tiers[MAX_TIERS];
+  static int tier_count;
+  static int beyond_interval;  // Interval for units past the last threshold
+};
+
+#endif  // GDEXTENSION_MOVEMENT_LOD_H
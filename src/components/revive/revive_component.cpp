@@ -1,6 +1,5 @@
 #include "revive_component.hpp"
 
-#include <godot_cpp/classes/collision_shape3d.hpp>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/core/property_info.hpp>
@@ -91,12 +90,10 @@ void ReviveComponent::_physics_process(double delta) {
 
       Unit* owner = get_unit();
       if (owner != nullptr && health_component != nullptr) {
-        // Restore full health
+        // Restore full health, then resume collision and components
         health_component->set_current_health(
-            health_component->get_max_health());
-
-        // Re-enable collision
-        _enable_collision();
+            health_component->get_effective_max_health());
+        owner->set_lifecycle(UnitLifecycle::ALIVE);
 
         DBG_INFO("ReviveComponent", "" + owner->get_name() + " has revived!");
       }
@@ -121,6 +118,9 @@ void ReviveComponent::start_revive() {
 
   is_reviving = true;
   revive_timer = revive_time;
+  if (owner != nullptr) {
+    owner->set_lifecycle(UnitLifecycle::REVIVING);
+  }
 }
 
 void ReviveComponent::_on_unit_died(godot::Object* source) {
@@ -128,27 +128,16 @@ void ReviveComponent::_on_unit_died(godot::Object* source) {
   start_revive();
 }
 
-void ReviveComponent::_enable_collision() {
-  Unit* owner = get_unit();
-  if (owner == nullptr || !owner->is_inside_tree()) {
-    return;
+void ReviveComponent::_on_lifecycle_changed(UnitLifecycle state) {
+  // Keep processing: the countdown runs while everything else is suspended.
+  // A pooled unit is reset by its spawner, not revived
+  if (state == UnitLifecycle::POOLED) {
+    is_reviving = false;
   }
+}
 
-  // Find and enable all CollisionShape3D children of the owner
-  for (int i = 0; i < owner->get_child_count(); i++) {
-    godot::Node* child = owner->get_child(i);
-    godot::CollisionShape3D* collision =
-        godot::Object::cast_to<godot::CollisionShape3D>(child);
-    if (collision != nullptr) {
-      collision->set_disabled(false);
-    }
-  }
-
-  // Also enable the CharacterBody3D collision layers
-  owner->set_collision_layer(1);
-  owner->set_collision_mask(1);
-
-  DBG_INFO("ReviveComponent", "Enabled collision for " + owner->get_name());
+bool ReviveComponent::is_idle() const {
+  return !is_reviving;
 }
 
 void ReviveComponent::register_debug_labels(LabelRegistry* registry) {
@@ -159,7 +148,6 @@ void ReviveComponent::register_debug_labels(LabelRegistry* registry) {
   registry->register_property("Revive", "status",
                               is_reviving ? "REVIVING" : "ALIVE");
   if (is_reviving) {
-    registry->register_property("Revive", "timer",
-                                godot::String::num(revive_timer, 1));
+    registry->register_property("Revive", "timer", revive_timer, 1);
   }
 }
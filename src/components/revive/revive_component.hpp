@@ -18,6 +18,9 @@ class ReviveComponent : public UnitComponent {
   // Signal handler for death signal
   void _on_unit_died(godot::Object* source);
 
+  // Stays processing through DEAD/REVIVING (see UnitComponent)
+  void _on_lifecycle_changed(UnitLifecycle state) override;
+
  public:
   ReviveComponent();
   ~ReviveComponent();
@@ -31,14 +34,14 @@ class ReviveComponent : public UnitComponent {
   // Start the revive process
   void start_revive();
 
+  // Not idle while the revive countdown runs (see ActivitySystem)
+  bool is_idle() const override;
+
   // Debug label registration
   void register_debug_labels(LabelRegistry* registry) override;
 
  private:
   HealthComponent* health_component = nullptr;
-
-  // Re-enable collision shapes when unit revives
-  void _enable_collision();
 };
 
 #endif  // GDEXTENSION_REVIVE_COMPONENT_H
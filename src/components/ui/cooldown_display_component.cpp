@@ -1,6 +1,7 @@
 #include "cooldown_display_component.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/scene_tree.hpp>
 #include <godot_cpp/core/class_db.hpp>
@@ -13,6 +14,7 @@
 #include "../../core/unit.hpp"
 #include "../../debug/debug_macros.hpp"
 #include "../abilities/ability_component.hpp"
+#include "hud_clock.hpp"
 
 using godot::ClassDB;
 using godot::D_METHOD;
@@ -46,6 +48,9 @@ void CooldownDisplayComponent::_ready() {
            "  Visible: " + String(is_visible() ? "yes" : "no") +
                ", Class: " + String(get_class()));
 
+  // Processing runs only while a cooldown is ticking
+  set_process(false);
+
   if (Engine::get_singleton()->is_editor_hint()) {
     return;
   }
@@ -69,25 +74,8 @@ void CooldownDisplayComponent::_ready() {
     }
   }
 
-  // 1. Find MatchManager in scene
-  // Search up to find the scene root, then look for MatchManager sibling
-  Node* current = this;
-  Node* scene_root = nullptr;
-
-  while (current && current->get_parent()) {
-    scene_root = current;
-    current = current->get_parent();
-  }
-
-  // Try to find MatchManager as child of scene root
-  if (scene_root) {
-    for (int i = 0; i < scene_root->get_child_count(); i++) {
-      match_manager = Object::cast_to<MatchManager>(scene_root->get_child(i));
-      if (match_manager) {
-        break;
-      }
-    }
-  }
+  // 1. Find MatchManager
+  match_manager = MatchManager::get_singleton();
 
   if (!match_manager) {
     DBG_WARN("CooldownDisplay", "MatchManager not found in scene");
@@ -150,19 +138,17 @@ void CooldownDisplayComponent::_process(double delta) {
     return;
   }
 
-  // Update all active cooldown timers
+  float now = HudClock::now();
   for (size_t i = 0; i < cooldown_timers.size(); i++) {
     CooldownTimer& timer = cooldown_timers[i];
 
-    if (!timer.active) {
+    // Labels change text only on whole seconds / tenths
+    if (!timer.active || now < timer.next_refresh) {
       continue;
     }
 
-    // Update elapsed time
-    timer.elapsed += delta;
-
-    // Calculate remaining time
-    float remaining = std::max(0.0f, timer.duration - timer.elapsed);
+    float remaining =
+        std::max(0.0f, timer.duration - (now - timer.start_time));
 
     // If cooldown is complete
     if (remaining <= 0.0f) {
@@ -171,11 +157,11 @@ void CooldownDisplayComponent::_process(double delta) {
       continue;
     }
 
-    // Update the label for this slot if it exists
-    if (i < cooldown_labels.size()) {
-      _update_label(i, remaining);
-    }
+    _update_label(i, remaining);
+    timer.next_refresh = _next_refresh(now, remaining);
   }
+
+  _update_processing();
 }
 
 void CooldownDisplayComponent::_on_cooldown_started(int slot, float duration) {
@@ -186,9 +172,11 @@ void CooldownDisplayComponent::_on_cooldown_started(int slot, float duration) {
 
   CooldownTimer& timer = cooldown_timers[slot];
   timer.slot = slot;
+  timer.start_time = HudClock::now();
   timer.duration = duration;
-  timer.elapsed = 0.0f;
+  timer.next_refresh = timer.start_time;  // Show the full duration right away
   timer.active = true;
+  set_process(true);
 
   DBG_DEBUG("CooldownDisplay", "Started cooldown: slot=" + String::num(slot) +
                                    " duration=" + String::num(duration, 2));
@@ -204,6 +192,7 @@ void CooldownDisplayComponent::_on_cooldown_changed(int slot) {
   CooldownTimer& timer = cooldown_timers[slot];
   timer.active = false;
   _update_label(slot, 0.0f);
+  _update_processing();
 
   DBG_DEBUG("CooldownDisplay", "Cooldown reset for slot: " + String::num(slot));
 }
@@ -242,6 +231,22 @@ void CooldownDisplayComponent::_update_label(int slot_index, float remaining) {
   }
 }
 
+float CooldownDisplayComponent::_next_refresh(float now,
+                                              float remaining) const {
+  // Text drops when remaining crosses the next whole second (>= 1s) or the
+  // next tenth below that
+  float step = remaining >= 1.0f ? 1.0f : 0.1f;
+  float boundary = std::floor(remaining / step) * step;
+  return now + std::max(0.0f, remaining - boundary);
+}
+
+void CooldownDisplayComponent::_update_processing() {
+  bool any_active = std::any_of(
+      cooldown_timers.begin(), cooldown_timers.end(),
+      [](const CooldownTimer& timer) { return timer.active; });
+  set_process(any_active);
+}
+
 void CooldownDisplayComponent::set_ability_slot_label_paths(
     const godot::Array& paths) {
   ability_slot_label_paths = paths;
@@ -36,6 +36,10 @@ class MatchManager;
 /// - >= 1s: "3s", "2s", "1s"
 /// - < 1s: "0.9s", "0.5s", "0.1s"
 /// - <= 0s: "" (empty, no text)
+///
+/// Timers keep their start time on the HudClock and the time their text
+/// next changes; labels are touched only then (whole seconds, then every
+/// 0.1s), and _process runs only while a cooldown is ticking.
 class CooldownDisplayComponent : public CanvasLayer {
   GDCLASS(CooldownDisplayComponent, CanvasLayer)
 
@@ -48,8 +52,9 @@ class CooldownDisplayComponent : public CanvasLayer {
   // Cooldown tracking
   struct CooldownTimer {
     int slot = -1;
+    float start_time = 0.0f;    // HudClock::now() at cooldown start
     float duration = 0.0f;
-    float elapsed = 0.0f;
+    float next_refresh = 0.0f;  // HudClock time the label text changes
     bool active = false;
   };
   std::vector<CooldownTimer> cooldown_timers;
@@ -79,6 +84,8 @@ class CooldownDisplayComponent : public CanvasLayer {
   // Helper methods
   String _format_cooldown(float remaining) const;
   void _update_label(int slot_index, float remaining);
+  float _next_refresh(float now, float remaining) const;
+  void _update_processing();
 };
 
 #endif  // GDEXTENSION_COOLDOWN_DISPLAY_COMPONENT_H
@@ -1,11 +1,9 @@
 #include "cooldown_icon.hpp"
 
 #include <godot_cpp/classes/engine.hpp>
-#include <godot_cpp/classes/font.hpp>
 #include <godot_cpp/classes/viewport.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/core/property_info.hpp>
-#include <godot_cpp/variant/color.hpp>
 #include <godot_cpp/variant/rect2.hpp>
 #include <godot_cpp/variant/string.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
@@ -15,18 +13,51 @@
 #include "../../debug/debug_macros.hpp"
 #include "../abilities/ability_component.hpp"
 #include "../abilities/ability_node.hpp"
+#include "hud_clock.hpp"
 
 using godot::ClassDB;
-using godot::Color;
 using godot::D_METHOD;
 using godot::Engine;
 using godot::PropertyInfo;
 using godot::String;
 using godot::Variant;
 
+namespace {
+// Darkens the remaining part of the cooldown, sweeping clockwise from
+// 12 o'clock; elapsed time comes from the hud_time global uniform
+constexpr const char* SWEEP_SHADER = R"(shader_type canvas_item;
+
+global uniform float hud_time;
+uniform float cooldown_start = 0.0;
+uniform float cooldown_duration = 0.0;
+uniform vec4 overlay_color : source_color = vec4(0.0, 0.0, 0.0, 0.7);
+
+void fragment() {
+  vec4 icon = texture(TEXTURE, UV);
+  float remaining = 0.0;
+  if (cooldown_duration > 0.0) {
+    remaining = clamp(1.0 - (hud_time - cooldown_start) / cooldown_duration,
+                      0.0, 1.0);
+  }
+
+  vec2 offset = UV - vec2(0.5);
+  float turn = fract(atan(offset.x, -offset.y) / 6.28318530718 + 1.0);
+  float shade = remaining > 0.0 && turn <= remaining ? overlay_color.a : 0.0;
+  COLOR = vec4(mix(icon.rgb, overlay_color.rgb, shade), max(icon.a, shade));
+}
+)";
+}  // namespace
+
+Ref<Shader> CooldownIcon::sweep_shader;
+int32_t CooldownIcon::sweep_shader_users = 0;
+
 CooldownIcon::CooldownIcon() = default;
 
-CooldownIcon::~CooldownIcon() = default;
+CooldownIcon::~CooldownIcon() {
+  if (sweep_material.is_valid() && --sweep_shader_users == 0) {
+    sweep_shader.unref();
+  }
+}
 
 void CooldownIcon::_bind_methods() {
   ClassDB::bind_method(D_METHOD("set_ability_slot", "slot"),
@@ -75,24 +106,7 @@ void CooldownIcon::_ready() {
   // Log positioning after a frame to let layout compute
   call_deferred(godot::StringName("_log_debug_position"));
 
-  // Find MatchManager in scene root
-  Node* current = this;
-  Node* scene_root = nullptr;
-
-  while (current && current->get_parent()) {
-    scene_root = current;
-    current = current->get_parent();
-  }
-
-  MatchManager* match_manager = nullptr;
-  if (scene_root) {
-    for (int i = 0; i < scene_root->get_child_count(); i++) {
-      match_manager = Object::cast_to<MatchManager>(scene_root->get_child(i));
-      if (match_manager) {
-        break;
-      }
-    }
-  }
+  MatchManager* match_manager = MatchManager::get_singleton();
 
   if (!match_manager) {
     DBG_WARN("CooldownIcon", "MatchManager not found in scene");
@@ -132,6 +146,14 @@ void CooldownIcon::_ready() {
     DBG_WARN("CooldownIcon", "No ability at slot " + String::num(ability_slot));
   }
 
+  // Sweep overlay, picking up a cooldown already running
+  _create_sweep_material();
+  float remaining = ability_component->get_cooldown_remaining(ability_slot);
+  if (ability && remaining > 0.0f) {
+    float duration = ability->get_cooldown();
+    _set_sweep(HudClock::now() - (duration - remaining), duration);
+  }
+
   // Connect to cooldown signals
   ability_component->connect(
       "ability_cooldown_started",
@@ -144,115 +166,31 @@ void CooldownIcon::_ready() {
            "Initialized for ability slot " + String::num(ability_slot));
 }
 
-void CooldownIcon::_process(double delta) {
-  if (Engine::get_singleton()->is_editor_hint()) {
-    return;
-  }
+void CooldownIcon::_create_sweep_material() {
+  HudClock::ensure_registered();
 
-  if (!ability_component) {
+  if (sweep_material.is_valid()) {
     return;
   }
 
-  // Query the actual cooldown remaining from the ability component
-  float cooldown_remaining =
-      ability_component->get_cooldown_remaining(ability_slot);
-
-  // Check if cooldown is complete
-  if (cooldown_remaining <= 0.0f) {
-    if (on_cooldown) {
-      on_cooldown = false;
-      cooldown_elapsed = 0.0f;
-      cooldown_duration = 0.0f;
-      queue_redraw();
-    }
-    return;
+  if (sweep_shader.is_null()) {
+    sweep_shader.instantiate();
+    sweep_shader->set_code(SWEEP_SHADER);
   }
+  sweep_shader_users++;
 
-  // If we're now on cooldown and weren't before, update state
-  if (!on_cooldown) {
-    on_cooldown = true;
-    // Get the full duration from the ability node
-    AbilityNode* ability = ability_component->get_ability(ability_slot);
-    if (ability) {
-      cooldown_duration = ability->get_cooldown();
-    }
-  }
-
-  // Calculate elapsed from the remaining and duration
-  if (cooldown_duration > 0.0f) {
-    cooldown_elapsed = cooldown_duration - cooldown_remaining;
-  }
-
-  // Redraw to update the cooldown overlay
-  queue_redraw();
+  sweep_material.instantiate();
+  sweep_material->set_shader(sweep_shader);
+  set_material(sweep_material);
 }
 
-void CooldownIcon::_draw() {
-  // Don't draw anything if texture is not set
-  if (!get_texture().is_valid()) {
+void CooldownIcon::_set_sweep(float start_time, float duration) {
+  if (sweep_material.is_null()) {
     return;
   }
 
-  // If on cooldown, draw a radial cooldown overlay
-  if (on_cooldown && cooldown_duration > 0.0f) {
-    float progress = cooldown_elapsed / cooldown_duration;
-    progress = godot::Math::clamp(progress, 0.0f, 1.0f);
-
-    // Set clip rect to constrain drawing to icon bounds
-    draw_set_transform(Vector2(0, 0), 0, Vector2(1, 1));
-
-    // Draw dark overlay for the REMAINING cooldown portion
-    // Arc sweeps clockwise from top (12 o'clock), darkness decreases as
-    // cooldown completes
-    Vector2 center = icon_size / 2.0f;
-    // Radius is distance from center to corner - perfectly fills the icon
-    float half_x = icon_size.x / 2.0f;
-    float half_y = icon_size.y / 2.0f;
-    float radius = godot::Math::sqrt(half_x * half_x + half_y * half_y);
-
-    int segments = 32;  // Number of segments for smooth arc
-    float start_angle = -(float)Math_PI / 2.0f;  // Start at top (12 o'clock)
-    float remaining = 1.0f - progress;  // Remaining cooldown as a fraction
-    float sweep_angle =
-        2.0f * (float)Math_PI * remaining;  // How much arc to draw
-
-    Color dark_overlay =
-        Color(0, 0, 0, 0.7f);  // Dark overlay for remaining time
-
-    // Draw filled arc by creating triangles from center to arc
-    for (int i = 0; i < segments; i++) {
-      float ratio1 = (float)i / segments;
-      float ratio2 = (float)(i + 1) / segments;
-
-      // Only draw if within the remaining range
-      if (ratio1 >= remaining)
-        break;
-
-      float angle1 = start_angle + sweep_angle * ratio1;
-      float angle2 = start_angle + sweep_angle * ratio2;
-
-      Vector2 point1 =
-          center +
-          Vector2(godot::Math::cos(angle1), godot::Math::sin(angle1)) * radius;
-      Vector2 point2 =
-          center +
-          Vector2(godot::Math::cos(angle2), godot::Math::sin(angle2)) * radius;
-
-      // Clamp points to icon bounds
-      point1.x = godot::Math::clamp(point1.x, 0.0f, icon_size.x);
-      point1.y = godot::Math::clamp(point1.y, 0.0f, icon_size.y);
-      point2.x = godot::Math::clamp(point2.x, 0.0f, icon_size.x);
-      point2.y = godot::Math::clamp(point2.y, 0.0f, icon_size.y);
-
-      // Draw triangle from center to arc
-      godot::PackedVector2Array points;
-      points.push_back(center);
-      points.push_back(point1);
-      points.push_back(point2);
-
-      draw_colored_polygon(points, dark_overlay);
-    }
-  }
+  sweep_material->set_shader_parameter("cooldown_start", start_time);
+  sweep_material->set_shader_parameter("cooldown_duration", duration);
 }
 
 void CooldownIcon::_on_cooldown_started(int slot, float duration) {
@@ -260,13 +198,10 @@ void CooldownIcon::_on_cooldown_started(int slot, float duration) {
     return;
   }
 
-  cooldown_duration = duration;
-  cooldown_elapsed = 0.0f;
-  on_cooldown = true;
+  _set_sweep(HudClock::now(), duration);
 
   DBG_DEBUG("CooldownIcon", "Cooldown started for slot " + String::num(slot) +
                                 ": " + String::num(duration, 2) + "s");
-  queue_redraw();
 }
 
 void CooldownIcon::_on_cooldown_changed(int slot) {
@@ -274,12 +209,9 @@ void CooldownIcon::_on_cooldown_changed(int slot) {
     return;
   }
 
-  on_cooldown = false;
-  cooldown_elapsed = 0.0f;
-  cooldown_duration = 0.0f;
+  _set_sweep(0.0f, 0.0f);
 
   DBG_DEBUG("CooldownIcon", "Cooldown reset for slot " + String::num(slot));
-  queue_redraw();
 }
 
 void CooldownIcon::_log_debug_position() {
@@ -1,10 +1,16 @@
 #ifndef GDEXTENSION_COOLDOWN_ICON_H
 #define GDEXTENSION_COOLDOWN_ICON_H
 
+#include <cstdint>
+#include <godot_cpp/classes/shader.hpp>
+#include <godot_cpp/classes/shader_material.hpp>
 #include <godot_cpp/classes/texture_rect.hpp>
 #include <godot_cpp/variant/string_name.hpp>
 #include <godot_cpp/variant/vector2.hpp>
 
+using godot::Ref;
+using godot::Shader;
+using godot::ShaderMaterial;
 using godot::StringName;
 using godot::TextureRect;
 using godot::Vector2;
@@ -15,7 +21,7 @@ class AbilityComponent;
 ///
 /// This component shows:
 /// - Ability icon centered
-/// - Visual progress overlay during cooldown (animated swipe from bottom)
+/// - Radial sweep overlay during cooldown
 /// - Cooldown text in the corner (e.g., "2.5s")
 ///
 /// Properties:
@@ -27,6 +33,12 @@ class AbilityComponent;
 /// 2. Gets the ability icon from that slot
 /// 3. Draws a visual cooldown overlay during cooldown
 /// 4. Updates in real-time via ability cooldown signals
+///
+/// The radial sweep is a canvas shader on the icon. cooldown_started sets
+/// its start time and duration once, and the shader animates from the
+/// global hud_time uniform (see HudClock), so a ticking cooldown costs no
+/// CPU work per frame. All icons share one compiled shader; each has its own
+/// material for the per-icon parameters.
 class CooldownIcon : public TextureRect {
   GDCLASS(CooldownIcon, TextureRect)
 
@@ -38,17 +50,21 @@ class CooldownIcon : public TextureRect {
 
   AbilityComponent* ability_component = nullptr;
 
-  // Cooldown tracking
-  float cooldown_duration = 0.0f;
-  float cooldown_elapsed = 0.0f;
-  bool on_cooldown = false;
+  // Sweep shader; parameters change only when a cooldown starts or resets
+  Ref<ShaderMaterial> sweep_material;
+
+  // Compiled once and shared by every icon; released with the last icon so
+  // it never outlives the RenderingServer
+  static Ref<Shader> sweep_shader;
+  static int32_t sweep_shader_users;
 
   // Signal handlers
   void _on_cooldown_started(int slot, float duration);
   void _on_cooldown_changed(int slot);
 
   // Drawing
-  void _draw_cooldown_overlay();
+  void _create_sweep_material();
+  void _set_sweep(float start_time, float duration);
 
   // Debug
   void _log_debug_position();
@@ -58,8 +74,6 @@ class CooldownIcon : public TextureRect {
   ~CooldownIcon();
 
   void _ready() override;
-  void _process(double delta) override;
-  void _draw() override;
 
   // Properties
   void set_ability_slot(int slot);
@@ -0,0 +1,286 @@
+#include "debug_label_overlay.hpp"
+
+#include <algorithm>
+#include <godot_cpp/classes/camera3d.hpp>
+#include <godot_cpp/classes/canvas_layer.hpp>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/viewport.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/property_info.hpp>
+#include <godot_cpp/variant/rect2.hpp>
+
+#include "../../core/unit.hpp"
+#include "../../debug/debug_macros.hpp"
+#include "label_registry.hpp"
+
+using godot::Camera3D;
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::Engine;
+using godot::PropertyInfo;
+using godot::Rect2;
+using godot::Variant;
+
+DebugLabelOverlay* DebugLabelOverlay::singleton_instance = nullptr;
+
+namespace {
+// Above the GameUI HUD
+constexpr int32_t OVERLAY_LAYER = 100;
+}  // namespace
+
+DebugLabelOverlay::DebugLabelOverlay() {
+  singleton_instance = this;
+}
+
+DebugLabelOverlay::~DebugLabelOverlay() {
+  if (singleton_instance == this) {
+    singleton_instance = nullptr;
+  }
+}
+
+void DebugLabelOverlay::_bind_methods() {
+  ClassDB::bind_method(D_METHOD("set_background_color", "color"),
+                       &DebugLabelOverlay::set_background_color);
+  ClassDB::bind_method(D_METHOD("get_background_color"),
+                       &DebugLabelOverlay::get_background_color);
+  ADD_PROPERTY(PropertyInfo(Variant::COLOR, "background_color"),
+               "set_background_color", "get_background_color");
+
+  ClassDB::bind_method(D_METHOD("set_text_color", "color"),
+                       &DebugLabelOverlay::set_text_color);
+  ClassDB::bind_method(D_METHOD("get_text_color"),
+                       &DebugLabelOverlay::get_text_color);
+  ADD_PROPERTY(PropertyInfo(Variant::COLOR, "text_color"), "set_text_color",
+               "get_text_color");
+
+  ClassDB::bind_method(D_METHOD("get_label_count"),
+                       &DebugLabelOverlay::get_label_count);
+  ClassDB::bind_method(D_METHOD("get_last_frame_visible"),
+                       &DebugLabelOverlay::get_last_frame_visible);
+  ClassDB::bind_method(D_METHOD("get_last_frame_measured"),
+                       &DebugLabelOverlay::get_last_frame_measured);
+}
+
+void DebugLabelOverlay::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  singleton_instance = this;
+  set_anchors_preset(Control::PRESET_FULL_RECT);
+  set_mouse_filter(Control::MOUSE_FILTER_IGNORE);
+  set_process(true);
+}
+
+void DebugLabelOverlay::_process(double delta) {
+  bool had_drawn = !drawn_labels.empty();
+  drawn_labels.clear();
+  last_frame_visible = 0;
+
+  godot::Viewport* viewport = get_viewport();
+  Camera3D* camera = viewport != nullptr ? viewport->get_camera_3d() : nullptr;
+  if (camera == nullptr) {
+    if (had_drawn) {
+      queue_redraw();
+    }
+    return;
+  }
+
+  Rect2 screen = viewport->get_visible_rect();
+
+  for (int32_t slot = 0; slot < static_cast<int32_t>(entries.size());
+       slot++) {
+    const Entry& entry = entries[slot];
+    if (entry.unit == nullptr || !entry.unit->is_visible()) {
+      continue;
+    }
+
+    Vector3 anchor =
+        entry.unit->get_global_transform_interpolated().origin + entry.offset;
+    if (camera->is_position_behind(anchor)) {
+      continue;
+    }
+
+    // Labels centered just outside the screen still show partly
+    Vector2 screen_pos = camera->unproject_position(anchor);
+    Vector2 half_size = entry.text_size * 0.5f + Vector2(padding, padding);
+    if (!screen.grow_individual(half_size.x, half_size.y, half_size.x,
+                                half_size.y)
+             .has_point(screen_pos)) {
+      continue;
+    }
+
+    drawn_labels.push_back({slot, screen_pos});
+    last_frame_visible++;
+  }
+
+  if (had_drawn || !drawn_labels.empty()) {
+    queue_redraw();
+  }
+}
+
+void DebugLabelOverlay::_draw() {
+  last_frame_measured = 0;
+  if (drawn_labels.empty()) {
+    return;
+  }
+
+  Ref<Font> font = _get_font();
+  if (font.is_null()) {
+    return;
+  }
+
+  Vector2 pad = Vector2(padding, padding);
+  for (const DrawnLabel& drawn : drawn_labels) {
+    Entry& entry = entries[drawn.slot];
+    if (entry.text_dirty) {
+      _measure(entry, font);
+    }
+    if (entry.text.is_empty()) {
+      continue;
+    }
+
+    Vector2 top_left = drawn.position - entry.text_size * 0.5f;
+    draw_rect(Rect2(top_left - pad, entry.text_size + pad * 2.0f),
+              background_color);
+    Vector2 baseline =
+        top_left + Vector2(0, font->get_ascent(entry.font_size));
+    draw_multiline_string(font, baseline, entry.text,
+                          godot::HORIZONTAL_ALIGNMENT_LEFT, -1,
+                          entry.font_size, -1, text_color);
+  }
+}
+
+Ref<Font> DebugLabelOverlay::_get_font() const {
+  return get_theme_default_font();
+}
+
+void DebugLabelOverlay::_measure(Entry& entry, const Ref<Font>& font) {
+  // The registry formats its numbers here, once per change
+  entry.text = entry.registry->get_formatted_text();
+  entry.text_size = font->get_multiline_string_size(
+      entry.text, godot::HORIZONTAL_ALIGNMENT_LEFT, -1, entry.font_size);
+  entry.text_dirty = false;
+  last_frame_measured++;
+}
+
+int32_t DebugLabelOverlay::add_label(Unit* unit,
+                                     const LabelRegistry* registry,
+                                     const Vector3& offset,
+                                     int32_t font_size) {
+  if (unit == nullptr || registry == nullptr) {
+    return INVALID_SLOT;
+  }
+
+  int32_t slot;
+  if (!free_slots.empty()) {
+    slot = free_slots.back();
+    free_slots.pop_back();
+  } else {
+    slot = static_cast<int32_t>(entries.size());
+    entries.emplace_back();
+  }
+
+  Entry& entry = entries[slot];
+  entry.unit = unit;
+  entry.registry = registry;
+  entry.offset = offset;
+  entry.font_size = font_size;
+  entry.text_dirty = true;
+
+  label_count++;
+  return slot;
+}
+
+void DebugLabelOverlay::remove_label(int32_t slot) {
+  if (slot < 0 || slot >= static_cast<int32_t>(entries.size()) ||
+      entries[slot].unit == nullptr) {
+    return;
+  }
+
+  entries[slot] = Entry();
+  free_slots.push_back(slot);
+  label_count--;
+}
+
+void DebugLabelOverlay::mark_dirty(int32_t slot) {
+  if (slot < 0 || slot >= static_cast<int32_t>(entries.size())) {
+    return;
+  }
+
+  entries[slot].text_dirty = true;
+}
+
+void DebugLabelOverlay::set_label_offset(int32_t slot,
+                                         const Vector3& offset) {
+  if (slot < 0 || slot >= static_cast<int32_t>(entries.size())) {
+    return;
+  }
+
+  entries[slot].offset = offset;
+}
+
+void DebugLabelOverlay::set_label_font_size(int32_t slot, int32_t font_size) {
+  if (slot < 0 || slot >= static_cast<int32_t>(entries.size())) {
+    return;
+  }
+
+  entries[slot].font_size = font_size;
+  entries[slot].text_dirty = true;
+}
+
+void DebugLabelOverlay::set_background_color(const Color& color) {
+  background_color = color;
+}
+
+Color DebugLabelOverlay::get_background_color() const {
+  return background_color;
+}
+
+void DebugLabelOverlay::set_text_color(const Color& color) {
+  text_color = color;
+}
+
+Color DebugLabelOverlay::get_text_color() const {
+  return text_color;
+}
+
+int32_t DebugLabelOverlay::get_label_count() const {
+  return label_count;
+}
+
+int32_t DebugLabelOverlay::get_last_frame_visible() const {
+  return last_frame_visible;
+}
+
+int32_t DebugLabelOverlay::get_last_frame_measured() const {
+  return last_frame_measured;
+}
+
+DebugLabelOverlay* DebugLabelOverlay::get_singleton() {
+  return singleton_instance;
+}
+
+DebugLabelOverlay* DebugLabelOverlay::ensure_singleton(Node* context) {
+  if (singleton_instance != nullptr) {
+    return singleton_instance;
+  }
+
+  if (context == nullptr || !context->is_inside_tree()) {
+    return nullptr;
+  }
+
+  godot::CanvasLayer* layer = memnew(godot::CanvasLayer);
+  layer->set_name("DebugLabelLayer");
+  layer->set_layer(OVERLAY_LAYER);
+
+  DebugLabelOverlay* overlay = memnew(DebugLabelOverlay);
+  overlay->set_name("DebugLabelOverlay");
+  layer->add_child(overlay);
+
+  context->get_tree()->get_root()->call_deferred("add_child", layer);
+  DBG_INFO("DebugLabelOverlay", "Created debug label overlay");
+  return singleton_instance;
+}
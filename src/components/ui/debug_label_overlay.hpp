@@ -0,0 +1,112 @@
+#ifndef GDEXTENSION_DEBUG_LABEL_OVERLAY_H
+#define GDEXTENSION_DEBUG_LABEL_OVERLAY_H
+
+#include <cstdint>
+#include <godot_cpp/classes/control.hpp>
+#include <godot_cpp/classes/font.hpp>
+#include <godot_cpp/variant/color.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/vector2.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <vector>
+
+using godot::Color;
+using godot::Control;
+using godot::Font;
+using godot::Ref;
+using godot::String;
+using godot::Vector2;
+using godot::Vector3;
+
+class LabelRegistry;
+class Unit;
+
+/// Draws every unit debug label in one canvas pass
+/// LabelComponents register their unit and LabelRegistry here instead of
+/// owning a Label each. Once per frame the overlay fetches the camera once,
+/// projects every label above its unit, culls labels behind the camera, off
+/// screen or on hidden units, and draws the rest (background + text) from
+/// this single CanvasItem's _draw.
+///
+/// Text is only re-read from a registry (and re-measured) when one of its
+/// values changed, so idle labels cost a projection and two draw calls.
+///
+/// Lives on its own CanvasLayer above the HUD, covering the viewport and
+/// ignoring the mouse.
+class DebugLabelOverlay : public Control {
+  GDCLASS(DebugLabelOverlay, Control)
+
+ protected:
+  static void _bind_methods();
+
+  struct Entry {
+    Unit* unit = nullptr;  // nullptr = free slot
+    const LabelRegistry* registry = nullptr;
+    Vector3 offset;
+    int32_t font_size = 16;
+    bool text_dirty = true;
+    String text;        // Cached registry text
+    Vector2 text_size;  // Measured with the overlay font
+  };
+
+  struct DrawnLabel {
+    int32_t slot = -1;
+    Vector2 position;  // Center on screen
+  };
+
+  std::vector<Entry> entries;
+  std::vector<int32_t> free_slots;
+  std::vector<DrawnLabel> drawn_labels;  // Rebuilt every frame, reused
+  int32_t label_count = 0;
+  int32_t last_frame_visible = 0;
+  int32_t last_frame_measured = 0;
+
+  Color background_color = Color(0.0f, 0.0f, 0.0f, 0.6f);
+  Color text_color = Color(1.0f, 1.0f, 1.0f, 1.0f);
+  float padding = 4.0f;
+
+  Ref<Font> _get_font() const;
+  void _measure(Entry& entry, const Ref<Font>& font);
+
+ public:
+  static constexpr int32_t INVALID_SLOT = -1;
+
+  DebugLabelOverlay();
+  ~DebugLabelOverlay();
+
+  void _ready() override;
+  void _process(double delta) override;
+  void _draw() override;
+
+  /// Register a unit's label; registry must outlive the slot
+  int32_t add_label(Unit* unit,
+                    const LabelRegistry* registry,
+                    const Vector3& offset,
+                    int32_t font_size);
+  void remove_label(int32_t slot);
+
+  /// The registry of slot changed; its text is re-read at the next draw
+  void mark_dirty(int32_t slot);
+
+  void set_label_offset(int32_t slot, const Vector3& offset);
+  void set_label_font_size(int32_t slot, int32_t font_size);
+
+  void set_background_color(const Color& color);
+  Color get_background_color() const;
+
+  void set_text_color(const Color& color);
+  Color get_text_color() const;
+
+  int32_t get_label_count() const;
+  int32_t get_last_frame_visible() const;
+  int32_t get_last_frame_measured() const;
+
+  static DebugLabelOverlay* get_singleton();
+  /// Creates the overlay (on its own CanvasLayer) under the root if needed
+  static DebugLabelOverlay* ensure_singleton(Node* context);
+
+ private:
+  static DebugLabelOverlay* singleton_instance;
+};
+
+#endif  // GDEXTENSION_DEBUG_LABEL_OVERLAY_H
@@ -1,6 +1,5 @@
 #include "head_bar.hpp"
 
-#include <godot_cpp/classes/camera3d.hpp>
 #include <godot_cpp/classes/canvas_layer.hpp>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/mesh_instance3d.hpp>
@@ -16,6 +15,7 @@
 #include "../../debug/debug_macros.hpp"
 #include "../health/health_component.hpp"
 #include "../resources/resource_pool_component.hpp"
+#include "head_bar_renderer.hpp"
 
 using godot::ClassDB;
 using godot::D_METHOD;
@@ -43,9 +43,17 @@ void HeadBar::_bind_methods() {
   ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "health_bar_path"),
                "set_health_bar_path", "get_health_bar_path");
 
+  ClassDB::bind_method(D_METHOD("set_batched", "enabled"),
+                       &HeadBar::set_batched);
+  ClassDB::bind_method(D_METHOD("is_batched"), &HeadBar::is_batched);
+  ADD_PROPERTY(PropertyInfo(Variant::BOOL, "batched"), "set_batched",
+               "is_batched");
+
   // Signal handlers
   ClassDB::bind_method(D_METHOD("_on_health_changed", "current", "max"),
                        &HeadBar::_on_health_changed);
+  ClassDB::bind_method(D_METHOD("_register_bar"), &HeadBar::_register_bar);
+  ClassDB::bind_method(D_METHOD("_unregister_bar"), &HeadBar::_unregister_bar);
   ClassDB::bind_method(D_METHOD("_reparent_to_game_ui", "game_ui"),
                        &HeadBar::_reparent_to_game_ui);
 }
@@ -63,34 +71,22 @@ void HeadBar::_ready() {
     return;
   }
 
-  // 2. Find GameUI CanvasLayer and reparent to it
-  godot::CanvasLayer* game_ui = nullptr;
+  // 2. Find GameUI CanvasLayer
   Node* current = parent;
   while (current) {
-    game_ui = Object::cast_to<godot::CanvasLayer>(
+    game_ui_layer = Object::cast_to<godot::CanvasLayer>(
         current->get_node_or_null("GameUI"));
-    if (game_ui) {
+    if (game_ui_layer) {
       break;
     }
     current = current->get_parent();
   }
 
-  if (game_ui) {
-    // Defer reparenting to avoid "busy adding/removing children" error
-    call_deferred(godot::StringName("_reparent_to_game_ui"),
-                  godot::Variant(game_ui));
-    DBG_DEBUG("HeadBar", "Scheduled reparent to GameUI CanvasLayer");
-  } else {
+  if (!game_ui_layer) {
     DBG_WARN("HeadBar", "GameUI CanvasLayer not found in scene");
     return;
   }
 
-  // 4. Get camera from viewport
-  auto viewport = get_viewport();
-  if (viewport) {
-    camera = viewport->get_camera_3d();
-  }
-
   // 5. Get HealthComponent from parent
   health_component = Object::cast_to<HealthComponent>(
       owner_unit->get_component_by_class("HealthComponent"));
@@ -124,18 +120,39 @@ void HeadBar::_ready() {
              "HealthBar not found at path: " + String(health_bar_path));
   }
 
+  // 9. Measure the anchor once and hand positioning to the renderer
+  anchor_offset = _measure_anchor_offset();
+  _register_bar();
+  owner_unit->connect(
+      "tree_exiting",
+      godot::Callable(this, godot::StringName("_unregister_bar")));
+  owner_unit->connect(
+      "tree_entered",
+      godot::Callable(this, godot::StringName("_register_bar")));
+
+  if (batched) {
+    // The renderer draws the health bar; this Control is never shown
+    set_visible(false);
+  } else {
+    // Defer reparenting to avoid "busy adding/removing children" error
+    call_deferred(godot::StringName("_reparent_to_game_ui"),
+                  godot::Variant(game_ui_layer));
+    DBG_DEBUG("HeadBar", "Scheduled reparent to GameUI CanvasLayer");
+  }
+
   DBG_INFO("HeadBar", "Initialized for unit: " + owner_unit->get_name());
 }
 
-void HeadBar::_process(double delta) {
-  if (Engine::get_singleton()->is_editor_hint()) {
-    return;
-  }
+void HeadBar::_enter_tree() {
+  // Re-register after a reparent (e.g. to GameUI); no-op before _ready
+  _register_bar();
+}
 
-  if (!owner_unit || !camera) {
-    return;
-  }
+void HeadBar::_exit_tree() {
+  _unregister_bar();
+}
 
+Vector3 HeadBar::_measure_anchor_offset() const {
   // Find MeshInstance3D to get AABB for positioning
   godot::MeshInstance3D* mesh_instance = nullptr;
   for (int i = 0; i < owner_unit->get_child_count(); i++) {
@@ -146,38 +163,53 @@ void HeadBar::_process(double delta) {
     }
   }
 
-  Vector3 unit_pos = owner_unit->get_global_position();
-  Vector3 world_pos =
-      unit_pos + Vector3(0, 3, 0);  // Default position above unit
-
-  // If we found a mesh, use its AABB to position more precisely
-  if (mesh_instance) {
-    godot::AABB aabb = mesh_instance->get_aabb();
-
-    // Get the top of the AABB (max Y value)
-    float mesh_top_y = aabb.size.y;
+  if (!mesh_instance) {
+    return Vector3(0, 3, 0);  // Default position above unit
+  }
 
-    // Mesh instance local position
-    Vector3 mesh_local_pos = mesh_instance->get_position();
+  // Mesh offset + top of mesh (max Y value of its AABB)
+  godot::AABB aabb = mesh_instance->get_aabb();
+  return mesh_instance->get_position() + Vector3(0, aabb.size.y, 0);
+}
 
-    // Calculate world position: unit center + mesh offset + top of mesh
-    world_pos = unit_pos + mesh_local_pos + Vector3(0, mesh_top_y, 0);
+void HeadBar::_register_bar() {
+  if (!owner_unit || !game_ui_layer ||
+      bar_slot != HeadBarRenderer::INVALID_SLOT) {
+    return;
   }
 
-  // Convert to screen position
-  godot::Vector2 screen_pos = camera->unproject_position(world_pos);
-
-  // Adjust so the BOTTOM MIDDLE of the HeadBar aligns with the world position
-  // Get the HeadBar's size to offset it properly
-  godot::Vector2 size = get_size();
-  screen_pos.y -=
-      size.y;  // Move up by the height so bottom aligns with world_pos
-  screen_pos.x -= size.x / 2.0f;  // Center horizontally
+  HeadBarRenderer* renderer = HeadBarRenderer::ensure_singleton(game_ui_layer);
+  if (renderer == nullptr) {
+    return;
+  }
+  bar_slot =
+      renderer->add_bar(owner_unit, anchor_offset, batched ? nullptr : this);
+  if (health_component) {
+    _on_health_changed(health_component->get_current_health(),
+                       health_component->get_effective_max_health());
+  }
+}
 
-  set_global_position(screen_pos);
+void HeadBar::_unregister_bar() {
+  HeadBarRenderer* renderer = HeadBarRenderer::get_singleton();
+  if (renderer != nullptr) {
+    renderer->remove_bar(bar_slot);
+  }
+  bar_slot = HeadBarRenderer::INVALID_SLOT;
+  if (!batched) {
+    set_visible(false);
+  }
 }
 
 void HeadBar::_on_health_changed(float current, float max) {
+  if (batched) {
+    HeadBarRenderer* renderer = HeadBarRenderer::get_singleton();
+    if (renderer != nullptr) {
+      renderer->set_health(bar_slot, current, max);
+    }
+    return;
+  }
+
   if (!health_bar) {
     return;
   }
@@ -202,6 +234,14 @@ godot::NodePath HeadBar::get_health_bar_path() const {
   return health_bar_path;
 }
 
+void HeadBar::set_batched(bool enabled) {
+  batched = enabled;
+}
+
+bool HeadBar::is_batched() const {
+  return batched;
+}
+
 void HeadBar::_reparent_to_game_ui(godot::Object* game_ui) {
   if (!game_ui || !is_inside_tree()) {
     DBG_WARN("HeadBar", "_reparent_to_game_ui: Invalid game_ui or not in tree");
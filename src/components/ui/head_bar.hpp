@@ -1,7 +1,6 @@
 #ifndef GDEXTENSION_HEAD_BAR_H
 #define GDEXTENSION_HEAD_BAR_H
 
-#include <godot_cpp/classes/camera3d.hpp>
 #include <godot_cpp/classes/control.hpp>
 #include <godot_cpp/classes/label.hpp>
 #include <godot_cpp/classes/progress_bar.hpp>
@@ -10,7 +9,6 @@
 #include <map>
 #include <vector>
 
-using godot::Camera3D;
 using godot::Control;
 using godot::Label;
 using godot::ProgressBar;
@@ -18,6 +16,10 @@ using godot::StringName;
 using godot::Vector2;
 using godot::Vector3;
 
+namespace godot {
+class CanvasLayer;
+}  // namespace godot
+
 class Unit;
 class HealthComponent;
 class ResourcePoolComponent;
@@ -40,6 +42,11 @@ class ResourcePoolComponent;
 /// 3. Updates ProgressBar values only
 /// 4. Dynamically discovers ResourcePoolComponents and matches them to
 /// Resource* children
+///
+/// Positioning is done by the HeadBarRenderer, which projects every bar in
+/// one pass; the anchor above the unit is measured once, at _ready. With
+/// batched set (crowds of minions), the Control stays hidden and the
+/// renderer draws just the health bar.
 class HeadBar : public Control {
   GDCLASS(HeadBar, Control)
 
@@ -58,8 +65,15 @@ class HeadBar : public Control {
   Label* unit_name_label = nullptr;
   ProgressBar* health_bar = nullptr;
 
-  // Camera for world-to-screen positioning
-  Camera3D* camera = nullptr;
+  // Drawn by the HeadBarRenderer instead of this Control
+  bool batched = false;
+  int32_t bar_slot = -1;  // HeadBarRenderer slot
+  Vector3 anchor_offset = Vector3(0, 3, 0);
+  godot::CanvasLayer* game_ui_layer = nullptr;
+
+  Vector3 _measure_anchor_offset() const;
+  void _register_bar();
+  void _unregister_bar();
 
   // Signal handlers
   void _on_health_changed(float current, float max);
@@ -69,8 +83,9 @@ class HeadBar : public Control {
   HeadBar();
   ~HeadBar();
 
+  void _enter_tree() override;
   void _ready() override;
-  void _process(double delta) override;
+  void _exit_tree() override;
 
   // Properties
   void set_unit_name_label_path(const godot::NodePath& path);
@@ -78,6 +93,9 @@ class HeadBar : public Control {
 
   void set_health_bar_path(const godot::NodePath& path);
   godot::NodePath get_health_bar_path() const;
+
+  void set_batched(bool enabled);
+  bool is_batched() const;
 };
 
 #endif  // GDEXTENSION_HEAD_BAR_H
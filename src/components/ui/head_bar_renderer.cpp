@@ -0,0 +1,249 @@
+#include "head_bar_renderer.hpp"
+
+#include <algorithm>
+#include <godot_cpp/classes/camera3d.hpp>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/viewport.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/property_info.hpp>
+#include <godot_cpp/variant/rect2.hpp>
+
+#include "../../core/unit.hpp"
+#include "../../debug/debug_macros.hpp"
+
+using godot::Camera3D;
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::Engine;
+using godot::PropertyInfo;
+using godot::Rect2;
+using godot::Variant;
+
+HeadBarRenderer* HeadBarRenderer::singleton_instance = nullptr;
+
+HeadBarRenderer::HeadBarRenderer() {
+  singleton_instance = this;
+}
+
+HeadBarRenderer::~HeadBarRenderer() {
+  if (singleton_instance == this) {
+    singleton_instance = nullptr;
+  }
+}
+
+void HeadBarRenderer::_bind_methods() {
+  ClassDB::bind_method(D_METHOD("set_bar_size", "size"),
+                       &HeadBarRenderer::set_bar_size);
+  ClassDB::bind_method(D_METHOD("get_bar_size"),
+                       &HeadBarRenderer::get_bar_size);
+  ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "bar_size"), "set_bar_size",
+               "get_bar_size");
+
+  ClassDB::bind_method(D_METHOD("set_fill_color", "color"),
+                       &HeadBarRenderer::set_fill_color);
+  ClassDB::bind_method(D_METHOD("get_fill_color"),
+                       &HeadBarRenderer::get_fill_color);
+  ADD_PROPERTY(PropertyInfo(Variant::COLOR, "fill_color"), "set_fill_color",
+               "get_fill_color");
+
+  ClassDB::bind_method(D_METHOD("set_background_color", "color"),
+                       &HeadBarRenderer::set_background_color);
+  ClassDB::bind_method(D_METHOD("get_background_color"),
+                       &HeadBarRenderer::get_background_color);
+  ADD_PROPERTY(PropertyInfo(Variant::COLOR, "background_color"),
+               "set_background_color", "get_background_color");
+
+  ClassDB::bind_method(D_METHOD("get_bar_count"),
+                       &HeadBarRenderer::get_bar_count);
+  ClassDB::bind_method(D_METHOD("get_last_frame_visible"),
+                       &HeadBarRenderer::get_last_frame_visible);
+}
+
+void HeadBarRenderer::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  singleton_instance = this;
+  set_anchors_preset(Control::PRESET_FULL_RECT);
+  set_mouse_filter(Control::MOUSE_FILTER_IGNORE);
+  set_process(true);
+}
+
+void HeadBarRenderer::_process(double delta) {
+  bool had_drawn = !drawn_bars.empty();
+  drawn_bars.clear();
+  last_frame_visible = 0;
+
+  godot::Viewport* viewport = get_viewport();
+  Camera3D* camera = viewport != nullptr ? viewport->get_camera_3d() : nullptr;
+  if (camera == nullptr) {
+    if (had_drawn) {
+      queue_redraw();
+    }
+    return;
+  }
+
+  // Bars whose anchor is just outside the screen still show partly
+  Rect2 screen = viewport->get_visible_rect().grow(
+      std::max(bar_size.x, bar_size.y));
+
+  for (Bar& bar : bars) {
+    if (bar.unit == nullptr) {
+      continue;
+    }
+
+    // Follow the rendered (interpolated) transform, not the last sim tick
+    Vector3 anchor = bar.unit->get_global_transform_interpolated().origin +
+                     bar.anchor_offset;
+    bool visible = bar.unit->is_visible() &&
+                   !camera->is_position_behind(anchor);
+    Vector2 screen_pos;
+    if (visible) {
+      screen_pos = camera->unproject_position(anchor);
+      visible = screen.has_point(screen_pos);
+    }
+
+    if (bar.control == nullptr) {
+      if (visible) {
+        drawn_bars.push_back({screen_pos, bar.health_fraction});
+        last_frame_visible++;
+      }
+      continue;
+    }
+
+    if (visible != bar.shown) {
+      bar.control->set_visible(visible);
+      bar.shown = visible;
+    }
+    if (!visible) {
+      continue;
+    }
+
+    // Bottom middle of the HeadBar on the anchor
+    Vector2 size = bar.control->get_size();
+    bar.control->set_global_position(
+        screen_pos - Vector2(size.x * 0.5f, size.y));
+    last_frame_visible++;
+  }
+
+  if (had_drawn || !drawn_bars.empty()) {
+    queue_redraw();
+  }
+}
+
+void HeadBarRenderer::_draw() {
+  // Bars are centered on the anchor horizontally and sit right above it
+  Vector2 anchor_to_top_left = Vector2(-bar_size.x * 0.5f, -bar_size.y);
+  for (const DrawnBar& bar : drawn_bars) {
+    Vector2 top_left = bar.position + anchor_to_top_left;
+    draw_rect(Rect2(top_left, bar_size), background_color);
+    draw_rect(Rect2(top_left, Vector2(bar_size.x * bar.health_fraction,
+                                      bar_size.y)),
+              fill_color);
+  }
+}
+
+int32_t HeadBarRenderer::add_bar(Unit* unit,
+                                 const Vector3& anchor_offset,
+                                 Control* control) {
+  if (unit == nullptr) {
+    return INVALID_SLOT;
+  }
+
+  int32_t slot;
+  if (!free_slots.empty()) {
+    slot = free_slots.back();
+    free_slots.pop_back();
+  } else {
+    slot = static_cast<int32_t>(bars.size());
+    bars.emplace_back();
+  }
+
+  Bar& bar = bars[slot];
+  bar.unit = unit;
+  bar.anchor_offset = anchor_offset;
+  bar.control = control;
+  bar.health_fraction = 1.0f;
+  // Hidden until the first projection places it
+  bar.shown = false;
+  if (control != nullptr) {
+    control->set_visible(false);
+  }
+
+  bar_count++;
+  return slot;
+}
+
+void HeadBarRenderer::remove_bar(int32_t slot) {
+  if (slot < 0 || slot >= static_cast<int32_t>(bars.size()) ||
+      bars[slot].unit == nullptr) {
+    return;
+  }
+
+  bars[slot] = Bar();
+  free_slots.push_back(slot);
+  bar_count--;
+}
+
+void HeadBarRenderer::set_health(int32_t slot, float current, float max) {
+  if (slot < 0 || slot >= static_cast<int32_t>(bars.size()) ||
+      bars[slot].unit == nullptr) {
+    return;
+  }
+
+  bars[slot].health_fraction =
+      max > 0.0f ? std::clamp(current / max, 0.0f, 1.0f) : 0.0f;
+}
+
+void HeadBarRenderer::set_bar_size(const Vector2& size) {
+  bar_size = Vector2(std::max(1.0f, size.x), std::max(1.0f, size.y));
+}
+
+Vector2 HeadBarRenderer::get_bar_size() const {
+  return bar_size;
+}
+
+void HeadBarRenderer::set_fill_color(const Color& color) {
+  fill_color = color;
+}
+
+Color HeadBarRenderer::get_fill_color() const {
+  return fill_color;
+}
+
+void HeadBarRenderer::set_background_color(const Color& color) {
+  background_color = color;
+}
+
+Color HeadBarRenderer::get_background_color() const {
+  return background_color;
+}
+
+int32_t HeadBarRenderer::get_bar_count() const {
+  return bar_count;
+}
+
+int32_t HeadBarRenderer::get_last_frame_visible() const {
+  return last_frame_visible;
+}
+
+HeadBarRenderer* HeadBarRenderer::get_singleton() {
+  return singleton_instance;
+}
+
+HeadBarRenderer* HeadBarRenderer::ensure_singleton(Node* game_ui) {
+  if (singleton_instance != nullptr) {
+    return singleton_instance;
+  }
+
+  if (game_ui == nullptr) {
+    return nullptr;
+  }
+
+  HeadBarRenderer* renderer = memnew(HeadBarRenderer);
+  renderer->set_name("HeadBarRenderer");
+  game_ui->call_deferred("add_child", renderer);
+  DBG_INFO("HeadBarRenderer", "Created head bar renderer");
+  return singleton_instance;
+}
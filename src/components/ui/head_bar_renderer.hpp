@@ -0,0 +1,97 @@
+#ifndef GDEXTENSION_HEAD_BAR_RENDERER_H
+#define GDEXTENSION_HEAD_BAR_RENDERER_H
+
+#include <cstdint>
+#include <godot_cpp/classes/control.hpp>
+#include <godot_cpp/variant/color.hpp>
+#include <godot_cpp/variant/vector2.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <vector>
+
+using godot::Color;
+using godot::Control;
+using godot::Vector2;
+using godot::Vector3;
+
+class Unit;
+
+/// Positions and draws every unit head bar in one pass per frame
+/// HeadBars register their unit with a cached anchor (offset above the
+/// unit origin, measured once from the unit's mesh). Each frame the renderer
+/// fetches the camera once, projects all anchors, and culls bars behind the
+/// camera, off screen, or on hidden (pooled) units.
+///
+/// Two kinds of bars:
+/// - Full HeadBars (name label, resource bars) stay Controls; the renderer
+///   moves them and toggles visibility only when that changes
+/// - Batched HeadBars have no visible Control: their health bars are drawn
+///   as rects from this single CanvasItem's _draw
+///
+/// Lives under the GameUI CanvasLayer, covering the viewport and ignoring
+/// the mouse.
+class HeadBarRenderer : public Control {
+  GDCLASS(HeadBarRenderer, Control)
+
+ protected:
+  static void _bind_methods();
+
+  struct Bar {
+    Unit* unit = nullptr;  // nullptr = free slot
+    Vector3 anchor_offset;
+    Control* control = nullptr;  // nullptr = drawn by this renderer
+    float health_fraction = 1.0f;
+    bool shown = false;  // Visibility last applied to the control
+  };
+
+  struct DrawnBar {
+    Vector2 position;  // Bottom center on screen
+    float health_fraction = 1.0f;
+  };
+
+  std::vector<Bar> bars;
+  std::vector<int32_t> free_slots;
+  std::vector<DrawnBar> drawn_bars;  // Rebuilt every frame, reused
+  int32_t bar_count = 0;
+  int32_t last_frame_visible = 0;
+
+  Vector2 bar_size = Vector2(100, 10);
+  Color fill_color = Color(0.6f, 0.0f, 0.0f, 1.0f);
+  Color background_color = Color(0.0f, 0.0f, 0.0f, 1.0f);
+
+ public:
+  static constexpr int32_t INVALID_SLOT = -1;
+
+  HeadBarRenderer();
+  ~HeadBarRenderer();
+
+  void _ready() override;
+  void _process(double delta) override;
+  void _draw() override;
+
+  /// Register a unit's bar; control is the HeadBar to move, or nullptr to
+  /// have the renderer draw the health bar itself
+  int32_t add_bar(Unit* unit, const Vector3& anchor_offset, Control* control);
+  void remove_bar(int32_t slot);
+  void set_health(int32_t slot, float current, float max);
+
+  void set_bar_size(const Vector2& size);
+  Vector2 get_bar_size() const;
+
+  void set_fill_color(const Color& color);
+  Color get_fill_color() const;
+
+  void set_background_color(const Color& color);
+  Color get_background_color() const;
+
+  int32_t get_bar_count() const;
+  int32_t get_last_frame_visible() const;
+
+  static HeadBarRenderer* get_singleton();
+  /// Creates the renderer under game_ui (a CanvasLayer) if needed
+  static HeadBarRenderer* ensure_singleton(Node* game_ui);
+
+ private:
+  static HeadBarRenderer* singleton_instance;
+};
+
+#endif  // GDEXTENSION_HEAD_BAR_RENDERER_H
@@ -0,0 +1,59 @@
+#include "hud_clock.hpp"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/rendering_server.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+
+using godot::Engine;
+using godot::RenderingServer;
+using godot::StringName;
+
+double HudClock::elapsed = 0.0;
+double HudClock::last_delta = 0.0;
+uint64_t HudClock::last_step_frame = 0;
+bool HudClock::registered = false;
+
+float HudClock::now() {
+  double seconds = elapsed;
+
+  // Rendering runs part way into the next step, unless the last physics
+  // frame didn't step the simulation (paused tree)
+  Engine* engine = Engine::get_singleton();
+  if (!engine->is_in_physics_frame() &&
+      engine->get_physics_frames() == last_step_frame) {
+    seconds += engine->get_physics_interpolation_fraction() * last_delta;
+  }
+  return static_cast<float>(seconds);
+}
+
+void HudClock::reset() {
+  elapsed = 0.0;
+  last_delta = 0.0;
+}
+
+void HudClock::advance(double delta) {
+  elapsed += delta;
+  last_delta = delta;
+  last_step_frame = Engine::get_singleton()->get_physics_frames();
+}
+
+void HudClock::publish() {
+  ensure_registered();
+  RenderingServer::get_singleton()->global_shader_parameter_set(
+      StringName(TIME_PARAMETER), now());
+}
+
+void HudClock::ensure_registered() {
+  if (registered) {
+    return;
+  }
+
+  RenderingServer* rendering = RenderingServer::get_singleton();
+  StringName name(TIME_PARAMETER);
+  if (!rendering->global_shader_parameter_get_list().has(name)) {
+    rendering->global_shader_parameter_add(
+        name, RenderingServer::GLOBAL_VAR_TYPE_FLOAT, now());
+  }
+  registered = true;
+}
@@ -0,0 +1,46 @@
+#ifndef GDEXTENSION_HUD_CLOCK_H
+#define GDEXTENSION_HUD_CLOCK_H
+
+#include <cstdint>
+
+/// Simulation clock shared by the CPU side of the HUD and its shaders
+/// HUD shaders declare `global uniform float hud_time;` and animate from it
+/// (e.g. cooldown sweeps from a start time and duration set once), so the
+/// only per-frame cost is a single global uniform write in publish(),
+/// called by MatchManager.
+///
+/// Time is the sum of the physics deltas the simulation actually stepped
+/// (the same deltas cooldowns count down by), so the HUD stops with a paused
+/// tree and follows time_scale and frame hitches. Between ticks, now() adds
+/// the interpolation fraction of the last step so sweeps stay smooth.
+///
+/// Seconds are counted from reset() to keep float precision over a match.
+class HudClock {
+ public:
+  /// Name of the global shader uniform
+  static constexpr const char* TIME_PARAMETER = "hud_time";
+
+  /// Simulation seconds since reset(), as seen by HUD shaders
+  static float now();
+
+  /// Restart the clock (match start)
+  static void reset();
+
+  /// Add one simulation step; MatchManager calls this at TickStage::CLOCK
+  static void advance(double delta);
+
+  /// Push now() to the global uniform (once per frame)
+  static void publish();
+
+  /// Declare the global uniform if the project doesn't; HUD code calls this
+  /// before compiling a shader that reads it
+  static void ensure_registered();
+
+ private:
+  static double elapsed;            // Sum of stepped physics deltas
+  static double last_delta;         // Length of the last step
+  static uint64_t last_step_frame;  // Engine physics frame of the last step
+  static bool registered;
+};
+
+#endif  // GDEXTENSION_HUD_CLOCK_H
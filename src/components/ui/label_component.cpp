@@ -1,15 +1,11 @@
 #include "label_component.hpp"
 
-#include <godot_cpp/classes/camera3d.hpp>
-#include <godot_cpp/classes/control.hpp>
 #include <godot_cpp/classes/engine.hpp>
-#include <godot_cpp/classes/style_box_flat.hpp>
-#include <godot_cpp/classes/viewport.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/core/object.hpp>
-#include <godot_cpp/variant/color.hpp>
 
 #include "../../core/unit.hpp"
+#include "debug_label_overlay.hpp"
 
 using godot::ClassDB;
 using godot::D_METHOD;
@@ -49,41 +45,54 @@ void LabelComponent::_ready() {
     return;
   }
 
-  // Find parent Unit
-  auto parent = get_parent();
-  owner_unit = godot::Object::cast_to<Unit>(parent);
-
+  // Finds the parent Unit and follows its lifecycle
+  UnitComponent::_ready();
   if (!owner_unit) {
     return;
   }
 
-  // Get camera from viewport
-  auto viewport = get_viewport();
-  if (viewport) {
-    camera = viewport->get_camera_3d();
+  _register_label();
+}
+
+void LabelComponent::_on_lifecycle_changed(UnitLifecycle state) {
+  // Dead and reviving units still show their label (revive timer); only a
+  // pooled, hidden unit stops it
+  if (state == UnitLifecycle::DEAD || state == UnitLifecycle::REVIVING) {
+    return;
+  }
+  UnitComponent::_on_lifecycle_changed(state);
+}
+
+void LabelComponent::_enter_tree() {
+  // Back from a pool or reparent; no-op before _ready
+  _register_label();
+}
+
+void LabelComponent::_exit_tree() {
+  _unregister_label();
+}
+
+void LabelComponent::_register_label() {
+  if (!owner_unit || label_slot != DebugLabelOverlay::INVALID_SLOT) {
+    return;
+  }
+
+  DebugLabelOverlay* overlay = DebugLabelOverlay::ensure_singleton(this);
+  if (overlay == nullptr) {
+    return;
   }
+  label_slot = overlay->add_label(owner_unit, &registry, world_offset,
+                                  font_size);
+  // Fill the label right away instead of after the first interval
+  _update_label_content();
+}
 
-  // Create 2D label
-  label_2d = memnew(Label);
-  add_child(label_2d);
-
-  // Configure label
-  label_2d->set_text(String(""));
-  label_2d->set_anchor_and_offset(godot::SIDE_LEFT,
-                                  godot::Control::ANCHOR_BEGIN, 0);
-  label_2d->set_anchor_and_offset(godot::SIDE_TOP, godot::Control::ANCHOR_BEGIN,
-                                  0);
-
-  // Set font size
-  label_2d->add_theme_font_size_override(String("font_size"), font_size);
-
-  // Add background for visibility
-  auto bg = memnew(godot::StyleBoxFlat);
-  bg->set_bg_color(
-      godot::Color(0, 0, 0, 0.6f));  // Semi-transparent dark background
-  bg->set_corner_radius_all(4);      // Rounded corners
-  bg->set_content_margin_all(4);     // Padding inside
-  label_2d->add_theme_stylebox_override(String("normal"), bg);
+void LabelComponent::_unregister_label() {
+  DebugLabelOverlay* overlay = DebugLabelOverlay::get_singleton();
+  if (overlay != nullptr) {
+    overlay->remove_label(label_slot);
+  }
+  label_slot = DebugLabelOverlay::INVALID_SLOT;
 }
 
 void LabelComponent::_physics_process(double delta) {
@@ -92,7 +101,7 @@ void LabelComponent::_physics_process(double delta) {
     return;
   }
 
-  if (!owner_unit || !label_2d || !camera) {
+  if (!owner_unit || label_slot == DebugLabelOverlay::INVALID_SLOT) {
     return;
   }
 
@@ -102,41 +111,26 @@ void LabelComponent::_physics_process(double delta) {
   if (accumulated_time >= update_interval) {
     accumulated_time -= update_interval;
     _update_label_content();
-    _update_label_position();
   }
 }
 
 void LabelComponent::_update_label_content() {
-  if (!owner_unit || !label_2d) {
+  if (!owner_unit) {
     return;
   }
 
-  // Clear registry and collect debug info from all components
-  registry.clear();
+  // Collect debug info from all components; unchanged values keep the
+  // registry clean
+  registry.begin_update();
   owner_unit->register_all_debug_labels(&registry);
+  registry.end_update();
 
-  // Update label text
-  label_2d->set_text(registry.get_formatted_text());
-}
-
-void LabelComponent::_update_label_position() {
-  if (!owner_unit || !label_2d || !camera) {
-    return;
+  if (registry.consume_dirty()) {
+    DebugLabelOverlay* overlay = DebugLabelOverlay::get_singleton();
+    if (overlay != nullptr) {
+      overlay->mark_dirty(label_slot);
+    }
   }
-
-  // Get world position of label (above unit)
-  Vector3 world_pos = owner_unit->get_global_position() + world_offset;
-
-  // Convert world position to screen position
-  Vector2 screen_pos = camera->unproject_position(world_pos);
-
-  // Set label position on screen
-  label_2d->set_global_position(screen_pos);
-
-  // Center the label on the screen position
-  Vector2 label_size = label_2d->get_size();
-  label_2d->set_global_position(screen_pos -
-                                label_size / 2);  // Center on world position
 }
 
 void LabelComponent::set_update_rate(float rate) {
@@ -149,6 +143,10 @@ float LabelComponent::get_update_rate() const {
 
 void LabelComponent::set_label_offset(const Vector3& offset) {
   world_offset = offset;
+  DebugLabelOverlay* overlay = DebugLabelOverlay::get_singleton();
+  if (overlay != nullptr) {
+    overlay->set_label_offset(label_slot, world_offset);
+  }
 }
 
 Vector3 LabelComponent::get_label_offset() const {
@@ -157,8 +155,9 @@ Vector3 LabelComponent::get_label_offset() const {
 
 void LabelComponent::set_font_size(int size) {
   font_size = size > 8 ? size : 8;
-  if (label_2d) {
-    label_2d->add_theme_font_size_override(String("font_size"), font_size);
+  DebugLabelOverlay* overlay = DebugLabelOverlay::get_singleton();
+  if (overlay != nullptr) {
+    overlay->set_label_font_size(label_slot, font_size);
   }
 }
 
@@ -1,35 +1,39 @@
 #ifndef GDEXTENSION_LABEL_COMPONENT_H
 #define GDEXTENSION_LABEL_COMPONENT_H
 
-#include <godot_cpp/classes/camera3d.hpp>
-#include <godot_cpp/classes/label.hpp>
-#include <godot_cpp/classes/node.hpp>
-#include <godot_cpp/variant/vector2.hpp>
+#include <cstdint>
 #include <godot_cpp/variant/vector3.hpp>
 
+#include "../unit_component.hpp"
 #include "label_registry.hpp"
 
-using godot::Camera3D;
-using godot::Label;
-using godot::Node;
-using godot::Vector2;
 using godot::Vector3;
 
-class Unit;
-
 /// 2D label component for displaying unit debug information
-/// Tracks unit position on screen and displays as 2D label
-class LabelComponent : public Node {
-  GDCLASS(LabelComponent, Node)
+/// Collects the unit's debug properties into a LabelRegistry at update_rate
+/// and hands it to the DebugLabelOverlay, which positions and draws every
+/// unit's label in one pass. The overlay only re-reads the text when a
+/// value actually changed.
+///
+/// A label never keeps its unit awake (is_idle stays true), so
+/// ActivitySystem suspends it with the other components while the unit
+/// sleeps.
+class LabelComponent : public UnitComponent {
+  GDCLASS(LabelComponent, UnitComponent)
 
  protected:
   static void _bind_methods();
 
+  // Keeps ticking while dead or reviving, so the label shows it
+  void _on_lifecycle_changed(UnitLifecycle state) override;
+
  public:
   LabelComponent();
   ~LabelComponent() = default;
 
   void _ready() override;
+  void _enter_tree() override;
+  void _exit_tree() override;
   void _physics_process(double delta) override;
 
   // Properties
@@ -43,14 +47,13 @@ class LabelComponent : public Node {
   int get_font_size() const;
 
  private:
-  // Update label content and positioning
+  // Update label content; the overlay handles positioning
   void _update_label_content();
-  void _update_label_position();
+  void _register_label();
+  void _unregister_label();
 
-  Unit* owner_unit = nullptr;
-  Camera3D* camera = nullptr;
-  Label* label_2d = nullptr;
   LabelRegistry registry;
+  int32_t label_slot = -1;  // DebugLabelOverlay slot
 
   // Configuration
   float update_rate = 10.0f;                   // Updates per second
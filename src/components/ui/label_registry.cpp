@@ -1,32 +1,150 @@
 #include "label_registry.hpp"
 
-void LabelRegistry::register_property(const String& component_name,
-                                      const String& key,
+#include <cstring>
+
+#include "../../debug/debug_utils.hpp"
+
+bool LabelRegistry::_same(const char* a, const char* b) {
+  // Literals are usually pooled, so the pointer check settles most calls
+  return a == b || std::strcmp(a, b) == 0;
+}
+
+void LabelRegistry::_mark_changed() {
+  dirty = true;
+  text_stale = true;
+}
+
+LabelRegistry::RegistryEntry& LabelRegistry::_entry_at_cursor(
+    const char* component_name,
+    const char* key) {
+  // Same layout as last update: reuse the entry in this position
+  if (cursor < entries.size()) {
+    RegistryEntry& entry = entries[cursor];
+    if (_same(entry.key, key) &&
+        _same(entry.component_name, component_name)) {
+      cursor++;
+      return entry;
+    }
+    // Layout changed (e.g. a property only shown in some states)
+    entries.resize(cursor);
+  }
+
+  RegistryEntry entry;
+  entry.component_name = component_name;
+  entry.key = key;
+  entries.push_back(entry);
+  cursor++;
+  _mark_changed();
+  return entries.back();
+}
+
+void LabelRegistry::begin_update() {
+  cursor = 0;
+}
+
+void LabelRegistry::end_update() {
+  if (cursor < entries.size()) {
+    entries.resize(cursor);
+    _mark_changed();
+  }
+}
+
+void LabelRegistry::register_property(const char* component_name,
+                                      const char* key,
+                                      const char* value) {
+  RegistryEntry& entry = _entry_at_cursor(component_name, key);
+  if (entry.kind == ValueKind::LITERAL && entry.literal != nullptr &&
+      _same(entry.literal, value)) {
+    return;
+  }
+
+  entry.literal = value;
+  entry.kind = ValueKind::LITERAL;
+  _mark_changed();
+}
+
+void LabelRegistry::register_property(const char* component_name,
+                                      const char* key,
                                       const String& value) {
-  entries.push_back({component_name, key, value});
+  RegistryEntry& entry = _entry_at_cursor(component_name, key);
+  if (entry.kind == ValueKind::TEXT && entry.text == value) {
+    return;
+  }
+
+  entry.text = value;
+  entry.kind = ValueKind::TEXT;
+  _mark_changed();
+}
+
+void LabelRegistry::register_property(const char* component_name,
+                                      const char* key,
+                                      double value,
+                                      int32_t decimals) {
+  RegistryEntry& entry = _entry_at_cursor(component_name, key);
+  if (entry.kind == ValueKind::NUMBER && entry.number == value &&
+      entry.decimals == decimals) {
+    return;
+  }
+
+  entry.number = value;
+  entry.decimals = decimals;
+  entry.kind = ValueKind::NUMBER;
+  _mark_changed();
+}
+
+void LabelRegistry::register_property(const char* component_name,
+                                      const char* key,
+                                      const Vector3& value) {
+  RegistryEntry& entry = _entry_at_cursor(component_name, key);
+  if (entry.kind == ValueKind::VECTOR && entry.vector == value) {
+    return;
+  }
+
+  entry.vector = value;
+  entry.kind = ValueKind::VECTOR;
+  _mark_changed();
 }
 
 void LabelRegistry::clear() {
   entries.clear();
+  cursor = 0;
+  _mark_changed();
+}
+
+bool LabelRegistry::is_dirty() const {
+  return dirty;
+}
+
+bool LabelRegistry::consume_dirty() {
+  bool was_dirty = dirty;
+  dirty = false;
+  return was_dirty;
 }
 
 String LabelRegistry::get_formatted_text() const {
+  if (!text_stale) {
+    return formatted_text;
+  }
+  text_stale = false;
+  formatted_text = String();
+
   if (entries.empty()) {
-    return String();
+    return formatted_text;
   }
 
   String result;
-  String current_component;
+  const char* current_component = nullptr;
 
   for (size_t i = 0; i < entries.size(); ++i) {
     const auto& entry = entries[i];
 
     // Start new line if component changed
-    if (entry.component_name != current_component) {
+    if (current_component == nullptr ||
+        !_same(entry.component_name, current_component)) {
       if (i > 0) {
         result += String("\n");
       }
-      result += String("[") + entry.component_name + String("] ");
+      result += String("[") + String(entry.component_name) + String("] ");
       current_component = entry.component_name;
     } else {
       // Add comma separator between properties of same component
@@ -34,8 +152,25 @@ String LabelRegistry::get_formatted_text() const {
     }
 
     // Add key=value pair
-    result += entry.key + String("=") + entry.value;
+    String value;
+    switch (entry.kind) {
+      case ValueKind::TEXT:
+        value = entry.text;
+        break;
+      case ValueKind::LITERAL:
+        value = String(entry.literal);
+        break;
+      case ValueKind::NUMBER:
+        value = entry.decimals < 0 ? String::num(entry.number)
+                                   : String::num(entry.number, entry.decimals);
+        break;
+      case ValueKind::VECTOR:
+        value = DebugUtils::vector3_to_compact_string(entry.vector);
+        break;
+    }
+    result += String(entry.key) + String("=") + value;
   }
 
-  return result;
+  formatted_text = result;
+  return formatted_text;
 }
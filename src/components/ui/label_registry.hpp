@@ -1,36 +1,95 @@
 #ifndef GDEXTENSION_LABEL_REGISTRY_H
 #define GDEXTENSION_LABEL_REGISTRY_H
 
+#include <cstdint>
 #include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/vector3.hpp>
 #include <vector>
 
 using godot::String;
+using godot::Vector3;
 
 /// Registry for collecting debug label data from components
 /// Components register properties and this formats them for display
+///
+/// Entries persist between updates. An update is bracketed by
+/// begin_update()/end_update(), and components register their properties
+/// in the same order every time, so each call only compares against the
+/// entry already in its position. Unchanged values leave the registry
+/// clean.
+///
+/// Component names, keys and literal values are string literals, kept as
+/// pointers and compared without building a String. Numbers and vectors
+/// are stored raw; nothing is turned into text until the formatted text is
+/// next read (at draw time) after an entry changed.
 class LabelRegistry {
  private:
+  enum class ValueKind : uint8_t { TEXT, LITERAL, NUMBER, VECTOR };
+
   struct RegistryEntry {
-    String component_name;
-    String key;
-    String value;
+    const char* component_name = nullptr;
+    const char* key = nullptr;
+    ValueKind kind = ValueKind::LITERAL;
+    String text;                    // TEXT values
+    const char* literal = nullptr;  // LITERAL values
+    double number = 0.0;            // NUMBER values
+    int32_t decimals = -1;
+    Vector3 vector;  // VECTOR values
   };
 
   std::vector<RegistryEntry> entries;
+  size_t cursor = 0;  // Next entry position during an update
+  bool dirty = false;
+  mutable String formatted_text;  // Cache, rebuilt when dirty
+  mutable bool text_stale = false;
+
+  RegistryEntry& _entry_at_cursor(const char* component_name,
+                                  const char* key);
+  void _mark_changed();
+  static bool _same(const char* a, const char* b);
 
  public:
   LabelRegistry() = default;
   ~LabelRegistry() = default;
 
+  /// Start an update; registrations are matched in order from here
+  void begin_update();
+
+  /// Finish an update, dropping entries that were not registered this time
+  void end_update();
+
   /// Register a property to be displayed
-  /// Example: register_property("Health", "current", "85")
-  void register_property(const String& component_name,
-                         const String& key,
+  /// component_name, key and literal values must outlive the registry
+  /// (string literals). Example: register_property("Health", "status",
+  /// "ALIVE")
+  void register_property(const char* component_name,
+                         const char* key,
+                         const char* value);
+
+  /// Register a runtime text value (e.g. a unit name)
+  void register_property(const char* component_name,
+                         const char* key,
                          const String& value);
 
-  /// Clear all entries (called at start of each update frame)
+  /// Register a numeric property; decimals < 0 uses String::num's default
+  /// Example: register_property("Health", "current", 85.0)
+  void register_property(const char* component_name,
+                         const char* key,
+                         double value,
+                         int32_t decimals = -1);
+
+  /// Register a position, shown as (x,y,z)
+  void register_property(const char* component_name,
+                         const char* key,
+                         const Vector3& value);
+
+  /// Clear all entries
   void clear();
 
+  /// True when a value changed since the last consume_dirty()
+  bool is_dirty() const;
+  bool consume_dirty();
+
   /// Get formatted text for display
   /// Returns multi-line string with format: [ComponentName] key1=value1,
   /// key2=value2
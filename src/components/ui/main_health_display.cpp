@@ -45,24 +45,7 @@ void MainHealthDisplay::_ready() {
     return;
   }
 
-  // Find MatchManager in scene root
-  Node* current = this;
-  Node* scene_root = nullptr;
-
-  while (current && current->get_parent()) {
-    scene_root = current;
-    current = current->get_parent();
-  }
-
-  MatchManager* match_manager = nullptr;
-  if (scene_root) {
-    for (int i = 0; i < scene_root->get_child_count(); i++) {
-      match_manager = Object::cast_to<MatchManager>(scene_root->get_child(i));
-      if (match_manager) {
-        break;
-      }
-    }
-  }
+  MatchManager* match_manager = MatchManager::get_singleton();
 
   if (!match_manager) {
     DBG_WARN("MainHealthDisplay", "MatchManager not found in scene");
@@ -106,7 +89,7 @@ void MainHealthDisplay::_ready() {
 
   // Initialize display with current health
   _on_health_changed(health_component->get_current_health(),
-                     health_component->get_max_health());
+                     health_component->get_effective_max_health());
 
   DBG_INFO("MainHealthDisplay", "Initialized for main unit");
 }
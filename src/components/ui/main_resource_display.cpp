@@ -52,24 +52,7 @@ void MainResourceDisplay::_ready() {
     return;
   }
 
-  // Find MatchManager in scene root
-  Node* current = this;
-  Node* scene_root = nullptr;
-
-  while (current && current->get_parent()) {
-    scene_root = current;
-    current = current->get_parent();
-  }
-
-  MatchManager* match_manager = nullptr;
-  if (scene_root) {
-    for (int i = 0; i < scene_root->get_child_count(); i++) {
-      match_manager = Object::cast_to<MatchManager>(scene_root->get_child(i));
-      if (match_manager) {
-        break;
-      }
-    }
-  }
+  MatchManager* match_manager = MatchManager::get_singleton();
 
   if (!match_manager) {
     DBG_WARN("MainResourceDisplay", "MatchManager not found in scene");
@@ -2,14 +2,19 @@
 
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/callable.hpp>
+#include <godot_cpp/variant/string_name.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
+#include "../common/unit_signals.hpp"
 #include "../core/unit.hpp"
 
+using godot::Callable;
 using godot::ClassDB;
 using godot::D_METHOD;
 using godot::Engine;
 using godot::String;
+using godot::StringName;
 using godot::UtilityFunctions;
 
 UnitComponent::UnitComponent() = default;
@@ -18,6 +23,9 @@ UnitComponent::~UnitComponent() = default;
 
 void UnitComponent::_bind_methods() {
   ClassDB::bind_method(D_METHOD("get_unit"), &UnitComponent::get_unit);
+
+  ClassDB::bind_method(D_METHOD("_on_owner_lifecycle_changed", "state"),
+                       &UnitComponent::_on_owner_lifecycle_changed);
 }
 
 void UnitComponent::_ready() {
@@ -33,9 +41,46 @@ void UnitComponent::_ready() {
     UtilityFunctions::push_error(
         "[" + get_class() + "] must be a child of Unit, but parent is: " +
         (parent != nullptr ? parent->get_class() : String("null")));
+    return;
   }
+
+  owner_unit->register_signal(lifecycle_changed);
+  owner_unit->connect(
+      lifecycle_changed,
+      Callable(this, StringName("_on_owner_lifecycle_changed")));
 }
 
 Unit* UnitComponent::get_unit() const {
   return owner_unit;
 }
+
+float UnitComponent::_get_stat(Stat stat, float base_value) const {
+  if (owner_unit == nullptr) {
+    return base_value;
+  }
+  return owner_unit->get_stats().get(stat);
+}
+
+void UnitComponent::_set_base_stat(Stat stat, float base_value) {
+  if (owner_unit != nullptr) {
+    owner_unit->set_base_stat(stat, base_value);
+  }
+}
+
+void UnitComponent::_on_lifecycle_changed(UnitLifecycle state) {
+  bool alive = state == UnitLifecycle::ALIVE;
+  if (!alive && !lifecycle_suspended) {
+    lifecycle_suspended = true;
+    resume_processing = is_physics_processing();
+    set_physics_process(false);
+  } else if (alive && lifecycle_suspended) {
+    lifecycle_suspended = false;
+    if (resume_processing) {
+      set_physics_process(true);
+    }
+  }
+}
+
+void UnitComponent::_on_owner_lifecycle_changed(int state) {
+  _on_lifecycle_changed(static_cast<UnitLifecycle>(state));
+}
@@ -3,6 +3,9 @@
 
 #include <godot_cpp/classes/node.hpp>
 
+#include "../common/unit_lifecycle.hpp"
+#include "../core/stat_block.hpp"
+
 using godot::Node;
 
 class Unit;
@@ -16,6 +19,25 @@ class UnitComponent : public Node {
 
   Unit* owner_unit = nullptr;
 
+  // Final (modified) value of a stat from the owner's StatBlock, or
+  // base_value before the component is wired to its Unit
+  float _get_stat(Stat stat, float base_value) const;
+
+  // Push a base value (exported property) to the owner's StatBlock
+  void _set_base_stat(Stat stat, float base_value);
+
+  // Called on every lifecycle change of the owner. Default: suspend physics
+  // processing outside ALIVE and resume it (if it was on) once alive again.
+  // Overrides reset per-life state or keep ticking (revive countdown)
+  virtual void _on_lifecycle_changed(UnitLifecycle state);
+
+  // Signal handler for lifecycle_changed relay signal from Unit
+  void _on_owner_lifecycle_changed(int state);
+
+ private:
+  bool lifecycle_suspended = false;
+  bool resume_processing = false;
+
  public:
   UnitComponent();
   ~UnitComponent();
@@ -29,6 +51,13 @@ class UnitComponent : public Node {
   virtual void register_debug_labels(LabelRegistry* registry) {
     // Default: do nothing
   }
+
+  /// Optional: Report pending work (orders, timers) that needs ticking.
+  /// ActivitySystem only puts a unit to sleep once every component is idle.
+  virtual bool is_idle() const { return true; }
+
+  /// Optional: Enemies closer than this wake the unit from sleep
+  virtual float get_wake_radius() const { return 0.0f; }
 };
 
 #endif  // GDEXTENSION_UNIT_COMPONENT_H
@@ -0,0 +1,114 @@
+#include "faction_table.hpp"
+
+#include "../common/allegiance.hpp"
+#include "unit.hpp"
+
+namespace {
+// Default table: every faction is its own team and hostile to all others
+std::array<int32_t, FactionTable::MAX_FACTIONS> default_teams() {
+  std::array<int32_t, FactionTable::MAX_FACTIONS> teams{};
+  for (int32_t faction = 0; faction < FactionTable::MAX_FACTIONS; faction++) {
+    teams[faction] = faction;
+  }
+  return teams;
+}
+
+std::array<uint32_t, FactionTable::MAX_FACTIONS> default_masks(bool allies) {
+  std::array<uint32_t, FactionTable::MAX_FACTIONS> masks{};
+  for (int32_t faction = 0; faction < FactionTable::MAX_FACTIONS; faction++) {
+    uint32_t own = 1u << faction;
+    masks[faction] = allies ? own : FactionTable::ALL_FACTIONS & ~own;
+  }
+  return masks;
+}
+}  // namespace
+
+std::array<int32_t, FactionTable::MAX_FACTIONS> FactionTable::team_of =
+    default_teams();
+uint32_t FactionTable::neutral_factions = 0;
+std::array<uint32_t, FactionTable::MAX_FACTIONS> FactionTable::ally_masks =
+    default_masks(true);
+std::array<uint32_t, FactionTable::MAX_FACTIONS> FactionTable::enemy_masks =
+    default_masks(false);
+std::array<uint32_t, FactionTable::MAX_FACTIONS> FactionTable::neutral_masks{};
+
+void FactionTable::set_team(int32_t faction_id, int32_t team_id) {
+  team_of[clamp_faction(faction_id)] = team_id;
+  _rebuild();
+}
+
+int32_t FactionTable::get_team(int32_t faction_id) {
+  return team_of[clamp_faction(faction_id)];
+}
+
+void FactionTable::set_neutral(int32_t faction_id, bool neutral) {
+  if (neutral) {
+    neutral_factions |= faction_bit(faction_id);
+  } else {
+    neutral_factions &= ~faction_bit(faction_id);
+  }
+  _rebuild();
+}
+
+bool FactionTable::is_neutral(int32_t faction_id) {
+  return (neutral_factions & faction_bit(faction_id)) != 0;
+}
+
+void FactionTable::reset() {
+  team_of = default_teams();
+  neutral_factions = 0;
+  _rebuild();
+}
+
+uint32_t FactionTable::get_faction_mask(int32_t faction_id,
+                                        uint32_t allegiance) {
+  int32_t faction = clamp_faction(faction_id);
+  uint32_t mask = 0;
+  if ((allegiance & (Allegiance::SELF | Allegiance::ALLY)) != 0) {
+    mask |= ally_masks[faction];
+  }
+  if ((allegiance & Allegiance::ENEMY) != 0) {
+    mask |= enemy_masks[faction];
+  }
+  if ((allegiance & Allegiance::NEUTRAL) != 0) {
+    mask |= neutral_masks[faction];
+  }
+  return mask;
+}
+
+uint32_t FactionTable::classify(const Unit* reference, const Unit* other) {
+  if (reference == other) {
+    return Allegiance::SELF;
+  }
+
+  int32_t faction = clamp_faction(reference->get_faction_id());
+  uint32_t other_bit = faction_bit(other->get_faction_id());
+  if ((ally_masks[faction] & other_bit) != 0) {
+    return Allegiance::ALLY;
+  }
+  if ((enemy_masks[faction] & other_bit) != 0) {
+    return Allegiance::ENEMY;
+  }
+  return Allegiance::NEUTRAL;
+}
+
+void FactionTable::_rebuild() {
+  for (int32_t faction = 0; faction < MAX_FACTIONS; faction++) {
+    uint32_t allies = 0;
+    for (int32_t other = 0; other < MAX_FACTIONS; other++) {
+      if (team_of[other] == team_of[faction]) {
+        allies |= 1u << other;
+      }
+    }
+
+    // Neutral factions see every other team as neutral, and are seen as
+    // neutral by them
+    uint32_t neutrals = (neutral_factions & (1u << faction)) != 0
+                            ? ALL_FACTIONS & ~allies
+                            : neutral_factions & ~allies;
+
+    ally_masks[faction] = allies;
+    neutral_masks[faction] = neutrals;
+    enemy_masks[faction] = ALL_FACTIONS & ~allies & ~neutrals;
+  }
+}
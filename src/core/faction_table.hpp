@@ -0,0 +1,73 @@
+#ifndef GDEXTENSION_FACTION_TABLE_H
+#define GDEXTENSION_FACTION_TABLE_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+class Unit;
+
+/// Faction and team relationships, stored as per-faction bitmasks
+/// Bit f of a mask stands for faction_id f. Factions on the same team are
+/// allies; a faction marked neutral is neither ally nor enemy of any other
+/// team. By default every faction is its own team, so different faction_ids
+/// are enemies (player units use 0, enemy units 1).
+///
+/// Masks are rebuilt when a relationship changes, so every lookup is a
+/// single AND. Queries turn an Allegiance filter into a faction mask once and
+/// skip whole factions (see UnitIndex buckets) before any distance math.
+class FactionTable {
+ public:
+  static constexpr int32_t MAX_FACTIONS = 16;
+  static constexpr uint32_t ALL_FACTIONS = (1u << MAX_FACTIONS) - 1;
+
+  static void set_team(int32_t faction_id, int32_t team_id);
+  static int32_t get_team(int32_t faction_id);
+
+  static void set_neutral(int32_t faction_id, bool neutral);
+  static bool is_neutral(int32_t faction_id);
+
+  /// Back to one team per faction, no neutrals
+  static void reset();
+
+  /// faction_ids outside [0, MAX_FACTIONS) share the nearest valid bucket
+  static int32_t clamp_faction(int32_t faction_id) {
+    return std::clamp(faction_id, 0, MAX_FACTIONS - 1);
+  }
+
+  static uint32_t faction_bit(int32_t faction_id) {
+    return 1u << clamp_faction(faction_id);
+  }
+
+  /// Factions holding any of the Allegiance bits toward faction_id
+  /// SELF maps to the own faction; telling a unit apart from its allies is
+  /// up to the caller.
+  static uint32_t get_faction_mask(int32_t faction_id, uint32_t allegiance);
+
+  /// Allegiance bit of other as seen from reference (both non-null)
+  static uint32_t classify(const Unit* reference, const Unit* other);
+
+  static bool matches(const Unit* reference,
+                      const Unit* other,
+                      uint32_t allegiance) {
+    return (classify(reference, other) & allegiance) != 0;
+  }
+
+  static bool are_enemies(int32_t faction_a, int32_t faction_b) {
+    return (enemy_masks[clamp_faction(faction_a)] & faction_bit(faction_b)) !=
+           0;
+  }
+
+ private:
+  static void _rebuild();
+
+  static std::array<int32_t, MAX_FACTIONS> team_of;
+  static uint32_t neutral_factions;
+
+  // Derived, indexed by faction
+  static std::array<uint32_t, MAX_FACTIONS> ally_masks;
+  static std::array<uint32_t, MAX_FACTIONS> enemy_masks;
+  static std::array<uint32_t, MAX_FACTIONS> neutral_masks;
+};
+
+#endif  // GDEXTENSION_FACTION_TABLE_H
@@ -68,6 +68,161 @@ CastingMode GameSettings::get_casting_mode_enum() {
   return static_cast<CastingMode>(get_casting_mode());
 }
 
+bool GameSettings::get_movement_lod_enabled() {
+  ProjectSettings* settings = ProjectSettings::get_singleton();
+  if (settings == nullptr ||
+      !settings->has_setting(SETTING_MOVEMENT_LOD_ENABLED)) {
+    return true;  // Default to enabled
+  }
+
+  godot::Variant value = settings->get_setting(SETTING_MOVEMENT_LOD_ENABLED);
+  return value.operator bool();
+}
+
+void GameSettings::set_movement_lod_enabled(bool value) {
+  ProjectSettings* settings = ProjectSettings::get_singleton();
+  if (settings == nullptr) {
+    godot::print_error("[GameSettings] ProjectSettings unavailable");
+    return;
+  }
+
+  settings->set_setting(SETTING_MOVEMENT_LOD_ENABLED, value);
+  DBG_INFO("GameSettings", "Movement LOD enabled: " +
+                               godot::String(value ? "true" : "false"));
+}
+
+PackedFloat32Array GameSettings::get_movement_lod_tier_distances() {
+  ProjectSettings* settings = ProjectSettings::get_singleton();
+  if (settings == nullptr ||
+      !settings->has_setting(SETTING_MOVEMENT_LOD_TIER_DISTANCES)) {
+    return _default_movement_lod_tier_distances();
+  }
+
+  return settings->get_setting(SETTING_MOVEMENT_LOD_TIER_DISTANCES);
+}
+
+void GameSettings::set_movement_lod_tier_distances(
+    const PackedFloat32Array& value) {
+  ProjectSettings* settings = ProjectSettings::get_singleton();
+  if (settings == nullptr) {
+    godot::print_error("[GameSettings] ProjectSettings unavailable");
+    return;
+  }
+
+  settings->set_setting(SETTING_MOVEMENT_LOD_TIER_DISTANCES, value);
+  DBG_INFO("GameSettings", "Movement LOD tier distances updated (" +
+                               godot::String::num(value.size()) + " tiers)");
+}
+
+PackedInt32Array GameSettings::get_movement_lod_tier_intervals() {
+  ProjectSettings* settings = ProjectSettings::get_singleton();
+  if (settings == nullptr ||
+      !settings->has_setting(SETTING_MOVEMENT_LOD_TIER_INTERVALS)) {
+    return _default_movement_lod_tier_intervals();
+  }
+
+  return settings->get_setting(SETTING_MOVEMENT_LOD_TIER_INTERVALS);
+}
+
+void GameSettings::set_movement_lod_tier_intervals(
+    const PackedInt32Array& value) {
+  ProjectSettings* settings = ProjectSettings::get_singleton();
+  if (settings == nullptr) {
+    godot::print_error("[GameSettings] ProjectSettings unavailable");
+    return;
+  }
+
+  settings->set_setting(SETTING_MOVEMENT_LOD_TIER_INTERVALS, value);
+  DBG_INFO("GameSettings", "Movement LOD tier intervals updated (" +
+                               godot::String::num(value.size()) + " entries)");
+}
+
+int GameSettings::get_simulation_tick_rate() {
+  ProjectSettings* settings = ProjectSettings::get_singleton();
+  if (settings == nullptr ||
+      !settings->has_setting(SETTING_SIMULATION_TICK_RATE)) {
+    return DEFAULT_SIMULATION_TICK_RATE;
+  }
+
+  godot::Variant value = settings->get_setting(SETTING_SIMULATION_TICK_RATE);
+  return value.operator int();
+}
+
+void GameSettings::set_simulation_tick_rate(int ticks_per_second) {
+  ProjectSettings* settings = ProjectSettings::get_singleton();
+  if (settings == nullptr) {
+    godot::print_error("[GameSettings] ProjectSettings unavailable");
+    return;
+  }
+
+  settings->set_setting(SETTING_SIMULATION_TICK_RATE, ticks_per_second);
+  DBG_INFO("GameSettings", "Simulation tick rate set to: " +
+                               godot::String::num_int64(ticks_per_second));
+}
+
+int GameSettings::get_simulation_server_tick_rate() {
+  ProjectSettings* settings = ProjectSettings::get_singleton();
+  if (settings == nullptr ||
+      !settings->has_setting(SETTING_SIMULATION_SERVER_TICK_RATE)) {
+    return DEFAULT_SIMULATION_SERVER_TICK_RATE;
+  }
+
+  godot::Variant value =
+      settings->get_setting(SETTING_SIMULATION_SERVER_TICK_RATE);
+  return value.operator int();
+}
+
+void GameSettings::set_simulation_server_tick_rate(int ticks_per_second) {
+  ProjectSettings* settings = ProjectSettings::get_singleton();
+  if (settings == nullptr) {
+    godot::print_error("[GameSettings] ProjectSettings unavailable");
+    return;
+  }
+
+  settings->set_setting(SETTING_SIMULATION_SERVER_TICK_RATE, ticks_per_second);
+  DBG_INFO("GameSettings", "Simulation server tick rate set to: " +
+                               godot::String::num_int64(ticks_per_second));
+}
+
+bool GameSettings::get_simulation_interpolate_rendering() {
+  ProjectSettings* settings = ProjectSettings::get_singleton();
+  if (settings == nullptr ||
+      !settings->has_setting(SETTING_SIMULATION_INTERPOLATE_RENDERING)) {
+    return true;  // Default to smooth rendering between ticks
+  }
+
+  godot::Variant value =
+      settings->get_setting(SETTING_SIMULATION_INTERPOLATE_RENDERING);
+  return value.operator bool();
+}
+
+void GameSettings::set_simulation_interpolate_rendering(bool value) {
+  ProjectSettings* settings = ProjectSettings::get_singleton();
+  if (settings == nullptr) {
+    godot::print_error("[GameSettings] ProjectSettings unavailable");
+    return;
+  }
+
+  settings->set_setting(SETTING_SIMULATION_INTERPOLATE_RENDERING, value);
+  DBG_INFO("GameSettings", "Simulation render interpolation: " +
+                               godot::String(value ? "true" : "false"));
+}
+
+PackedFloat32Array GameSettings::_default_movement_lod_tier_distances() {
+  PackedFloat32Array distances;
+  distances.push_back(40.0f);  // Just off-screen
+  distances.push_back(80.0f);  // Across the map
+  return distances;
+}
+
+PackedInt32Array GameSettings::_default_movement_lod_tier_intervals() {
+  PackedInt32Array intervals;
+  intervals.push_back(2);  // Off-screen, within 40m of the camera
+  intervals.push_back(4);  // Off-screen, within 80m
+  intervals.push_back(8);  // Off-screen, beyond 80m
+  return intervals;
+}
+
 void GameSettings::register_settings() {
   ProjectSettings* settings = ProjectSettings::get_singleton();
   if (settings == nullptr) {
@@ -89,4 +244,32 @@ void GameSettings::register_settings() {
                           static_cast<int>(CastingMode::CLICK_TO_CAST));
     DBG_INFO("GameSettings", "Registered casting_mode = CLICK_TO_CAST");
   }
+
+  // Register movement LOD tiers with default values
+  if (!settings->has_setting(SETTING_MOVEMENT_LOD_ENABLED)) {
+    settings->set_setting(SETTING_MOVEMENT_LOD_ENABLED, true);
+  }
+  if (!settings->has_setting(SETTING_MOVEMENT_LOD_TIER_DISTANCES)) {
+    settings->set_setting(SETTING_MOVEMENT_LOD_TIER_DISTANCES,
+                          _default_movement_lod_tier_distances());
+  }
+  if (!settings->has_setting(SETTING_MOVEMENT_LOD_TIER_INTERVALS)) {
+    settings->set_setting(SETTING_MOVEMENT_LOD_TIER_INTERVALS,
+                          _default_movement_lod_tier_intervals());
+    DBG_INFO("GameSettings", "Registered movement LOD tiers");
+  }
+
+  // Register simulation clock with default values
+  if (!settings->has_setting(SETTING_SIMULATION_TICK_RATE)) {
+    settings->set_setting(SETTING_SIMULATION_TICK_RATE,
+                          DEFAULT_SIMULATION_TICK_RATE);
+  }
+  if (!settings->has_setting(SETTING_SIMULATION_SERVER_TICK_RATE)) {
+    settings->set_setting(SETTING_SIMULATION_SERVER_TICK_RATE,
+                          DEFAULT_SIMULATION_SERVER_TICK_RATE);
+  }
+  if (!settings->has_setting(SETTING_SIMULATION_INTERPOLATE_RENDERING)) {
+    settings->set_setting(SETTING_SIMULATION_INTERPOLATE_RENDERING, true);
+    DBG_INFO("GameSettings", "Registered simulation clock settings");
+  }
 }
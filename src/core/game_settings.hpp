@@ -2,10 +2,14 @@
 #define GDEXTENSION_GAME_SETTINGS_H
 
 #include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
 
 #include "../common/casting_mode.hpp"
 
 using godot::Node;
+using godot::PackedFloat32Array;
+using godot::PackedInt32Array;
 
 /// Game settings manager using Godot's ProjectSettings
 /// Provides centralized access to game configuration
@@ -21,6 +25,28 @@ class GameSettings {
   static void set_casting_mode(int mode);
   static CastingMode get_casting_mode_enum();
 
+  // Movement LOD settings
+  // tier_distances: off-screen camera distance thresholds (ascending)
+  // tier_intervals: physics ticks between full movement updates, one entry per
+  // tier plus a final entry for units beyond the last distance threshold
+  static bool get_movement_lod_enabled();
+  static void set_movement_lod_enabled(bool value);
+  static PackedFloat32Array get_movement_lod_tier_distances();
+  static void set_movement_lod_tier_distances(const PackedFloat32Array& value);
+  static PackedInt32Array get_movement_lod_tier_intervals();
+  static void set_movement_lod_tier_intervals(const PackedInt32Array& value);
+
+  // Simulation clock settings
+  // tick_rate: fixed simulation ticks per second on clients
+  // server_tick_rate: tick rate used by headless/dedicated server builds
+  // interpolate_rendering: render transforms between simulation ticks
+  static int get_simulation_tick_rate();
+  static void set_simulation_tick_rate(int ticks_per_second);
+  static int get_simulation_server_tick_rate();
+  static void set_simulation_server_tick_rate(int ticks_per_second);
+  static bool get_simulation_interpolate_rendering();
+  static void set_simulation_interpolate_rendering(bool value);
+
   // Register default settings with ProjectSettings
   static void register_settings();
 
@@ -30,6 +56,24 @@ class GameSettings {
       "gameplay/abilities/channel_requires_stop_command_only";
   static constexpr const char* SETTING_CASTING_MODE =
       "gameplay/abilities/casting_mode";
+  static constexpr const char* SETTING_MOVEMENT_LOD_ENABLED =
+      "gameplay/movement_lod/enabled";
+  static constexpr const char* SETTING_MOVEMENT_LOD_TIER_DISTANCES =
+      "gameplay/movement_lod/tier_distances";
+  static constexpr const char* SETTING_MOVEMENT_LOD_TIER_INTERVALS =
+      "gameplay/movement_lod/tier_intervals";
+  static constexpr const char* SETTING_SIMULATION_TICK_RATE =
+      "gameplay/simulation/tick_rate";
+  static constexpr const char* SETTING_SIMULATION_SERVER_TICK_RATE =
+      "gameplay/simulation/server_tick_rate";
+  static constexpr const char* SETTING_SIMULATION_INTERPOLATE_RENDERING =
+      "gameplay/simulation/interpolate_rendering";
+
+  static constexpr int DEFAULT_SIMULATION_TICK_RATE = 60;
+  static constexpr int DEFAULT_SIMULATION_SERVER_TICK_RATE = 30;
+
+  static PackedFloat32Array _default_movement_lod_tier_distances();
+  static PackedInt32Array _default_movement_lod_tier_intervals();
 };
 
 #endif  // GDEXTENSION_GAME_SETTINGS_H
@@ -6,7 +6,10 @@
 #include <godot_cpp/variant/utility_functions.hpp>
 
 #include "../camera/moba_camera.hpp"
+#include "../components/ui/hud_clock.hpp"
 #include "../input/input_manager.hpp"
+#include "../systems/simulation_clock.hpp"
+#include "../systems/tick_stages.hpp"
 #include "unit.hpp"
 
 using godot::ClassDB;
@@ -16,9 +19,15 @@ using godot::PropertyInfo;
 using godot::UtilityFunctions;
 using godot::Variant;
 
+MatchManager* MatchManager::singleton_instance = nullptr;
+
 MatchManager::MatchManager() = default;
 
-MatchManager::~MatchManager() = default;
+MatchManager::~MatchManager() {
+  if (singleton_instance == this) {
+    singleton_instance = nullptr;
+  }
+}
 
 void MatchManager::_bind_methods() {
   ClassDB::bind_method(D_METHOD("set_main_unit", "unit"),
@@ -45,11 +54,33 @@ void MatchManager::_bind_methods() {
                "set_moba_camera", "get_moba_camera");
 }
 
+void MatchManager::_enter_tree() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  singleton_instance = this;
+  // Before any HUD node's _ready, so every start time shares this origin
+  HudClock::reset();
+}
+
+void MatchManager::_exit_tree() {
+  if (singleton_instance == this) {
+    singleton_instance = nullptr;
+  }
+}
+
 void MatchManager::_ready() {
   if (Engine::get_singleton()->is_editor_hint()) {
     return;
   }
 
+  // Apply the simulation tick rate before any unit starts ticking
+  SimulationClock::configure(get_tree());
+  set_process(true);
+  set_physics_process_priority(TickStage::CLOCK);
+  set_physics_process(true);
+
   if (main_unit == nullptr) {
     UtilityFunctions::push_warning("[MatchManager] main_unit is not set.");
     return;
@@ -69,6 +100,25 @@ void MatchManager::_ready() {
   }
 }
 
+void MatchManager::_process(double delta) {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  // One global uniform write drives every HUD shader (cooldown sweeps)
+  HudClock::publish();
+}
+
+void MatchManager::_physics_process(double delta) {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  // Before any gameplay node ticks, so cooldowns started this tick are
+  // stamped with this tick's time
+  HudClock::advance(delta);
+}
+
 void MatchManager::set_main_unit(Unit* unit) {
   main_unit = unit;
 }
@@ -92,3 +142,7 @@ void MatchManager::set_moba_camera(MOBACamera* camera) {
 MOBACamera* MatchManager::get_moba_camera() const {
   return moba_camera;
 }
+
+MatchManager* MatchManager::get_singleton() {
+  return singleton_instance;
+}
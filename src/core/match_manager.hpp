@@ -9,6 +9,10 @@ class InputManager;
 class MOBACamera;
 class Unit;
 
+/// Match-level wiring: main unit, player controller and camera
+/// Registers itself on entering the tree, so HUD and other code reach it
+/// through get_singleton() instead of searching the scene. Also publishes
+/// the HUD clock (see HudClock) once per frame.
 class MatchManager : public Node {
   GDCLASS(MatchManager, Node)
 
@@ -19,7 +23,11 @@ class MatchManager : public Node {
   MatchManager();
   ~MatchManager();
 
+  void _enter_tree() override;
+  void _exit_tree() override;
   void _ready() override;
+  void _process(double delta) override;
+  void _physics_process(double delta) override;
 
   void set_main_unit(Unit* unit);
   Unit* get_main_unit() const;
@@ -30,7 +38,13 @@ class MatchManager : public Node {
   void set_moba_camera(MOBACamera* camera);
   MOBACamera* get_moba_camera() const;
 
+  /// The MatchManager in the tree, nullptr if none
+  /// Set on _enter_tree, so it's valid in every other node's _ready
+  static MatchManager* get_singleton();
+
  private:
+  static MatchManager* singleton_instance;
+
   Unit* main_unit = nullptr;
   InputManager* player_controller = nullptr;
   MOBACamera* moba_camera = nullptr;
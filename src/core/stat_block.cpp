@@ -0,0 +1,84 @@
+#include "stat_block.hpp"
+
+#include <algorithm>
+
+bool StatBlock::set_base(Stat stat, float value) {
+  Entry& entry = entries[_index(stat)];
+  if (entry.base == value) {
+    return false;
+  }
+
+  entry.base = value;
+  return _recompute(entry);
+}
+
+float StatBlock::get_base(Stat stat) const {
+  return entries[_index(stat)].base;
+}
+
+StatBlock::ModifierHandle StatBlock::add_modifier(Stat stat,
+                                                  StatModifierType type,
+                                                  float value) {
+  Entry& entry = entries[_index(stat)];
+
+  Modifier modifier;
+  modifier.handle =
+      (next_serial++ << STAT_BITS) | static_cast<ModifierHandle>(stat);
+  modifier.value = value;
+
+  if (type == StatModifierType::ADDITIVE) {
+    entry.additive.push_back(modifier);
+  } else {
+    entry.multiplicative.push_back(modifier);
+  }
+
+  _recompute(entry);
+  return modifier.handle;
+}
+
+bool StatBlock::remove_modifier(ModifierHandle handle) {
+  if (handle == INVALID_MODIFIER) {
+    return false;
+  }
+
+  size_t index = handle & STAT_MASK;
+  if (index >= entries.size()) {
+    return false;
+  }
+
+  Entry& entry = entries[index];
+  if (!_erase(entry.additive, handle) &&
+      !_erase(entry.multiplicative, handle)) {
+    return false;
+  }
+  return _recompute(entry);
+}
+
+bool StatBlock::_erase(std::vector<Modifier>& modifiers,
+                       ModifierHandle handle) {
+  for (size_t i = 0; i < modifiers.size(); i++) {
+    if (modifiers[i].handle == handle) {
+      modifiers[i] = modifiers.back();
+      modifiers.pop_back();
+      return true;
+    }
+  }
+  return false;
+}
+
+bool StatBlock::_recompute(Entry& entry) {
+  float value = entry.base;
+  for (const Modifier& modifier : entry.additive) {
+    value += modifier.value;
+  }
+  for (const Modifier& modifier : entry.multiplicative) {
+    value *= 1.0f + modifier.value;
+  }
+  value = std::max(0.0f, value);
+
+  if (value == entry.value) {
+    return false;
+  }
+  entry.value = value;
+  return true;
+}
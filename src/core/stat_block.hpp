@@ -0,0 +1,78 @@
+#ifndef GDEXTENSION_STAT_BLOCK_H
+#define GDEXTENSION_STAT_BLOCK_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// Gameplay stats that buffs, items and auras can modify
+enum class Stat : uint8_t {
+  MOVE_SPEED = 0,
+  ATTACK_SPEED,  // IAS (100 = 1.0x)
+  ATTACK_DAMAGE,
+  ATTACK_RANGE,
+  MAX_HEALTH,
+  ARMOR,         // Physical damage taken *= 100 / (100 + armor)
+  MAGIC_RESIST,  // Magical damage taken *= 100 / (100 + magic_resist)
+  COUNT,
+};
+
+enum class StatModifierType : uint8_t {
+  ADDITIVE = 0,        // Added to the base value
+  MULTIPLICATIVE = 1,  // Fraction, e.g. -0.3 = 30% less; factors multiply
+};
+
+/// Per-unit stat values with modifier stacks
+/// final = max(0, (base + sum(additive)) * product(1 + multiplicative))
+///
+/// The final value of a stat is recomputed only when its base or one of its
+/// modifiers changes, so readers get a cached value in O(1). Mutators return
+/// true when the final value changed (Unit relays stat_changed then).
+///
+/// Modifiers are identified by the handle add_modifier() returns; the owner
+/// of a modifier (buff, item, aura) keeps it to remove the modifier later.
+class StatBlock {
+ public:
+  using ModifierHandle = uint32_t;
+  static constexpr ModifierHandle INVALID_MODIFIER = 0;
+
+  bool set_base(Stat stat, float value);
+  float get_base(Stat stat) const;
+
+  float get(Stat stat) const { return entries[_index(stat)].value; }
+
+  ModifierHandle add_modifier(Stat stat, StatModifierType type, float value);
+  bool remove_modifier(ModifierHandle handle);
+
+  /// Stat a modifier handle belongs to
+  static Stat get_modifier_stat(ModifierHandle handle) {
+    return static_cast<Stat>(handle & STAT_MASK);
+  }
+
+ private:
+  struct Modifier {
+    ModifierHandle handle = INVALID_MODIFIER;
+    float value = 0.0f;
+  };
+
+  struct Entry {
+    float base = 0.0f;
+    float value = 0.0f;  // Cached final value
+    std::vector<Modifier> additive;
+    std::vector<Modifier> multiplicative;
+  };
+
+  // Handles carry their stat in the low bits so removal finds the entry
+  static constexpr uint32_t STAT_BITS = 8;
+  static constexpr uint32_t STAT_MASK = (1u << STAT_BITS) - 1;
+
+  static size_t _index(Stat stat) { return static_cast<size_t>(stat); }
+  static bool _erase(std::vector<Modifier>& modifiers, ModifierHandle handle);
+  static bool _recompute(Entry& entry);
+
+  std::array<Entry, static_cast<size_t>(Stat::COUNT)> entries;
+  uint32_t next_serial = 1;
+};
+
+#endif  // GDEXTENSION_STAT_BLOCK_H
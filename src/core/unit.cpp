@@ -1,11 +1,21 @@
 #include "unit.hpp"
 
+#include "../common/unit_signals.hpp"
 #include "../components/abilities/ability_component.hpp"
 #include "../components/ui/label_registry.hpp"
 #include "../components/unit_component.hpp"
+#include "../systems/activity_system.hpp"
+#include "../systems/unit_index.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <godot_cpp/classes/box_shape3d.hpp>
+#include <godot_cpp/classes/capsule_shape3d.hpp>
+#include <godot_cpp/classes/collision_shape3d.hpp>
+#include <godot_cpp/classes/cylinder_shape3d.hpp>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/classes/sphere_shape3d.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/core/object.hpp>
 #include <godot_cpp/core/property_info.hpp>
@@ -14,6 +24,7 @@
 #include <godot_cpp/variant/variant.hpp>
 
 using godot::ClassDB;
+using godot::CollisionShape3D;
 using godot::D_METHOD;
 using godot::Engine;
 using godot::MethodInfo;
@@ -39,6 +50,17 @@ void Unit::_bind_methods() {
   ADD_PROPERTY(PropertyInfo(Variant::STRING, "unit_name"), "set_unit_name",
                "get_unit_name");
 
+  ClassDB::bind_method(D_METHOD("set_sleep_when_idle", "enabled"),
+                       &Unit::set_sleep_when_idle);
+  ClassDB::bind_method(D_METHOD("get_sleep_when_idle"),
+                       &Unit::get_sleep_when_idle);
+  ADD_PROPERTY(PropertyInfo(Variant::BOOL, "sleep_when_idle"),
+               "set_sleep_when_idle", "get_sleep_when_idle");
+
+  ClassDB::bind_method(D_METHOD("is_asleep"), &Unit::is_asleep);
+  ClassDB::bind_method(D_METHOD("get_cc_state"), &Unit::get_cc_state);
+  ClassDB::bind_method(D_METHOD("is_alive"), &Unit::is_alive);
+
   // Bind the register_signal method so components can call it
   ClassDB::bind_method(D_METHOD("register_signal", "signal_name"),
                        &Unit::register_signal);
@@ -51,6 +73,80 @@ void Unit::_ready() {
   if (Engine::get_singleton()->is_editor_hint()) {
     return;
   }
+
+  collision_shapes.clear();
+  for (int i = 0; i < get_child_count(); ++i) {
+    CollisionShape3D* shape = Object::cast_to<CollisionShape3D>(get_child(i));
+    if (shape != nullptr) {
+      collision_shapes.push_back(shape);
+    }
+  }
+  alive_collision_layer = get_collision_layer();
+  alive_collision_mask = get_collision_mask();
+  _measure_pick_bounds();
+}
+
+void Unit::_measure_pick_bounds() {
+  if (collision_shapes.empty()) {
+    return;
+  }
+
+  float radius = 0.0f;
+  float top = 0.0f;
+  for (CollisionShape3D* collision : collision_shapes) {
+    godot::Ref<godot::Shape3D> shape = collision->get_shape();
+    float shape_radius = 0.0f;
+    float half_height = 0.0f;
+    if (auto* capsule = Object::cast_to<godot::CapsuleShape3D>(shape.ptr())) {
+      shape_radius = capsule->get_radius();
+      half_height = capsule->get_height() * 0.5f;
+    } else if (auto* cylinder =
+                   Object::cast_to<godot::CylinderShape3D>(shape.ptr())) {
+      shape_radius = cylinder->get_radius();
+      half_height = cylinder->get_height() * 0.5f;
+    } else if (auto* sphere =
+                   Object::cast_to<godot::SphereShape3D>(shape.ptr())) {
+      shape_radius = sphere->get_radius();
+      half_height = shape_radius;
+    } else if (auto* box = Object::cast_to<godot::BoxShape3D>(shape.ptr())) {
+      Vector3 size = box->get_size();
+      shape_radius = std::max(size.x, size.z) * 0.5f;
+      half_height = size.y * 0.5f;
+    } else {
+      continue;
+    }
+
+    Vector3 offset = collision->get_position();
+    radius = std::max(radius, shape_radius + std::hypot(offset.x, offset.z));
+    top = std::max(top, offset.y + half_height);
+  }
+
+  if (radius > 0.0f && top > 0.0f) {
+    pick_radius = radius;
+    pick_height = top;
+  }
+}
+
+void Unit::_enter_tree() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  UnitIndex::add_unit(this);
+  if (sleep_when_idle) {
+    ActivitySystem* activity = ActivitySystem::ensure_singleton(this);
+    if (activity != nullptr) {
+      activity->add_unit(this);
+    }
+  }
+}
+
+void Unit::_exit_tree() {
+  UnitIndex::remove_unit(this);
+  ActivitySystem* activity = ActivitySystem::get_singleton();
+  if (activity != nullptr) {
+    activity->remove_unit(this);
+  }
 }
 
 void Unit::set_faction_id(int32_t new_faction_id) {
@@ -69,6 +165,123 @@ String Unit::get_unit_name() const {
   return unit_name;
 }
 
+void Unit::set_index_slot(int32_t slot) {
+  index_slot = slot;
+}
+
+int32_t Unit::get_index_slot() const {
+  return index_slot;
+}
+
+void Unit::set_sleep_when_idle(bool enabled) {
+  sleep_when_idle = enabled;
+  if (Engine::get_singleton()->is_editor_hint() || !is_inside_tree()) {
+    return;
+  }
+
+  ActivitySystem* activity = enabled ? ActivitySystem::ensure_singleton(this)
+                                     : ActivitySystem::get_singleton();
+  if (activity == nullptr) {
+    return;
+  }
+  if (enabled) {
+    activity->add_unit(this);
+  } else {
+    activity->remove_unit(this);
+  }
+}
+
+bool Unit::get_sleep_when_idle() const {
+  return sleep_when_idle;
+}
+
+void Unit::set_asleep(bool sleeping) {
+  asleep = sleeping;
+}
+
+bool Unit::is_asleep() const {
+  return asleep;
+}
+
+void Unit::_wake() {
+  ActivitySystem* activity = ActivitySystem::get_singleton();
+  if (activity != nullptr) {
+    activity->wake_unit(this);
+  }
+  asleep = false;
+}
+
+void Unit::set_lifecycle(UnitLifecycle state) {
+  if (state == lifecycle) {
+    return;
+  }
+
+  lifecycle = state;
+  _apply_lifecycle_collision();
+  set_visible(state != UnitLifecycle::POOLED);
+
+  // Nobody registered for lifecycle changes - nothing to tell
+  if (has_signal(lifecycle_changed)) {
+    relay(lifecycle_changed, static_cast<int>(state));
+  }
+}
+
+UnitLifecycle Unit::get_lifecycle() const {
+  return lifecycle;
+}
+
+bool Unit::is_alive() const {
+  return lifecycle == UnitLifecycle::ALIVE;
+}
+
+void Unit::_apply_lifecycle_collision() {
+  bool alive = lifecycle == UnitLifecycle::ALIVE;
+  for (CollisionShape3D* shape : collision_shapes) {
+    shape->set_disabled(!alive);
+  }
+  set_collision_layer(alive ? alive_collision_layer : 0);
+  set_collision_mask(alive ? alive_collision_mask : 0);
+}
+
+void Unit::set_crowd_control(uint32_t state) {
+  cc_state = state;
+}
+
+uint32_t Unit::get_cc_state() const {
+  return cc_state;
+}
+
+void Unit::set_base_stat(Stat stat, float value) {
+  if (stats.set_base(stat, value)) {
+    _notify_stat_changed(stat);
+  }
+}
+
+StatBlock::ModifierHandle Unit::add_stat_modifier(Stat stat,
+                                                  StatModifierType type,
+                                                  float value) {
+  float previous = stats.get(stat);
+  StatBlock::ModifierHandle handle = stats.add_modifier(stat, type, value);
+  if (stats.get(stat) != previous) {
+    _notify_stat_changed(stat);
+  }
+  return handle;
+}
+
+void Unit::remove_stat_modifier(StatBlock::ModifierHandle handle) {
+  if (stats.remove_modifier(handle)) {
+    _notify_stat_changed(StatBlock::get_modifier_stat(handle));
+  }
+}
+
+void Unit::_notify_stat_changed(Stat stat) {
+  // Nobody registered for stat changes yet - nothing to tell
+  if (!has_signal(stat_changed)) {
+    return;
+  }
+  relay(stat_changed, static_cast<int>(stat));
+}
+
 void Unit::register_all_debug_labels(LabelRegistry* registry) {
   if (!registry) {
     return;
@@ -76,7 +289,7 @@ void Unit::register_all_debug_labels(LabelRegistry* registry) {
 
   // Register unit's own state
   registry->register_property("Unit", "name", unit_name);
-  registry->register_property("Unit", "faction", String::num(faction_id));
+  registry->register_property("Unit", "faction", faction_id);
 
   // Iterate all children and call register_debug_labels on any UnitComponents
   // Components track their own state (order, target, etc.)
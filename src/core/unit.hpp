@@ -3,8 +3,13 @@
 
 #include <godot_cpp/classes/character_body3d.hpp>
 #include <godot_cpp/variant/string.hpp>
+#include <vector>
+
+#include "../common/unit_lifecycle.hpp"
+#include "stat_block.hpp"
 
 namespace godot {
+class CollisionShape3D;
 class StringName;
 }  // namespace godot
 
@@ -56,6 +61,8 @@ class Unit : public CharacterBody3D {
   ~Unit();
 
   void _ready() override;
+  void _enter_tree() override;
+  void _exit_tree() override;
 
   // Signal registration - components call this to register signals they use
   // Uses Godot's built-in add_user_signal() for dynamic signal creation
@@ -64,8 +71,12 @@ class Unit : public CharacterBody3D {
 
   // Signal relay - relays arbitrary signals to all children
   // Fire and forget: Unit doesn't care what signals or who listens
+  // Any relay (order, damage, ...) wakes a sleeping unit first
   template <typename... Args>
   void relay(const StringName& signal_name, const Args&... args) {
+    if (asleep) {
+      _wake();
+    }
     emit_signal(signal_name, args...);
   }
 
@@ -76,6 +87,46 @@ class Unit : public CharacterBody3D {
   void set_unit_name(const String& name);
   String get_unit_name() const;
 
+  // Slot in the shared UnitIndex (managed by UnitIndex, -1 when not indexed)
+  void set_index_slot(int32_t slot);
+  int32_t get_index_slot() const;
+
+  // Sleep when idle (see ActivitySystem); on by default so camps and waiting
+  // minions stop ticking
+  void set_sleep_when_idle(bool enabled);
+  bool get_sleep_when_idle() const;
+
+  // Components suspended by ActivitySystem (managed by ActivitySystem)
+  void set_asleep(bool sleeping);
+  bool is_asleep() const;
+
+  // Lifecycle - outside ALIVE the unit doesn't collide (POOLED also hides
+  // it) and components suspend themselves (see UnitComponent). Relays
+  // lifecycle_changed(state) on every change
+  void set_lifecycle(UnitLifecycle state);
+  UnitLifecycle get_lifecycle() const;
+  bool is_alive() const;
+
+  // Aggregated crowd control (CrowdControl bit mask, managed by
+  // StatusEffectSystem)
+  void set_crowd_control(uint32_t state);
+  uint32_t get_cc_state() const;
+
+  // Stats - components push base values, buffs/items/auras add modifiers
+  // Relays stat_changed(stat) whenever a final value changes
+  const StatBlock& get_stats() const { return stats; }
+  void set_base_stat(Stat stat, float value);
+  StatBlock::ModifierHandle add_stat_modifier(Stat stat,
+                                              StatModifierType type,
+                                              float value);
+  void remove_stat_modifier(StatBlock::ModifierHandle handle);
+
+  // Screen picking bounds (see ScreenPicker): a vertical cylinder of
+  // pick_radius from the unit origin up to pick_height, measured from the
+  // collision shapes at _ready
+  float get_pick_radius() const { return pick_radius; }
+  float get_pick_height() const { return pick_height; }
+
   // Debug label registration - called by LabelComponent
   void register_all_debug_labels(LabelRegistry* registry);
 
@@ -89,6 +140,25 @@ class Unit : public CharacterBody3D {
  private:
   int32_t faction_id = 0;
   String unit_name = "Unit";
+  int32_t index_slot = -1;
+  uint32_t cc_state = 0;
+  bool sleep_when_idle = true;
+  bool asleep = false;
+  UnitLifecycle lifecycle = UnitLifecycle::ALIVE;
+  StatBlock stats;
+
+  // Collision as configured in the scene, cached at _ready so lifecycle
+  // changes toggle it without rescanning children
+  std::vector<godot::CollisionShape3D*> collision_shapes;
+  uint32_t alive_collision_layer = 0;
+  uint32_t alive_collision_mask = 0;
+  float pick_radius = 0.5f;
+  float pick_height = 2.0f;
+
+  void _notify_stat_changed(Stat stat);
+  void _measure_pick_bounds();
+  void _wake();
+  void _apply_lifecycle_collision();
 };
 
 #endif  // GDEXTENSION_UNIT_H
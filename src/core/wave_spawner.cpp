@@ -0,0 +1,425 @@
+#include "wave_spawner.hpp"
+
+#include <algorithm>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/object.hpp>
+#include <godot_cpp/core/property_info.hpp>
+#include <godot_cpp/variant/callable.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include "../common/unit_signals.hpp"
+#include "../debug/debug_macros.hpp"
+#include "../systems/simulation_clock.hpp"
+#include "../systems/status_effect_system.hpp"
+#include "unit.hpp"
+
+using godot::Callable;
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::Engine;
+using godot::Node;
+using godot::Object;
+using godot::ObjectDB;
+using godot::PropertyInfo;
+using godot::String;
+using godot::StringName;
+using godot::Transform3D;
+using godot::UtilityFunctions;
+using godot::Variant;
+
+WaveSpawner::WaveSpawner() = default;
+
+WaveSpawner::~WaveSpawner() = default;
+
+void WaveSpawner::_bind_methods() {
+  ClassDB::bind_method(D_METHOD("set_unit_scene", "scene"),
+                       &WaveSpawner::set_unit_scene);
+  ClassDB::bind_method(D_METHOD("get_unit_scene"),
+                       &WaveSpawner::get_unit_scene);
+  ClassDB::bind_method(D_METHOD("set_pool_size", "size"),
+                       &WaveSpawner::set_pool_size);
+  ClassDB::bind_method(D_METHOD("get_pool_size"), &WaveSpawner::get_pool_size);
+  ClassDB::bind_method(D_METHOD("set_wave_size", "size"),
+                       &WaveSpawner::set_wave_size);
+  ClassDB::bind_method(D_METHOD("get_wave_size"), &WaveSpawner::get_wave_size);
+  ClassDB::bind_method(D_METHOD("set_wave_interval", "seconds"),
+                       &WaveSpawner::set_wave_interval);
+  ClassDB::bind_method(D_METHOD("get_wave_interval"),
+                       &WaveSpawner::get_wave_interval);
+  ClassDB::bind_method(D_METHOD("set_first_wave_delay", "seconds"),
+                       &WaveSpawner::set_first_wave_delay);
+  ClassDB::bind_method(D_METHOD("get_first_wave_delay"),
+                       &WaveSpawner::get_first_wave_delay);
+  ClassDB::bind_method(D_METHOD("set_corpse_time", "seconds"),
+                       &WaveSpawner::set_corpse_time);
+  ClassDB::bind_method(D_METHOD("get_corpse_time"),
+                       &WaveSpawner::get_corpse_time);
+  ClassDB::bind_method(D_METHOD("set_spawn_per_tick", "count"),
+                       &WaveSpawner::set_spawn_per_tick);
+  ClassDB::bind_method(D_METHOD("get_spawn_per_tick"),
+                       &WaveSpawner::get_spawn_per_tick);
+  ClassDB::bind_method(D_METHOD("set_formation_columns", "columns"),
+                       &WaveSpawner::set_formation_columns);
+  ClassDB::bind_method(D_METHOD("get_formation_columns"),
+                       &WaveSpawner::get_formation_columns);
+  ClassDB::bind_method(D_METHOD("set_formation_spacing", "spacing"),
+                       &WaveSpawner::set_formation_spacing);
+  ClassDB::bind_method(D_METHOD("get_formation_spacing"),
+                       &WaveSpawner::get_formation_spacing);
+  ClassDB::bind_method(D_METHOD("set_faction_id", "faction_id"),
+                       &WaveSpawner::set_faction_id);
+  ClassDB::bind_method(D_METHOD("get_faction_id"),
+                       &WaveSpawner::get_faction_id);
+  ClassDB::bind_method(D_METHOD("set_target_position", "position"),
+                       &WaveSpawner::set_target_position);
+  ClassDB::bind_method(D_METHOD("get_target_position"),
+                       &WaveSpawner::get_target_position);
+  ClassDB::bind_method(D_METHOD("set_march_to_target", "march"),
+                       &WaveSpawner::set_march_to_target);
+  ClassDB::bind_method(D_METHOD("get_march_to_target"),
+                       &WaveSpawner::get_march_to_target);
+  ClassDB::bind_method(D_METHOD("set_enabled", "enabled"),
+                       &WaveSpawner::set_enabled);
+  ClassDB::bind_method(D_METHOD("get_enabled"), &WaveSpawner::get_enabled);
+
+  ClassDB::bind_method(D_METHOD("spawn_wave"), &WaveSpawner::spawn_wave);
+  ClassDB::bind_method(D_METHOD("get_active_count"),
+                       &WaveSpawner::get_active_count);
+  ClassDB::bind_method(D_METHOD("get_pooled_count"),
+                       &WaveSpawner::get_pooled_count);
+
+  // Signal handler for the pooled units' lifecycle_changed relay
+  ClassDB::bind_method(
+      D_METHOD("_on_unit_lifecycle_changed", "state", "slot"),
+      &WaveSpawner::_on_unit_lifecycle_changed);
+
+  ADD_PROPERTY(PropertyInfo(Variant::BOOL, "enabled"), "set_enabled",
+               "get_enabled");
+
+  ADD_GROUP("Pool", "");
+  ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "unit_scene",
+                            godot::PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"),
+               "set_unit_scene", "get_unit_scene");
+  ADD_PROPERTY(PropertyInfo(Variant::INT, "pool_size"), "set_pool_size",
+               "get_pool_size");
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "corpse_time"), "set_corpse_time",
+               "get_corpse_time");
+
+  ADD_GROUP("Waves", "");
+  ADD_PROPERTY(PropertyInfo(Variant::INT, "wave_size"), "set_wave_size",
+               "get_wave_size");
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "wave_interval"),
+               "set_wave_interval", "get_wave_interval");
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "first_wave_delay"),
+               "set_first_wave_delay", "get_first_wave_delay");
+  ADD_PROPERTY(PropertyInfo(Variant::INT, "spawn_per_tick"),
+               "set_spawn_per_tick", "get_spawn_per_tick");
+  ADD_PROPERTY(PropertyInfo(Variant::INT, "faction_id"), "set_faction_id",
+               "get_faction_id");
+
+  ADD_GROUP("Formation", "");
+  ADD_PROPERTY(PropertyInfo(Variant::INT, "formation_columns"),
+               "set_formation_columns", "get_formation_columns");
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "formation_spacing"),
+               "set_formation_spacing", "get_formation_spacing");
+  ADD_PROPERTY(PropertyInfo(Variant::VECTOR3, "target_position"),
+               "set_target_position", "get_target_position");
+  ADD_PROPERTY(PropertyInfo(Variant::BOOL, "march_to_target"),
+               "set_march_to_target", "get_march_to_target");
+}
+
+void WaveSpawner::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    set_physics_process(false);
+    return;
+  }
+
+  _build_pool();
+  set_physics_process(true);
+}
+
+void WaveSpawner::_build_pool() {
+  if (unit_scene.is_null()) {
+    UtilityFunctions::push_error("[WaveSpawner] unit_scene is not set");
+    return;
+  }
+
+  // Every allocation the spawner will ever make happens here
+  pool.reserve(pool_size);
+  free_slots.reserve(pool_size);
+  dying_slots.reserve(pool_size);
+  for (int32_t slot = 0; slot < pool_size; slot++) {
+    Node* node = unit_scene->instantiate();
+    Unit* unit = Object::cast_to<Unit>(node);
+    if (unit == nullptr) {
+      UtilityFunctions::push_error(
+          "[WaveSpawner] unit_scene root must be a Unit node");
+      if (node != nullptr) {
+        memdelete(node);
+      }
+      return;
+    }
+
+    add_child(unit);
+    unit->register_signal(lifecycle_changed);
+    unit->connect(lifecycle_changed,
+                  Callable(this, StringName("_on_unit_lifecycle_changed"))
+                      .bind(slot));
+    unit->set_lifecycle(UnitLifecycle::POOLED);
+
+    PooledUnit pooled;
+    pooled.unit_id = unit->get_instance_id();
+    pool.push_back(pooled);
+    free_slots.push_back(slot);
+  }
+
+  DBG_INFO("WaveSpawner", "Pooled " + String::num(pool_size) + " units");
+}
+
+void WaveSpawner::_physics_process(double delta) {
+  uint64_t tick = SimulationClock::get_tick();
+
+  // First tick: the clock is configured by now (MatchManager::_ready)
+  if (next_wave_tick == 0) {
+    next_wave_tick =
+        tick + static_cast<uint64_t>(
+                   SimulationClock::seconds_to_ticks(first_wave_delay)) +
+        1;
+  }
+
+  // Corpses whose time is up go back to the pool
+  for (size_t i = 0; i < dying_slots.size();) {
+    int32_t slot = dying_slots[i];
+    if (tick >= pool[slot].recycle_tick) {
+      _recycle(slot);
+      dying_slots[i] = dying_slots.back();
+      dying_slots.pop_back();
+      continue;
+    }
+    i++;
+  }
+
+  if (enabled && tick >= next_wave_tick) {
+    spawn_wave();
+    next_wave_tick =
+        tick + static_cast<uint64_t>(
+                   SimulationClock::seconds_to_ticks(wave_interval));
+  }
+
+  // Place at most spawn_per_tick units of the current wave
+  int32_t budget = std::min(pending_spawns, spawn_per_tick);
+  for (int32_t i = 0; i < budget; i++) {
+    if (free_slots.empty()) {
+      DBG_WARN("WaveSpawner", "Pool exhausted, dropping " +
+                                  String::num(pending_spawns) +
+                                  " units of the wave");
+      pending_spawns = 0;
+      break;
+    }
+    _spawn_one(placed_in_wave++);
+    pending_spawns--;
+  }
+  if (pending_spawns == 0) {
+    placed_in_wave = 0;
+  }
+}
+
+void WaveSpawner::spawn_wave() {
+  // A wave still being placed is extended: its formation grows more rows
+  pending_spawns = std::min(pending_spawns + wave_size,
+                            static_cast<int32_t>(pool.size()));
+}
+
+void WaveSpawner::_spawn_one(int32_t formation_index) {
+  int32_t slot = free_slots.back();
+  free_slots.pop_back();
+  PooledUnit& pooled = pool[slot];
+  Unit* unit = _resolve(pooled);
+  if (unit == nullptr) {
+    return;
+  }
+
+  // Rows behind the spawner's forward axis, columns centered on it
+  int32_t row = formation_index / formation_columns;
+  int32_t column = formation_index % formation_columns;
+  float offset_x =
+      (static_cast<float>(column) -
+       static_cast<float>(formation_columns - 1) * 0.5f) *
+      formation_spacing;
+  float offset_z = static_cast<float>(row) * formation_spacing;
+  Transform3D spawn = get_global_transform();
+  unit->set_global_position(spawn.xform(Vector3(offset_x, 0.0f, offset_z)));
+  // Teleport: don't interpolate from where the unit died
+  unit->reset_physics_interpolation();
+  unit->set_velocity(Vector3(0, 0, 0));
+  _clear_effects(unit);
+
+  unit->set_faction_id(faction_id);
+  pooled.active = true;
+  pooled.recycle_tick = 0;
+  unit->set_lifecycle(UnitLifecycle::ALIVE);
+
+  if (march_to_target) {
+    unit->relay(move_requested, target_position);
+  }
+}
+
+void WaveSpawner::_recycle(int32_t slot) {
+  PooledUnit& pooled = pool[slot];
+  pooled.active = false;
+  pooled.recycle_tick = 0;
+  free_slots.push_back(slot);
+
+  Unit* unit = _resolve(pooled);
+  if (unit != nullptr) {
+    _clear_effects(unit);
+    unit->set_lifecycle(UnitLifecycle::POOLED);
+  }
+}
+
+void WaveSpawner::_clear_effects(Unit* unit) {
+  // Slows and stuns outlive their unit's death; the next life starts clean
+  StatusEffectSystem* status_effects = StatusEffectSystem::get_singleton();
+  if (status_effects != nullptr) {
+    status_effects->clear_effects(unit);
+  }
+}
+
+void WaveSpawner::_on_unit_lifecycle_changed(int state, int32_t slot) {
+  if (slot < 0 || slot >= static_cast<int32_t>(pool.size())) {
+    return;
+  }
+
+  PooledUnit& pooled = pool[slot];
+  if (!pooled.active || pooled.recycle_tick != 0 ||
+      static_cast<UnitLifecycle>(state) != UnitLifecycle::DEAD) {
+    return;
+  }
+
+  // +1 keeps 0 free for "not dying" even with corpse_time 0
+  pooled.recycle_tick =
+      SimulationClock::get_tick() +
+      static_cast<uint64_t>(SimulationClock::seconds_to_ticks(corpse_time)) +
+      1;
+  dying_slots.push_back(slot);
+}
+
+Unit* WaveSpawner::_resolve(const PooledUnit& pooled) const {
+  return Object::cast_to<Unit>(ObjectDB::get_instance(pooled.unit_id));
+}
+
+void WaveSpawner::set_unit_scene(const Ref<PackedScene>& scene) {
+  unit_scene = scene;
+}
+
+Ref<PackedScene> WaveSpawner::get_unit_scene() const {
+  return unit_scene;
+}
+
+void WaveSpawner::set_pool_size(int32_t size) {
+  pool_size = std::max(0, size);
+}
+
+int32_t WaveSpawner::get_pool_size() const {
+  return pool_size;
+}
+
+void WaveSpawner::set_wave_size(int32_t size) {
+  wave_size = std::max(0, size);
+}
+
+int32_t WaveSpawner::get_wave_size() const {
+  return wave_size;
+}
+
+void WaveSpawner::set_wave_interval(double seconds) {
+  wave_interval = std::max(0.1, seconds);
+}
+
+double WaveSpawner::get_wave_interval() const {
+  return wave_interval;
+}
+
+void WaveSpawner::set_first_wave_delay(double seconds) {
+  first_wave_delay = std::max(0.0, seconds);
+}
+
+double WaveSpawner::get_first_wave_delay() const {
+  return first_wave_delay;
+}
+
+void WaveSpawner::set_corpse_time(double seconds) {
+  corpse_time = std::max(0.0, seconds);
+}
+
+double WaveSpawner::get_corpse_time() const {
+  return corpse_time;
+}
+
+void WaveSpawner::set_spawn_per_tick(int32_t count) {
+  spawn_per_tick = std::max(1, count);
+}
+
+int32_t WaveSpawner::get_spawn_per_tick() const {
+  return spawn_per_tick;
+}
+
+void WaveSpawner::set_formation_columns(int32_t columns) {
+  formation_columns = std::max(1, columns);
+}
+
+int32_t WaveSpawner::get_formation_columns() const {
+  return formation_columns;
+}
+
+void WaveSpawner::set_formation_spacing(float spacing) {
+  formation_spacing = std::max(0.0f, spacing);
+}
+
+float WaveSpawner::get_formation_spacing() const {
+  return formation_spacing;
+}
+
+void WaveSpawner::set_faction_id(int32_t id) {
+  faction_id = id;
+}
+
+int32_t WaveSpawner::get_faction_id() const {
+  return faction_id;
+}
+
+void WaveSpawner::set_target_position(const Vector3& position) {
+  target_position = position;
+}
+
+Vector3 WaveSpawner::get_target_position() const {
+  return target_position;
+}
+
+void WaveSpawner::set_march_to_target(bool march) {
+  march_to_target = march;
+}
+
+bool WaveSpawner::get_march_to_target() const {
+  return march_to_target;
+}
+
+void WaveSpawner::set_enabled(bool new_enabled) {
+  enabled = new_enabled;
+}
+
+bool WaveSpawner::get_enabled() const {
+  return enabled;
+}
+
+int32_t WaveSpawner::get_active_count() const {
+  return static_cast<int32_t>(pool.size() - free_slots.size());
+}
+
+int32_t WaveSpawner::get_pooled_count() const {
+  return static_cast<int32_t>(free_slots.size());
+}
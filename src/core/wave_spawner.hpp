@@ -0,0 +1,129 @@
+#ifndef GDEXTENSION_WAVE_SPAWNER_H
+#define GDEXTENSION_WAVE_SPAWNER_H
+
+#include <cstdint>
+#include <godot_cpp/classes/node3d.hpp>
+#include <godot_cpp/classes/packed_scene.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <vector>
+
+using godot::Node3D;
+using godot::PackedScene;
+using godot::Ref;
+using godot::Vector3;
+
+class Unit;
+
+/// Creep wave spawner backed by a pool of pre-instantiated Unit scenes
+/// The whole pool is instantiated once, at _ready (match load), and parked
+/// in UnitLifecycle::POOLED: hidden, not colliding, not targetable, with
+/// components suspended. From then on nothing is instantiated or freed:
+/// - A wave takes units from the free list, places them in a formation
+///   around the spawner, resets their faction and flips them to ALIVE;
+///   spawn_per_tick spreads a large wave over a few ticks
+/// - Components reset their own per-life state (health, timers, orders)
+///   when pooled, see UnitComponent::_on_lifecycle_changed; status effects
+///   and their stat modifiers are cleared on pooling and again on spawn
+/// - A unit that dies goes back to the pool after corpse_time
+///
+/// Units are children of the spawner for their whole life. Pooled scenes
+/// shouldn't carry a ReviveComponent: dead minions are recycled instead.
+class WaveSpawner : public Node3D {
+  GDCLASS(WaveSpawner, Node3D)
+
+ protected:
+  static void _bind_methods();
+
+  struct PooledUnit {
+    uint64_t unit_id = 0;
+    bool active = false;
+    uint64_t recycle_tick = 0;  // 0 = not dying
+  };
+
+  std::vector<PooledUnit> pool;
+  std::vector<int32_t> free_slots;   // Stack of pooled (inactive) slots
+  std::vector<int32_t> dying_slots;  // Dead, waiting for corpse_time
+
+  Ref<PackedScene> unit_scene;
+  int32_t pool_size = 60;
+  int32_t wave_size = 6;
+  double wave_interval = 30.0;
+  double first_wave_delay = 1.0;
+  double corpse_time = 1.0;
+  int32_t spawn_per_tick = 10;
+  int32_t formation_columns = 3;
+  float formation_spacing = 1.5f;
+  int32_t faction_id = 0;
+  Vector3 target_position = Vector3(0, 0, 0);
+  bool march_to_target = true;
+  bool enabled = true;
+
+  // Wave scheduling, in simulation ticks
+  uint64_t next_wave_tick = 0;
+  int32_t pending_spawns = 0;  // Units of the current wave not placed yet
+  int32_t placed_in_wave = 0;  // Formation index of the next placed unit
+
+  void _build_pool();
+  void _spawn_one(int32_t formation_index);
+  void _recycle(int32_t slot);
+  void _clear_effects(Unit* unit);
+  void _on_unit_lifecycle_changed(int state, int32_t slot);
+  Unit* _resolve(const PooledUnit& pooled) const;
+
+ public:
+  WaveSpawner();
+  ~WaveSpawner();
+
+  void _ready() override;
+  void _physics_process(double delta) override;
+
+  /// Queue a wave now, on top of the regular schedule
+  void spawn_wave();
+
+  void set_unit_scene(const Ref<PackedScene>& scene);
+  Ref<PackedScene> get_unit_scene() const;
+
+  /// Units instantiated at _ready; waves never grow the pool
+  void set_pool_size(int32_t size);
+  int32_t get_pool_size() const;
+
+  void set_wave_size(int32_t size);
+  int32_t get_wave_size() const;
+
+  void set_wave_interval(double seconds);
+  double get_wave_interval() const;
+
+  void set_first_wave_delay(double seconds);
+  double get_first_wave_delay() const;
+
+  /// Seconds a dead unit lies as a corpse before it's pooled
+  void set_corpse_time(double seconds);
+  double get_corpse_time() const;
+
+  void set_spawn_per_tick(int32_t count);
+  int32_t get_spawn_per_tick() const;
+
+  void set_formation_columns(int32_t columns);
+  int32_t get_formation_columns() const;
+
+  void set_formation_spacing(float spacing);
+  float get_formation_spacing() const;
+
+  void set_faction_id(int32_t id);
+  int32_t get_faction_id() const;
+
+  /// Where spawned units walk to (see march_to_target)
+  void set_target_position(const Vector3& position);
+  Vector3 get_target_position() const;
+
+  void set_march_to_target(bool march);
+  bool get_march_to_target() const;
+
+  void set_enabled(bool new_enabled);
+  bool get_enabled() const;
+
+  int32_t get_active_count() const;
+  int32_t get_pooled_count() const;
+};
+
+#endif  // GDEXTENSION_WAVE_SPAWNER_H
@@ -0,0 +1,211 @@
+#include "highlight_benchmark.hpp"
+
+#include <algorithm>
+#include <godot_cpp/classes/box_mesh.hpp>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/mesh_instance3d.hpp>
+#include <godot_cpp/classes/standard_material3d.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/property_info.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+#include "../visual/highlight/highlight_system.hpp"
+#include "debug_macros.hpp"
+
+using godot::BoxMesh;
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::Engine;
+using godot::MeshInstance3D;
+using godot::PropertyInfo;
+using godot::StandardMaterial3D;
+using godot::String;
+using godot::Time;
+using godot::Variant;
+using godot::Vector3;
+
+namespace {
+constexpr float TARGET_SPACING = 1.5f;
+}  // namespace
+
+HighlightBenchmark::HighlightBenchmark() = default;
+
+HighlightBenchmark::~HighlightBenchmark() = default;
+
+void HighlightBenchmark::_bind_methods() {
+  ClassDB::bind_method(D_METHOD("run_benchmark"),
+                       &HighlightBenchmark::run_benchmark);
+
+  ClassDB::bind_method(D_METHOD("set_unit_count", "count"),
+                       &HighlightBenchmark::set_unit_count);
+  ClassDB::bind_method(D_METHOD("get_unit_count"),
+                       &HighlightBenchmark::get_unit_count);
+  ADD_PROPERTY(PropertyInfo(Variant::INT, "unit_count"), "set_unit_count",
+               "get_unit_count");
+
+  ClassDB::bind_method(D_METHOD("set_sweeps", "count"),
+                       &HighlightBenchmark::set_sweeps);
+  ClassDB::bind_method(D_METHOD("get_sweeps"), &HighlightBenchmark::get_sweeps);
+  ADD_PROPERTY(PropertyInfo(Variant::INT, "sweeps"), "set_sweeps",
+               "get_sweeps");
+
+  ClassDB::bind_method(D_METHOD("set_run_on_ready", "enabled"),
+                       &HighlightBenchmark::set_run_on_ready);
+  ClassDB::bind_method(D_METHOD("get_run_on_ready"),
+                       &HighlightBenchmark::get_run_on_ready);
+  ADD_PROPERTY(PropertyInfo(Variant::BOOL, "run_on_ready"),
+               "set_run_on_ready", "get_run_on_ready");
+}
+
+void HighlightBenchmark::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  if (run_on_ready) {
+    // Deferred so the HighlightSystem created on first use is in the tree
+    call_deferred("run_benchmark");
+  }
+}
+
+Dictionary HighlightBenchmark::run_benchmark() {
+  Dictionary results;
+  if (HighlightSystem::ensure_singleton(this) == nullptr) {
+    DBG_WARN("HighlightBenchmark", "Not inside the tree, nothing to run");
+    return results;
+  }
+
+  _spawn_targets();
+
+  int32_t hovers = unit_count * sweeps;
+  int32_t assignments_before =
+      HighlightSystem::get_singleton()->get_material_assignments();
+  double shared_usec = _sweep_shared();
+  int32_t assignments =
+      HighlightSystem::get_singleton()->get_material_assignments() -
+      assignments_before;
+  double legacy_usec = _sweep_legacy();
+
+  double shared_per_hover = hovers > 0 ? shared_usec / hovers : 0.0;
+  double legacy_per_hover = hovers > 0 ? legacy_usec / hovers : 0.0;
+  results["hovers"] = hovers;
+  results["shared_usec_per_hover"] = shared_per_hover;
+  results["legacy_usec_per_hover"] = legacy_per_hover;
+  results["material_assignments"] = assignments;
+
+  DBG_INFO("HighlightBenchmark",
+           String::num_int64(hovers) + " hovers over " +
+               String::num_int64(unit_count) + " units: shared " +
+               String::num(shared_per_hover, 3) + " us/hover (" +
+               String::num_int64(assignments) +
+               " material assignments), legacy " +
+               String::num(legacy_per_hover, 3) + " us/hover");
+  return results;
+}
+
+void HighlightBenchmark::_spawn_targets() {
+  if (static_cast<int32_t>(targets.size()) == unit_count) {
+    return;
+  }
+
+  for (MeshInstance3D* target : targets) {
+    target->queue_free();
+  }
+  targets.clear();
+
+  if (target_mesh.is_null()) {
+    Ref<BoxMesh> box;
+    box.instantiate();
+    target_mesh = box;
+  }
+
+  // A row along X, like a cursor sweeping across a minion wave
+  targets.reserve(unit_count);
+  for (int32_t i = 0; i < unit_count; ++i) {
+    MeshInstance3D* target = memnew(MeshInstance3D);
+    target->set_mesh(target_mesh);
+    target->set_position(Vector3(i * TARGET_SPACING, 0.0f, 0.0f));
+    add_child(target);
+    targets.push_back(target);
+  }
+}
+
+double HighlightBenchmark::_sweep_shared() {
+  HighlightSystem* highlights = HighlightSystem::get_singleton();
+  Time* time = Time::get_singleton();
+  uint64_t start = time->get_ticks_usec();
+
+  MeshInstance3D* hovered = nullptr;
+  for (int32_t sweep = 0; sweep < sweeps; ++sweep) {
+    for (MeshInstance3D* target : targets) {
+      if (hovered != nullptr) {
+        highlights->set_mesh_highlighted(hovered, false, highlight_color);
+      }
+      highlights->set_mesh_highlighted(target, true, highlight_color);
+      hovered = target;
+    }
+  }
+  if (hovered != nullptr) {
+    highlights->set_mesh_highlighted(hovered, false, highlight_color);
+  }
+
+  return static_cast<double>(time->get_ticks_usec() - start);
+}
+
+double HighlightBenchmark::_sweep_legacy() {
+  Time* time = Time::get_singleton();
+  uint64_t start = time->get_ticks_usec();
+
+  MeshInstance3D* overlay = nullptr;
+  for (int32_t sweep = 0; sweep < sweeps; ++sweep) {
+    for (MeshInstance3D* target : targets) {
+      if (overlay != nullptr) {
+        overlay->queue_free();
+      }
+
+      overlay = memnew(MeshInstance3D);
+      target->add_child(overlay);
+      overlay->set_mesh(target->get_mesh());
+
+      Ref<StandardMaterial3D> glow_material = memnew(StandardMaterial3D);
+      glow_material->set_shading_mode(
+          godot::BaseMaterial3D::SHADING_MODE_UNSHADED);
+      glow_material->set_albedo(highlight_color);
+      glow_material->set_emission(highlight_color);
+      glow_material->set_emission_energy_multiplier(0.5f);
+      glow_material->set_transparency(
+          godot::BaseMaterial3D::TRANSPARENCY_ALPHA);
+      overlay->set_surface_override_material(0, glow_material);
+    }
+  }
+  if (overlay != nullptr) {
+    overlay->queue_free();
+  }
+
+  return static_cast<double>(time->get_ticks_usec() - start);
+}
+
+void HighlightBenchmark::set_unit_count(int32_t count) {
+  unit_count = std::max(1, count);
+}
+
+int32_t HighlightBenchmark::get_unit_count() const {
+  return unit_count;
+}
+
+void HighlightBenchmark::set_sweeps(int32_t count) {
+  sweeps = std::max(1, count);
+}
+
+int32_t HighlightBenchmark::get_sweeps() const {
+  return sweeps;
+}
+
+void HighlightBenchmark::set_run_on_ready(bool enabled) {
+  run_on_ready = enabled;
+}
+
+bool HighlightBenchmark::get_run_on_ready() const {
+  return run_on_ready;
+}
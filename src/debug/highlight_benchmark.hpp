@@ -0,0 +1,68 @@
+#ifndef GDEXTENSION_HIGHLIGHT_BENCHMARK_H
+#define GDEXTENSION_HIGHLIGHT_BENCHMARK_H
+
+#include <cstdint>
+#include <godot_cpp/classes/mesh.hpp>
+#include <godot_cpp/classes/node3d.hpp>
+#include <godot_cpp/variant/color.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <vector>
+
+using godot::Color;
+using godot::Dictionary;
+using godot::Mesh;
+using godot::Node3D;
+using godot::Ref;
+
+namespace godot {
+class MeshInstance3D;
+}  // namespace godot
+
+/// Hover churn benchmark for unit highlighting
+/// Lays out unit_count box meshes in a row and sweeps a simulated cursor
+/// across them sweeps times, moving the highlight from one mesh to the
+/// next on every step. Each run times two paths:
+/// - shared: HighlightSystem flag toggles on the shared outline material
+/// - legacy: a new overlay MeshInstance3D and StandardMaterial3D per hover,
+///   queue_free'd when the cursor moves on (the old InputManager glow)
+///
+/// Results are logged and returned from run_benchmark. Drop the node in a
+/// test scene; it does nothing until run (or run_on_ready is set).
+class HighlightBenchmark : public Node3D {
+  GDCLASS(HighlightBenchmark, Node3D)
+
+ protected:
+  static void _bind_methods();
+
+  int32_t unit_count = 100;
+  int32_t sweeps = 20;
+  bool run_on_ready = false;
+  Color highlight_color = Color(0.3f, 0.8f, 1.0f, 0.3f);
+
+  Ref<Mesh> target_mesh;
+  std::vector<godot::MeshInstance3D*> targets;
+
+  void _spawn_targets();
+  double _sweep_shared();
+  double _sweep_legacy();
+
+ public:
+  HighlightBenchmark();
+  ~HighlightBenchmark();
+
+  void _ready() override;
+
+  /// Run both sweeps; returns per-hover timings in microseconds
+  Dictionary run_benchmark();
+
+  void set_unit_count(int32_t count);
+  int32_t get_unit_count() const;
+
+  void set_sweeps(int32_t count);
+  int32_t get_sweeps() const;
+
+  void set_run_on_ready(bool enabled);
+  bool get_run_on_ready() const;
+};
+
+#endif  // GDEXTENSION_HIGHLIGHT_BENCHMARK_H
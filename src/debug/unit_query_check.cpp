@@ -0,0 +1,403 @@
+#include "unit_query_check.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/property_info.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <limits>
+
+#include "../common/allegiance.hpp"
+#include "../core/faction_table.hpp"
+#include "../core/unit.hpp"
+#include "../systems/unit_index.hpp"
+#include "../systems/unit_query.hpp"
+#include "debug_macros.hpp"
+
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::Engine;
+using godot::PropertyInfo;
+using godot::RandomNumberGenerator;
+using godot::String;
+using godot::Variant;
+using godot::Vector3;
+
+namespace {
+constexpr int32_t FACTION_COUNT = 3;
+constexpr float PI = 3.14159265f;
+// Spawn area reaches past the grid, so clamped border cells are covered
+constexpr float SPAWN_EXTENT = UnitIndex::HALF_EXTENT * 1.25f;
+
+constexpr uint32_t ALLEGIANCES[] = {
+    Allegiance::OTHERS, Allegiance::ENEMY, Allegiance::ALLY | Allegiance::SELF,
+    Allegiance::ANY, Allegiance::ENEMY | Allegiance::NEUTRAL};
+
+constexpr const char* SHAPE_NAMES[] = {"sphere", "cone", "capsule",
+                                       "oriented_rect", "k_nearest"};
+
+struct Candidate {
+  float distance_sq = 0.0f;
+  int32_t slot = 0;
+  Unit* unit = nullptr;
+};
+
+// Normalized the way UnitQuery normalizes directions, so both sides test
+// against bit-identical axes
+Vector3 flat_direction(float angle) {
+  float x = std::cos(angle);
+  float z = std::sin(angle);
+  float length = std::sqrt(x * x + z * z);
+  return Vector3(x / length, 0.0f, z / length);
+}
+}  // namespace
+
+UnitQueryCheck::UnitQueryCheck() = default;
+
+UnitQueryCheck::~UnitQueryCheck() = default;
+
+void UnitQueryCheck::_bind_methods() {
+  ClassDB::bind_method(D_METHOD("run_check"), &UnitQueryCheck::run_check);
+  ClassDB::bind_method(D_METHOD("get_last_results"),
+                       &UnitQueryCheck::get_last_results);
+
+  ClassDB::bind_method(D_METHOD("set_unit_count", "count"),
+                       &UnitQueryCheck::set_unit_count);
+  ClassDB::bind_method(D_METHOD("get_unit_count"),
+                       &UnitQueryCheck::get_unit_count);
+  ADD_PROPERTY(PropertyInfo(Variant::INT, "unit_count"), "set_unit_count",
+               "get_unit_count");
+
+  ClassDB::bind_method(D_METHOD("set_queries_per_shape", "count"),
+                       &UnitQueryCheck::set_queries_per_shape);
+  ClassDB::bind_method(D_METHOD("get_queries_per_shape"),
+                       &UnitQueryCheck::get_queries_per_shape);
+  ADD_PROPERTY(PropertyInfo(Variant::INT, "queries_per_shape"),
+               "set_queries_per_shape", "get_queries_per_shape");
+
+  ClassDB::bind_method(D_METHOD("set_seed", "seed"),
+                       &UnitQueryCheck::set_seed);
+  ClassDB::bind_method(D_METHOD("get_seed"), &UnitQueryCheck::get_seed);
+  ADD_PROPERTY(PropertyInfo(Variant::INT, "seed"), "set_seed", "get_seed");
+
+  ClassDB::bind_method(D_METHOD("set_run_on_ready", "enabled"),
+                       &UnitQueryCheck::set_run_on_ready);
+  ClassDB::bind_method(D_METHOD("get_run_on_ready"),
+                       &UnitQueryCheck::get_run_on_ready);
+  ADD_PROPERTY(PropertyInfo(Variant::BOOL, "run_on_ready"),
+               "set_run_on_ready", "get_run_on_ready");
+}
+
+void UnitQueryCheck::_ready() {
+  set_physics_process(false);
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  if (run_on_ready) {
+    run_check();
+  }
+}
+
+void UnitQueryCheck::_physics_process(double delta) {
+  if (--frames_to_wait > 0) {
+    return;
+  }
+
+  _run_queries();
+  phase++;
+  if (phase == PHASE_COUNT) {
+    set_physics_process(false);
+    _set_faction_merged(false);
+    _report();
+    return;
+  }
+
+  // Faction 1 leaves the grid, then comes back; each change needs a rebuild
+  _set_faction_merged(phase == 1);
+  frames_to_wait = 2;
+}
+
+void UnitQueryCheck::run_check() {
+  if (!is_inside_tree()) {
+    DBG_WARN("UnitQueryCheck", "Not inside the tree, nothing to run");
+    return;
+  }
+
+  _spawn_units();
+  last_results.clear();
+  phase = 0;
+  std::fill(mismatches, mismatches + SHAPE_COUNT, 0);
+  checked_nearest = true;
+  // The grid may already be built this frame; two frames guarantee a
+  // rebuild that includes the new units
+  frames_to_wait = 2;
+  set_physics_process(true);
+}
+
+void UnitQueryCheck::_spawn_units() {
+  if (static_cast<int32_t>(units.size()) == unit_count) {
+    return;
+  }
+
+  for (Unit* unit : units) {
+    unit->queue_free();
+  }
+  units.clear();
+  spawn_factions.clear();
+
+  rng.instantiate();
+  rng->set_seed(static_cast<uint64_t>(seed));
+
+  units.reserve(unit_count);
+  for (int32_t i = 0; i < unit_count; ++i) {
+    Unit* unit = memnew(Unit);
+    unit->set_name("QueryCheckUnit" + String::num_int64(i));
+    unit->set_sleep_when_idle(false);
+    unit->set_faction_id(rng->randi_range(0, FACTION_COUNT - 1));
+    unit->set_position(
+        Vector3(rng->randf_range(-SPAWN_EXTENT, SPAWN_EXTENT), 0.0f,
+                rng->randf_range(-SPAWN_EXTENT, SPAWN_EXTENT)));
+    add_child(unit);
+    units.push_back(unit);
+    spawn_factions.push_back(unit->get_faction_id());
+  }
+}
+
+void UnitQueryCheck::_set_faction_merged(bool merged) {
+  for (size_t i = 0; i < units.size(); ++i) {
+    if (spawn_factions[i] == 1) {
+      units[i]->set_faction_id(merged ? 0 : 1);
+    }
+  }
+}
+
+bool UnitQueryCheck::_is_own(const Unit* unit) const {
+  return std::find(units.begin(), units.end(), unit) != units.end();
+}
+
+void UnitQueryCheck::_run_queries() {
+  std::vector<Unit*> expected;
+  std::vector<Unit*> actual;
+
+  auto random_point = [this]() {
+    return Vector3(rng->randf_range(-SPAWN_EXTENT, SPAWN_EXTENT), 0.0f,
+                   rng->randf_range(-SPAWN_EXTENT, SPAWN_EXTENT));
+  };
+
+  // Same set of spawned units in result as inside(x, z) selects linearly
+  auto check_set = [&](int32_t shape, UnitSpan result, Unit* reference,
+                       uint32_t allegiance, auto&& inside) {
+    expected.clear();
+    for (Unit* unit : units) {
+      if (reference != nullptr &&
+          !FactionTable::matches(reference, unit, allegiance)) {
+        continue;
+      }
+      Vector3 position = unit->get_global_position();
+      if (inside(position.x, position.z)) {
+        expected.push_back(unit);
+      }
+    }
+
+    actual.clear();
+    for (Unit* unit : result) {
+      if (_is_own(unit)) {
+        actual.push_back(unit);
+      }
+    }
+
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    if (expected != actual) {
+      mismatches[shape]++;
+      DBG_WARN("UnitQueryCheck",
+               String(SHAPE_NAMES[shape]) + " mismatch: expected " +
+                   String::num_int64(expected.size()) + " units, got " +
+                   String::num_int64(actual.size()));
+    }
+  };
+
+  bool check_nearest = UnitIndex::get_unit_count() ==
+                       static_cast<int32_t>(units.size());
+  if (!check_nearest && checked_nearest) {
+    DBG_WARN("UnitQueryCheck",
+             "Other units are indexed, skipping the k-nearest check");
+  }
+  checked_nearest = checked_nearest && check_nearest;
+
+  std::vector<Candidate> candidates;
+  for (int32_t query = 0; query < queries_per_shape; ++query) {
+    Unit* reference = nullptr;
+    if (!units.empty() && rng->randi_range(0, 1) == 1) {
+      int32_t last = static_cast<int32_t>(units.size()) - 1;
+      reference = units[rng->randi_range(0, last)];
+    }
+    uint32_t allegiance = ALLEGIANCES[rng->randi_range(0, 4)];
+
+    // Sphere
+    Vector3 center = random_point();
+    float radius = rng->randf_range(1.0f, 40.0f);
+    check_set(0, UnitQuery::sphere(center, radius, reference, allegiance),
+              reference, allegiance, [&](float x, float z) {
+                float dx = x - center.x;
+                float dz = z - center.z;
+                return dx * dx + dz * dz <= radius * radius;
+              });
+
+    // Cone
+    Vector3 direction = flat_direction(rng->randf_range(0.0f, 2.0f * PI));
+    float range = rng->randf_range(1.0f, 40.0f);
+    float half_angle = rng->randf_range(0.1f, PI);
+    float cos_half_angle = std::cos(half_angle);
+    check_set(1,
+              UnitQuery::cone(center, direction, range, half_angle,
+                              reference, allegiance),
+              reference, allegiance, [&](float x, float z) {
+                float dx = x - center.x;
+                float dz = z - center.z;
+                float distance_sq = dx * dx + dz * dz;
+                float along = dx * direction.x + dz * direction.z;
+                return distance_sq <= range * range &&
+                       along >= cos_half_angle * std::sqrt(distance_sq);
+              });
+
+    // Capsule
+    Vector3 end = center + flat_direction(rng->randf_range(0.0f, 2.0f * PI)) *
+                               rng->randf_range(0.0f, 40.0f);
+    float capsule_radius = rng->randf_range(0.5f, 10.0f);
+    check_set(2,
+              UnitQuery::capsule(center, end, capsule_radius, reference,
+                                 allegiance),
+              reference, allegiance, [&](float x, float z) {
+                float sx = end.x - center.x;
+                float sz = end.z - center.z;
+                float length_sq = sx * sx + sz * sz;
+                float px = x - center.x;
+                float pz = z - center.z;
+                float inv_length_sq = length_sq > 0.0f ? 1.0f / length_sq
+                                                       : 0.0f;
+                float t = (px * sx + pz * sz) * inv_length_sq;
+                t = std::clamp(t, 0.0f, 1.0f);
+                float ex = px - sx * t;
+                float ez = pz - sz * t;
+                return ex * ex + ez * ez <= capsule_radius * capsule_radius;
+              });
+
+    // Oriented rect
+    float half_length = rng->randf_range(1.0f, 30.0f);
+    float half_width = rng->randf_range(1.0f, 15.0f);
+    check_set(3,
+              UnitQuery::oriented_rect(center, direction, half_length,
+                                       half_width, reference, allegiance),
+              reference, allegiance, [&](float x, float z) {
+                float dx = x - center.x;
+                float dz = z - center.z;
+                float along = dx * direction.x + dz * direction.z;
+                float across = dx * direction.z - dz * direction.x;
+                return std::abs(along) <= half_length &&
+                       std::abs(across) <= half_width;
+              });
+
+    // k-nearest: same units in the same order (ties by index slot)
+    if (!check_nearest) {
+      continue;
+    }
+    int32_t k = rng->randi_range(1, 16);
+    float max_range = rng->randi_range(0, 1) == 1
+                          ? std::numeric_limits<float>::infinity()
+                          : rng->randf_range(5.0f, 80.0f);
+    UnitSpan nearest =
+        UnitQuery::k_nearest(center, k, max_range, reference, allegiance);
+
+    candidates.clear();
+    for (Unit* unit : units) {
+      if (reference != nullptr &&
+          !FactionTable::matches(reference, unit, allegiance)) {
+        continue;
+      }
+      Vector3 position = unit->get_global_position();
+      float dx = position.x - center.x;
+      float dz = position.z - center.z;
+      float distance_sq = dx * dx + dz * dz;
+      if (distance_sq <= max_range * max_range) {
+        candidates.push_back({distance_sq, unit->get_index_slot(), unit});
+      }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [](const Candidate& a, const Candidate& b) {
+                if (a.distance_sq != b.distance_sq) {
+                  return a.distance_sq < b.distance_sq;
+                }
+                return a.slot < b.slot;
+              });
+
+    int32_t count = std::min(k, static_cast<int32_t>(candidates.size()));
+    bool same = nearest.size() == count;
+    for (int32_t i = 0; same && i < count; ++i) {
+      same = nearest[i] == candidates[i].unit;
+    }
+    if (!same) {
+      mismatches[4]++;
+      DBG_WARN("UnitQueryCheck",
+               "k_nearest mismatch: expected " + String::num_int64(count) +
+                   " units, got " + String::num_int64(nearest.size()));
+    }
+  }
+}
+
+void UnitQueryCheck::_report() {
+  last_results.clear();
+  last_results["queries_per_shape"] = queries_per_shape;
+  int32_t total = 0;
+  for (int32_t shape = 0; shape < SHAPE_COUNT; ++shape) {
+    if (shape == SHAPE_COUNT - 1 && !checked_nearest) {
+      continue;
+    }
+    last_results[SHAPE_NAMES[shape]] = mismatches[shape];
+    total += mismatches[shape];
+  }
+
+  DBG_INFO("UnitQueryCheck",
+           String::num_int64(queries_per_shape) + " queries per shape over " +
+               String::num_int64(unit_count) + " units in " +
+               String::num_int64(PHASE_COUNT) + " rounds: " +
+               String::num_int64(total) + " mismatches");
+}
+
+Dictionary UnitQueryCheck::get_last_results() const {
+  return last_results;
+}
+
+void UnitQueryCheck::set_unit_count(int32_t count) {
+  unit_count = std::max(1, count);
+}
+
+int32_t UnitQueryCheck::get_unit_count() const {
+  return unit_count;
+}
+
+void UnitQueryCheck::set_queries_per_shape(int32_t count) {
+  queries_per_shape = std::max(1, count);
+}
+
+int32_t UnitQueryCheck::get_queries_per_shape() const {
+  return queries_per_shape;
+}
+
+void UnitQueryCheck::set_seed(int64_t new_seed) {
+  seed = new_seed;
+}
+
+int64_t UnitQueryCheck::get_seed() const {
+  return seed;
+}
+
+void UnitQueryCheck::set_run_on_ready(bool enabled) {
+  run_on_ready = enabled;
+}
+
+bool UnitQueryCheck::get_run_on_ready() const {
+  return run_on_ready;
+}
@@ -0,0 +1,89 @@
+#ifndef GDEXTENSION_UNIT_QUERY_CHECK_H
+#define GDEXTENSION_UNIT_QUERY_CHECK_H
+
+#include <cstdint>
+#include <godot_cpp/classes/node3d.hpp>
+#include <godot_cpp/classes/random_number_generator.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <vector>
+
+using godot::Dictionary;
+using godot::Node3D;
+using godot::Ref;
+
+class Unit;
+
+/// Brute-force agreement check for the UnitQuery shapes
+/// Spawns unit_count static Units at seeded random positions (some outside
+/// the UnitIndex grid bounds, so border clamping is covered) over three
+/// factions, waits one physics frame for the grid to index them, then runs
+/// queries_per_shape random queries per shape (sphere, cone, capsule,
+/// oriented rect, k-nearest) and compares each result against a linear scan
+/// of the spawned units:
+/// - Shape results must hold the same set of units
+/// - k-nearest results must match in order
+///
+/// The queries run three times, with a grid rebuild in between: as spawned,
+/// with faction 1 merged into faction 0 (faction 1 disappears from the
+/// grid), then with faction 1 restored. That covers buckets of a faction
+/// that leaves and comes back.
+///
+/// Run it in an otherwise empty scene: other units are ignored by the shape
+/// comparison, and k-nearest is skipped while any are indexed (they would
+/// take places in the result). Mismatches are logged; run_check starts a
+/// run and get_last_results returns the counts once it finished.
+class UnitQueryCheck : public Node3D {
+  GDCLASS(UnitQueryCheck, Node3D)
+
+ protected:
+  static void _bind_methods();
+
+  static constexpr int32_t SHAPE_COUNT = 5;
+  static constexpr int32_t PHASE_COUNT = 3;
+
+  int32_t unit_count = 200;
+  int32_t queries_per_shape = 400;
+  int64_t seed = 1;
+  bool run_on_ready = false;
+
+  std::vector<Unit*> units;
+  Ref<godot::RandomNumberGenerator> rng;
+  std::vector<int32_t> spawn_factions;  // Restored by the last phase
+  int32_t frames_to_wait = 0;           // Physics frames until the queries run
+  int32_t phase = 0;                    // Query round, see the class comment
+  int32_t mismatches[SHAPE_COUNT] = {};
+  bool checked_nearest = true;
+  Dictionary last_results;
+
+  void _spawn_units();
+  void _run_queries();
+  void _set_faction_merged(bool merged);
+  void _report();
+  bool _is_own(const Unit* unit) const;
+
+ public:
+  UnitQueryCheck();
+  ~UnitQueryCheck();
+
+  void _ready() override;
+  void _physics_process(double delta) override;
+
+  /// Spawn the units (first run) and run the queries next physics frame
+  void run_check();
+  /// Checked and mismatched query counts per shape; empty until a run ends
+  Dictionary get_last_results() const;
+
+  void set_unit_count(int32_t count);
+  int32_t get_unit_count() const;
+
+  void set_queries_per_shape(int32_t count);
+  int32_t get_queries_per_shape() const;
+
+  void set_seed(int64_t new_seed);
+  int64_t get_seed() const;
+
+  void set_run_on_ready(bool enabled);
+  bool get_run_on_ready() const;
+};
+
+#endif  // GDEXTENSION_UNIT_QUERY_CHECK_H
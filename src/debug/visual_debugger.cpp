@@ -1,21 +1,70 @@
 #include "visual_debugger.hpp"
 
+#include <algorithm>
 #include <cmath>
-#include <godot_cpp/classes/tree.hpp>
+#include <godot_cpp/classes/array_mesh.hpp>
+#include <godot_cpp/classes/geometry_instance3d.hpp>
+#include <godot_cpp/classes/multi_mesh_instance3d.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/core/object.hpp>
 #include <godot_cpp/core/property_info.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/basis.hpp>
+#include <godot_cpp/variant/packed_vector3_array.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
+#include <utility>
 
+#include "debug_macros.hpp"
+
+using godot::Array;
+using godot::ArrayMesh;
+using godot::Basis;
 using godot::ClassDB;
 using godot::D_METHOD;
-using godot::Mesh;
+using godot::MultiMeshInstance3D;
+using godot::PackedVector3Array;
 using godot::PropertyInfo;
 using godot::UtilityFunctions;
 using godot::Variant;
 
 VisualDebugger* VisualDebugger::singleton_instance = nullptr;
 
+namespace {
+// TRANSFORM_3D row-major 3x4 matrix followed by the instance color
+constexpr int32_t FLOATS_PER_INSTANCE = 16;
+constexpr int32_t MIN_BATCH_CAPACITY = 64;
+constexpr int32_t MIN_CIRCLE_SEGMENTS = 8;
+constexpr int32_t MAX_CIRCLE_SEGMENTS = 128;
+constexpr float TAU = 6.28318530718f;
+
+// Lifted slightly off the ground to prevent Z-fighting
+const Vector3 DRAW_OFFSET(0, 0.01f, 0);
+
+// Scale thickness down to reasonable visual size (max 0.15 units)
+float line_width(float thickness) {
+  return std::min(thickness * 0.05f, 0.15f);
+}
+
+// Unit quad from (-0.5, 0, 0) to (0.5, 0, 1): X spans the width, Z the
+// length, so the basis is (side * width, up, to - from)
+Transform3D line_transform(const Vector3& from,
+                           const Vector3& to,
+                           float thickness) {
+  Vector3 along = to - from;
+  Vector3 side = Vector3(-along.z, 0, along.x);
+  side = side.length_squared() > 0.000001f ? side.normalized()
+                                           : Vector3(1, 0, 0);
+  Vector3 up = side.cross(along);
+  up = up.length_squared() > 0.000001f ? up.normalized() : Vector3(0, 0, 1);
+
+  Basis basis;
+  basis.set_column(0, side * line_width(thickness));
+  basis.set_column(1, up);
+  basis.set_column(2, along);
+  return Transform3D(basis, from + DRAW_OFFSET);
+}
+}  // namespace
+
 VisualDebugger::VisualDebugger() {}
 
 VisualDebugger::~VisualDebugger() {
@@ -49,6 +98,11 @@ void VisualDebugger::_bind_methods() {
       D_METHOD("draw_cross", "center", "size", "color", "thickness"),
       &VisualDebugger::draw_cross, 0.5f, 1.0f);
 
+  ClassDB::bind_method(D_METHOD("set_primitive_position", "handle", "position"),
+                       &VisualDebugger::set_primitive_position);
+  ClassDB::bind_method(D_METHOD("remove_primitive", "handle"),
+                       &VisualDebugger::remove_primitive);
+
   ClassDB::bind_method(D_METHOD("clear"), &VisualDebugger::clear);
 
   ClassDB::bind_method(D_METHOD("set_debug_enabled", "enabled"),
@@ -59,19 +113,36 @@ void VisualDebugger::_bind_methods() {
 
   ADD_PROPERTY(PropertyInfo(Variant::BOOL, "debug_enabled"),
                "set_debug_enabled", "is_debug_enabled");
+
+  ClassDB::bind_method(D_METHOD("set_category_enabled", "category", "enabled"),
+                       &VisualDebugger::_set_category_enabled_bind);
+  ClassDB::bind_method(D_METHOD("is_category_enabled", "category"),
+                       &VisualDebugger::_is_category_enabled_bind);
+
+  ClassDB::bind_method(D_METHOD("set_vertex_budget", "budget"),
+                       &VisualDebugger::set_vertex_budget);
+  ClassDB::bind_method(D_METHOD("get_vertex_budget"),
+                       &VisualDebugger::get_vertex_budget);
+  ADD_PROPERTY(PropertyInfo(Variant::INT, "vertex_budget"),
+               "set_vertex_budget", "get_vertex_budget");
+
+  ClassDB::bind_method(D_METHOD("get_primitive_count"),
+                       &VisualDebugger::get_primitive_count);
+  ClassDB::bind_method(D_METHOD("get_vertex_count"),
+                       &VisualDebugger::get_vertex_count);
+  ClassDB::bind_method(D_METHOD("get_dropped_count"),
+                       &VisualDebugger::get_dropped_count);
 }
 
 void VisualDebugger::_ready() {
-  // Create MeshInstance3D if it doesn't exist
-  if (!mesh_instance) {
-    mesh_instance = memnew(MeshInstance3D);
-    add_child(mesh_instance);
-  }
-
-  // Create ImmediateMesh
-  if (!immediate_mesh.is_valid()) {
-    immediate_mesh.instantiate();
-    mesh_instance->set_mesh(immediate_mesh);
+  // One unshaded material for every batch; instance colors tint it
+  if (material.is_null()) {
+    material.instantiate();
+    material->set_shading_mode(StandardMaterial3D::SHADING_MODE_UNSHADED);
+    material->set_flag(StandardMaterial3D::FLAG_ALBEDO_FROM_VERTEX_COLOR,
+                       true);
+    material->set_transparency(StandardMaterial3D::TRANSPARENCY_ALPHA);
+    material->set_cull_mode(StandardMaterial3D::CULL_DISABLED);
   }
 
   // Set singleton
@@ -80,16 +151,43 @@ void VisualDebugger::_ready() {
 }
 
 void VisualDebugger::_process(double delta) {
-  if (!debug_enabled || !immediate_mesh.is_valid()) {
+  if (!debug_enabled) {
     return;
   }
 
-  // Flush pending draws at end of frame
-  _flush_draws();
+  // Expire primitives; one-frame primitives go once they've been shown
+  float step = static_cast<float>(delta);
+  for (int32_t slot = 0; slot < static_cast<int32_t>(primitives.size());
+       slot++) {
+    Primitive& primitive = primitives[slot];
+    if (primitive.batch < 0 || primitive.persistent) {
+      continue;
+    }
+
+    if (primitive.drawn && primitive.remaining <= 0.0f) {
+      _remove_at(slot);
+      continue;
+    }
+    primitive.drawn = true;
+    primitive.remaining = std::max(0.0f, primitive.remaining - step);
+  }
+
+  // Only batches that changed upload a new buffer
+  for (Batch& batch : batches) {
+    if (batch.dirty) {
+      _fill_batch(batch);
+      batch.dirty = false;
+    }
+  }
 }
 
 void VisualDebugger::clear() {
-  pending_draws.clear();
+  for (int32_t slot = 0; slot < static_cast<int32_t>(primitives.size());
+       slot++) {
+    if (primitives[slot].batch >= 0 && !primitives[slot].persistent) {
+      _remove_at(slot);
+    }
+  }
 }
 
 void VisualDebugger::draw_circle_xz(const Vector3& center,
@@ -102,49 +200,24 @@ void VisualDebugger::draw_circle_xz(const Vector3& center,
     return;
   }
 
-  segments = std::max(segments, 8);
-  float angle_step = 2.0f * 3.14159265f / segments;
+  segments = std::clamp(segments, MIN_CIRCLE_SEGMENTS, MAX_CIRCLE_SEGMENTS);
+  if (filled && should_draw(DebugCategory::GENERAL)) {
+    Basis basis;
+    basis.set_column(0, Vector3(radius, 0, 0));
+    basis.set_column(1, Vector3(0, 1, 0));
+    basis.set_column(2, Vector3(0, 0, radius));
+    _add(_get_disc_batch(segments), Transform3D(basis, center + DRAW_OFFSET),
+         color, 0.0f, DebugCategory::GENERAL);
+  }
 
+  // The hairline ring mesh can't carry a width, so the rim is line quads
+  const std::vector<Vector2>& circle = _get_unit_circle(segments);
   for (int i = 0; i < segments; i++) {
-    float angle1 = i * angle_step;
-    float angle2 = (i + 1) * angle_step;
-
-    // Calculate points on circle in XZ plane
-    float x1 = center.x + radius * std::cos(angle1);
-    float z1 = center.z + radius * std::sin(angle1);
-    float x2 = center.x + radius * std::cos(angle2);
-    float z2 = center.z + radius * std::sin(angle2);
-
-    Vector3 p1(x1, center.y, z1);
-    Vector3 p2(x2, center.y, z2);
-
-    if (filled) {
-      // Draw triangles from center to edge for filled circle
-      PendingDraw draw;
-      draw.type = DrawType::LINE;
-      draw.p1 = center;
-      draw.p2 = p1;
-      draw.color = color;
-      draw.thickness = thickness;
-      pending_draws.push_back(draw);
-
-      draw.p1 = p1;
-      draw.p2 = p2;
-      pending_draws.push_back(draw);
-
-      draw.p1 = p2;
-      draw.p2 = center;
-      pending_draws.push_back(draw);
-    } else {
-      // Draw outline
-      PendingDraw draw;
-      draw.type = DrawType::LINE;
-      draw.p1 = p1;
-      draw.p2 = p2;
-      draw.color = color;
-      draw.thickness = thickness;
-      pending_draws.push_back(draw);
-    }
+    Vector3 from =
+        center + Vector3(circle[i].x * radius, 0, circle[i].y * radius);
+    Vector3 to =
+        center + Vector3(circle[i + 1].x * radius, 0, circle[i + 1].y * radius);
+    add_line(from, to, color, thickness, 0.0f, DebugCategory::GENERAL);
   }
 }
 
@@ -178,13 +251,7 @@ void VisualDebugger::draw_box(const Vector3& center,
   };
 
   for (int i = 0; i < 12; i++) {
-    PendingDraw draw;
-    draw.type = DrawType::LINE;
-    draw.p1 = corners[edges[i][0]];
-    draw.p2 = corners[edges[i][1]];
-    draw.color = color;
-    draw.thickness = thickness;
-    pending_draws.push_back(draw);
+    draw_line(corners[edges[i][0]], corners[edges[i][1]], color, thickness);
   }
 
   // For filled boxes, we'd need to add face drawing logic
@@ -195,17 +262,7 @@ void VisualDebugger::draw_line(const Vector3& from,
                                const Vector3& to,
                                const Color& color,
                                float thickness) {
-  if (!debug_enabled) {
-    return;
-  }
-
-  PendingDraw draw;
-  draw.type = DrawType::LINE;
-  draw.p1 = from;
-  draw.p2 = to;
-  draw.color = color;
-  draw.thickness = thickness;
-  pending_draws.push_back(draw);
+  add_line(from, to, color, thickness, 0.0f, DebugCategory::GENERAL);
 }
 
 void VisualDebugger::draw_sphere(const Vector3& center,
@@ -217,26 +274,14 @@ void VisualDebugger::draw_sphere(const Vector3& center,
     return;
   }
 
-  // Draw as three perpendicular circles (wireframe sphere)
-  // XY circle
-  draw_circle_xz(center, radius, color, segments, thickness, false);
-
-  // XZ circle (already drawn in circle_xz)
-  float angle_step = 2.0f * 3.14159265f / segments;
-  for (int i = 0; i < segments; i++) {
-    float angle1 = i * angle_step;
-    float angle2 = (i + 1) * angle_step;
-
-    float y1 = center.y + radius * std::cos(angle1);
-    float z1 = center.z + radius * std::sin(angle1);
-    float y2 = center.y + radius * std::cos(angle2);
-    float z2 = center.z + radius * std::sin(angle2);
-
-    Vector3 p1(center.x, y1, z1);
-    Vector3 p2(center.x, y2, z2);
-
-    draw_line(p1, p2, color, thickness);
-  }
+  // Draw as three perpendicular circles (wireframe sphere); the ring mesh
+  // lies in its local XZ plane
+  Vector3 x = Vector3(radius, 0, 0);
+  Vector3 y = Vector3(0, radius, 0);
+  Vector3 z = Vector3(0, 0, radius);
+  _add_circle_oriented(center, x, y, z, color, segments);   // XZ
+  _add_circle_oriented(center, y, -x, z, color, segments);  // YZ
+  _add_circle_oriented(center, x, -z, y, color, segments);  // XY
 }
 
 void VisualDebugger::draw_vector(const Vector3& origin,
@@ -295,66 +340,354 @@ void VisualDebugger::draw_cross(const Vector3& center,
             center + Vector3(0, 0, half_size.z), color, thickness);
 }
 
-void VisualDebugger::_flush_draws() {
-  if (!immediate_mesh.is_valid() || pending_draws.empty()) {
-    immediate_mesh->clear_surfaces();
+int32_t VisualDebugger::add_line(const Vector3& from,
+                                 const Vector3& to,
+                                 const Color& color,
+                                 float thickness,
+                                 float duration,
+                                 DebugCategory category) {
+  if (!should_draw(category)) {
+    return INVALID_HANDLE;
+  }
+
+  return _add(_get_line_batch(), line_transform(from, to, thickness), color,
+              duration, category);
+}
+
+int32_t VisualDebugger::add_circle_xz(const Vector3& center,
+                                      float radius,
+                                      const Color& color,
+                                      float duration,
+                                      DebugCategory category,
+                                      int segments) {
+  if (!should_draw(category)) {
+    return INVALID_HANDLE;
+  }
+
+  Basis basis;
+  basis.set_column(0, Vector3(radius, 0, 0));
+  basis.set_column(1, Vector3(0, 1, 0));
+  basis.set_column(2, Vector3(0, 0, radius));
+  return _add(_get_circle_batch(segments),
+              Transform3D(basis, center + DRAW_OFFSET), color, duration,
+              category);
+}
+
+void VisualDebugger::set_primitive_position(int32_t handle,
+                                            const Vector3& position) {
+  int32_t slot = _resolve_handle(handle);
+  if (slot < 0) {
     return;
   }
 
-  // Clear previous frame
-  immediate_mesh->clear_surfaces();
+  Primitive& primitive = primitives[slot];
+  primitive.transform.origin = position + DRAW_OFFSET;
+  batches[primitive.batch].dirty = true;
+}
 
-  // Begin new surface - use triangles for better line thickness support
-  immediate_mesh->surface_begin(Mesh::PRIMITIVE_TRIANGLES);
+void VisualDebugger::remove_primitive(int32_t handle) {
+  int32_t slot = _resolve_handle(handle);
+  if (slot >= 0) {
+    _remove_at(slot);
+  }
+}
 
-  // Add all pending draws
-  for (const auto& draw : pending_draws) {
-    immediate_mesh->surface_set_color(draw.color);
+void VisualDebugger::_add_circle_oriented(const Vector3& center,
+                                          const Vector3& axis_x,
+                                          const Vector3& axis_y,
+                                          const Vector3& axis_z,
+                                          const Color& color,
+                                          int segments) {
+  if (!should_draw(DebugCategory::GENERAL)) {
+    return;
+  }
 
-    // Draw line as a thin rectangle - scale thickness down significantly
-    Vector3 direction = (draw.p2 - draw.p1).normalized();
-    Vector3 perpendicular = Vector3(-direction.z, 0, direction.x).normalized();
+  Basis basis;
+  basis.set_column(0, axis_x);
+  basis.set_column(1, axis_y);
+  basis.set_column(2, axis_z);
+  _add(_get_circle_batch(segments), Transform3D(basis, center + DRAW_OFFSET),
+       color, 0.0f, DebugCategory::GENERAL);
+}
 
-    // Scale thickness down to reasonable visual size (max 0.15 units)
-    float scaled_thickness = std::min(draw.thickness * 0.05f, 0.15f);
-    float half_thickness = scaled_thickness * 0.5f;
+const std::vector<Vector2>& VisualDebugger::_get_unit_circle(
+    int32_t segments) {
+  auto found = unit_circles.find(segments);
+  if (found != unit_circles.end()) {
+    return found->second;
+  }
+
+  // segments + 1 points, the last closing the ring; trig runs once per
+  // segment count, not per draw
+  std::vector<Vector2> circle(segments + 1);
+  for (int32_t i = 0; i < segments; i++) {
+    float angle = TAU * static_cast<float>(i) / static_cast<float>(segments);
+    circle[i] = Vector2(std::cos(angle), std::sin(angle));
+  }
+  circle[segments] = circle[0];
+  return unit_circles.emplace(segments, std::move(circle)).first->second;
+}
 
-    // Offset both in XZ plane and slightly in Y to prevent Z-fighting
-    Vector3 xz_offset = perpendicular * half_thickness;
-    Vector3 y_offset =
-        Vector3(0, 0.01f, 0);  // Small Y offset to prevent Z-fighting
+int32_t VisualDebugger::_get_line_batch() {
+  if (!batches.empty()) {
+    return 0;
+  }
+
+  PackedVector3Array vertices;
+  vertices.push_back(Vector3(-0.5f, 0, 0));
+  vertices.push_back(Vector3(0.5f, 0, 0));
+  vertices.push_back(Vector3(-0.5f, 0, 1));
+  vertices.push_back(Vector3(0.5f, 0, 0));
+  vertices.push_back(Vector3(0.5f, 0, 1));
+  vertices.push_back(Vector3(-0.5f, 0, 1));
+
+  Array arrays;
+  arrays.resize(Mesh::ARRAY_MAX);
+  arrays[Mesh::ARRAY_VERTEX] = vertices;
+  Ref<ArrayMesh> mesh;
+  mesh.instantiate();
+  mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
+  return _create_batch(mesh, vertices.size());
+}
 
-    // Four corners of the rectangle
-    Vector3 p1_top = draw.p1 + xz_offset + y_offset;
-    Vector3 p1_bot = draw.p1 - xz_offset + y_offset;
-    Vector3 p2_top = draw.p2 + xz_offset + y_offset;
-    Vector3 p2_bot = draw.p2 - xz_offset + y_offset;
+int32_t VisualDebugger::_get_circle_batch(int32_t segments) {
+  segments = std::clamp(segments, MIN_CIRCLE_SEGMENTS, MAX_CIRCLE_SEGMENTS);
+  auto found = circle_batches.find(segments);
+  if (found != circle_batches.end()) {
+    return found->second;
+  }
 
-    // First triangle
-    immediate_mesh->surface_add_vertex(p1_top);
-    immediate_mesh->surface_add_vertex(p1_bot);
-    immediate_mesh->surface_add_vertex(p2_top);
+  // Line batch first, so it always sits at index 0
+  _get_line_batch();
+
+  const std::vector<Vector2>& circle = _get_unit_circle(segments);
+  PackedVector3Array vertices;
+  vertices.resize(segments * 2);
+  for (int32_t i = 0; i < segments; i++) {
+    vertices.set(i * 2, Vector3(circle[i].x, 0, circle[i].y));
+    vertices.set(i * 2 + 1, Vector3(circle[i + 1].x, 0, circle[i + 1].y));
+  }
+
+  Array arrays;
+  arrays.resize(Mesh::ARRAY_MAX);
+  arrays[Mesh::ARRAY_VERTEX] = vertices;
+  Ref<ArrayMesh> mesh;
+  mesh.instantiate();
+  mesh->add_surface_from_arrays(Mesh::PRIMITIVE_LINES, arrays);
+
+  int32_t batch_index = _create_batch(mesh, vertices.size());
+  circle_batches[segments] = batch_index;
+  return batch_index;
+}
+
+int32_t VisualDebugger::_get_disc_batch(int32_t segments) {
+  segments = std::clamp(segments, MIN_CIRCLE_SEGMENTS, MAX_CIRCLE_SEGMENTS);
+  auto found = disc_batches.find(segments);
+  if (found != disc_batches.end()) {
+    return found->second;
+  }
 
-    // Second triangle
-    immediate_mesh->surface_add_vertex(p1_bot);
-    immediate_mesh->surface_add_vertex(p2_bot);
-    immediate_mesh->surface_add_vertex(p2_top);
+  // Line batch first, so it always sits at index 0
+  _get_line_batch();
+
+  // Triangle fan from the center, unrolled into a triangle list
+  const std::vector<Vector2>& circle = _get_unit_circle(segments);
+  PackedVector3Array vertices;
+  vertices.resize(segments * 3);
+  for (int32_t i = 0; i < segments; i++) {
+    vertices.set(i * 3, Vector3(0, 0, 0));
+    vertices.set(i * 3 + 1, Vector3(circle[i].x, 0, circle[i].y));
+    vertices.set(i * 3 + 2, Vector3(circle[i + 1].x, 0, circle[i + 1].y));
   }
 
-  // End surface
-  immediate_mesh->surface_end();
+  Array arrays;
+  arrays.resize(Mesh::ARRAY_MAX);
+  arrays[Mesh::ARRAY_VERTEX] = vertices;
+  Ref<ArrayMesh> mesh;
+  mesh.instantiate();
+  mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
 
-  // Clear for next frame
-  pending_draws.clear();
+  int32_t batch_index = _create_batch(mesh, vertices.size());
+  disc_batches[segments] = batch_index;
+  return batch_index;
+}
+
+int32_t VisualDebugger::_create_batch(const Ref<Mesh>& mesh,
+                                      int32_t vertices) {
+  Batch batch;
+  batch.mesh = mesh;
+  batch.vertices_per_instance = vertices;
+  batch.multimesh.instantiate();
+  batch.multimesh->set_transform_format(MultiMesh::TRANSFORM_3D);
+  batch.multimesh->set_use_colors(true);
+  batch.multimesh->set_mesh(mesh);
+  batch.instance = memnew(MultiMeshInstance3D);
+  batch.instance->set_multimesh(batch.multimesh);
+  batch.instance->set_material_override(material);
+  batch.instance->set_cast_shadows_setting(
+      godot::GeometryInstance3D::SHADOW_CASTING_SETTING_OFF);
+  add_child(batch.instance);
+
+  batches.push_back(batch);
+  return static_cast<int32_t>(batches.size()) - 1;
+}
+
+int32_t VisualDebugger::_add(int32_t batch_index,
+                             const Transform3D& transform,
+                             const Color& color,
+                             float duration,
+                             DebugCategory category) {
+  Batch& batch = batches[batch_index];
+  if (vertex_count + batch.vertices_per_instance > vertex_budget) {
+    dropped_count++;
+    if (!budget_warned) {
+      budget_warned = true;
+      DBG_WARN("VisualDebugger",
+               "Vertex budget of " + godot::String::num(vertex_budget) +
+                   " reached, dropping primitives");
+    }
+    return INVALID_HANDLE;
+  }
+
+  // Slots past the mask wouldn't fit in a handle
+  if (free_slots.empty() &&
+      primitives.size() > static_cast<size_t>(HANDLE_SLOT_MASK)) {
+    dropped_count++;
+    return INVALID_HANDLE;
+  }
+
+  int32_t slot;
+  if (!free_slots.empty()) {
+    slot = free_slots.back();
+    free_slots.pop_back();
+  } else {
+    slot = static_cast<int32_t>(primitives.size());
+    primitives.emplace_back();
+  }
+
+  bool persistent = duration < 0.0f;
+  Primitive& primitive = primitives[slot];
+  primitive.batch = batch_index;
+  primitive.index = static_cast<int32_t>(batch.members.size());
+  primitive.transform = transform;
+  primitive.color = color;
+  primitive.remaining = persistent ? 0.0f : duration;
+  primitive.category = category;
+  primitive.persistent = persistent;
+  primitive.drawn = false;
+
+  batch.members.push_back(slot);
+  batch.dirty = true;
+  vertex_count += batch.vertices_per_instance;
+
+  if (!persistent) {
+    return INVALID_HANDLE;
+  }
+  uint32_t generation = primitive.generation & HANDLE_GENERATION_MASK;
+  return static_cast<int32_t>(generation << HANDLE_SLOT_BITS) | slot;
+}
+
+void VisualDebugger::_remove_at(int32_t slot) {
+  Primitive& primitive = primitives[slot];
+  Batch& batch = batches[primitive.batch];
+  int32_t index = primitive.index;
+  int32_t last = static_cast<int32_t>(batch.members.size()) - 1;
+
+  // Swap-remove keeps the batch packed
+  if (index != last) {
+    int32_t moved = batch.members[last];
+    batch.members[index] = moved;
+    primitives[moved].index = index;
+  }
+  batch.members.pop_back();
+  batch.dirty = true;
+  vertex_count -= batch.vertices_per_instance;
+
+  // A new generation invalidates every handle to this primitive
+  uint32_t generation = primitive.generation + 1;
+  primitive = Primitive();
+  primitive.generation = generation;
+  free_slots.push_back(slot);
+}
+
+int32_t VisualDebugger::_resolve_handle(int32_t handle) const {
+  if (handle < 0) {
+    return -1;
+  }
+
+  int32_t slot = handle & HANDLE_SLOT_MASK;
+  uint32_t generation = static_cast<uint32_t>(handle) >> HANDLE_SLOT_BITS;
+  if (slot >= static_cast<int32_t>(primitives.size())) {
+    return -1;
+  }
+
+  const Primitive& primitive = primitives[slot];
+  if (primitive.batch < 0 || !primitive.persistent ||
+      (primitive.generation & HANDLE_GENERATION_MASK) != generation) {
+    return -1;
+  }
+  return slot;
+}
+
+void VisualDebugger::_grow_batch(Batch& batch, int32_t capacity) {
+  if (capacity <= batch.capacity) {
+    return;
+  }
+
+  // Doubling keeps MultiMesh reallocations rare
+  int32_t new_capacity =
+      std::max({capacity, batch.capacity * 2, MIN_BATCH_CAPACITY});
+  batch.multimesh->set_instance_count(new_capacity);
+  batch.buffer.resize(new_capacity * FLOATS_PER_INSTANCE);
+  batch.capacity = new_capacity;
+}
+
+void VisualDebugger::_fill_batch(Batch& batch) {
+  _grow_batch(batch, static_cast<int32_t>(batch.members.size()));
+
+  int32_t count = 0;
+  float* out = batch.capacity > 0 ? batch.buffer.ptrw() : nullptr;
+  for (int32_t slot : batch.members) {
+    const Primitive& primitive = primitives[slot];
+    if (!is_category_enabled(primitive.category)) {
+      continue;
+    }
+
+    const Basis& basis = primitive.transform.basis;
+    const Vector3& origin = primitive.transform.origin;
+    for (int row = 0; row < 3; row++) {
+      out[row * 4] = basis.rows[row].x;
+      out[row * 4 + 1] = basis.rows[row].y;
+      out[row * 4 + 2] = basis.rows[row].z;
+    }
+    out[3] = origin.x;
+    out[7] = origin.y;
+    out[11] = origin.z;
+    out[12] = primitive.color.r;
+    out[13] = primitive.color.g;
+    out[14] = primitive.color.b;
+    out[15] = primitive.color.a;
+    out += FLOATS_PER_INSTANCE;
+    count++;
+  }
+
+  if (count == 0 && batch.drawn == 0) {
+    return;
+  }
+  batch.multimesh->set_visible_instance_count(count);
+  if (count > 0) {
+    batch.multimesh->set_buffer(batch.buffer);
+  }
+  batch.drawn = count;
 }
 
 void VisualDebugger::set_debug_enabled(bool enabled) {
   debug_enabled = enabled;
-  if (mesh_instance) {
-    mesh_instance->set_visible(enabled);
+  for (Batch& batch : batches) {
+    batch.instance->set_visible(enabled);
   }
   if (!enabled) {
-    pending_draws.clear();
+    clear();
   }
 }
 
@@ -362,6 +695,58 @@ bool VisualDebugger::is_debug_enabled() const {
   return debug_enabled;
 }
 
+void VisualDebugger::set_category_enabled(DebugCategory category,
+                                          bool enabled) {
+  uint32_t bit = 1u << static_cast<uint32_t>(category);
+  category_mask = enabled ? (category_mask | bit) : (category_mask & ~bit);
+  for (Batch& batch : batches) {
+    batch.dirty = true;
+  }
+}
+
+bool VisualDebugger::is_category_enabled(DebugCategory category) const {
+  return (category_mask & (1u << static_cast<uint32_t>(category))) != 0;
+}
+
+bool VisualDebugger::should_draw(DebugCategory category) const {
+  return debug_enabled && is_category_enabled(category);
+}
+
+void VisualDebugger::_set_category_enabled_bind(int category, bool enabled) {
+  if (category < 0 || category >= static_cast<int>(DebugCategory::COUNT)) {
+    return;
+  }
+  set_category_enabled(static_cast<DebugCategory>(category), enabled);
+}
+
+bool VisualDebugger::_is_category_enabled_bind(int category) const {
+  if (category < 0 || category >= static_cast<int>(DebugCategory::COUNT)) {
+    return false;
+  }
+  return is_category_enabled(static_cast<DebugCategory>(category));
+}
+
+void VisualDebugger::set_vertex_budget(int32_t budget) {
+  vertex_budget = std::max(0, budget);
+  budget_warned = false;
+}
+
+int32_t VisualDebugger::get_vertex_budget() const {
+  return vertex_budget;
+}
+
+int32_t VisualDebugger::get_primitive_count() const {
+  return static_cast<int32_t>(primitives.size() - free_slots.size());
+}
+
+int32_t VisualDebugger::get_vertex_count() const {
+  return vertex_count;
+}
+
+int32_t VisualDebugger::get_dropped_count() const {
+  return dropped_count;
+}
+
 VisualDebugger* VisualDebugger::get_singleton() {
   return singleton_instance;
 }
@@ -1,60 +1,124 @@
 #ifndef GDEXTENSION_VISUAL_DEBUGGER_H
 #define GDEXTENSION_VISUAL_DEBUGGER_H
 
-#include <godot_cpp/classes/immediate_mesh.hpp>
-#include <godot_cpp/classes/mesh_instance3d.hpp>
+#include <cstdint>
+#include <godot_cpp/classes/mesh.hpp>
+#include <godot_cpp/classes/multi_mesh.hpp>
 #include <godot_cpp/classes/node3d.hpp>
+#include <godot_cpp/classes/standard_material3d.hpp>
 #include <godot_cpp/variant/color.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+#include <godot_cpp/variant/vector2.hpp>
 #include <godot_cpp/variant/vector3.hpp>
+#include <unordered_map>
 #include <vector>
 
 using godot::Color;
-using godot::ImmediateMesh;
-using godot::MeshInstance3D;
+using godot::Mesh;
+using godot::MultiMesh;
 using godot::Node3D;
+using godot::PackedFloat32Array;
 using godot::Ref;
+using godot::StandardMaterial3D;
+using godot::Transform3D;
+using godot::Vector2;
 using godot::Vector3;
 
-enum class DrawType {
-  LINE,
-  CIRCLE,
-  SPHERE,
-  VECTOR,
+namespace godot {
+class MultiMeshInstance3D;
+}  // namespace godot
+
+/// Groups of debug drawing that can be toggled independently
+enum class DebugCategory : uint8_t {
+  GENERAL = 0,
+  PROJECTILES,
+  ABILITIES,
+  INPUT,
+  CHANNELS,
+  COUNT,
 };
 
-struct PendingDraw {
-  DrawType type;
-  Vector3 p1;
-  Vector3 p2;
-  Vector3 center;       // For circles, spheres
-  float radius = 0.0f;  // For circles, spheres
-  Color color;
-  float thickness = 1.0f;  // Line thickness in units
-  bool filled = false;     // Whether to fill shapes
-  int segments = 32;       // For circles, spheres
-};
-
-/// Visual debugger using ImmediateMesh for real-time drawing
-/// Draws immediately to viewport without creating persistent objects
+/// Visual debugger drawing lines and circles through instanced meshes
+/// Every primitive is one MultiMesh instance: lines are a unit quad
+/// stretched between their end points, circles a unit ring or disc (one
+/// mesh per segment count, built once from a cached unit-circle table)
+/// scaled to their radius. Boxes, spheres, vectors and crosses are built
+/// from those.
+///
+/// Unit rings are hairlines (PRIMITIVE_LINES). draw_circle_xz builds its
+/// rim from line quads instead so thickness still applies; add_circle_xz
+/// and draw_sphere keep the single-instance hairline ring.
+///
+/// Primitives live until their duration runs out:
+/// - draw_* calls last one frame (duration 0), as before
+/// - add_line/add_circle_xz take a duration in seconds, or
+///   LIFETIME_PERSISTENT for shapes the caller moves with
+///   set_primitive_position and ends with remove_primitive
+///
+/// Each batch's instance buffer is only refilled on frames where one of
+/// its primitives was added, moved or removed, so persistent shapes cost
+/// nothing while they stand still. Categories can be hidden individually,
+/// and vertex_budget caps the drawn vertices; primitives past the budget
+/// are dropped (see get_dropped_count).
 class VisualDebugger : public Node3D {
   GDCLASS(VisualDebugger, Node3D)
 
  protected:
   static void _bind_methods();
 
+  struct Primitive {
+    int32_t batch = -1;  // -1 = free slot
+    int32_t index = -1;  // Position in the batch's packed members
+    Transform3D transform;
+    Color color;
+    float remaining = 0.0f;  // Seconds left
+    DebugCategory category = DebugCategory::GENERAL;
+    bool persistent = false;  // Lives until remove_primitive
+    bool drawn = false;       // Shown at least once (one-frame primitives)
+    uint32_t generation = 0;  // Bumped when the slot is freed
+  };
+
+  struct Batch {
+    Ref<Mesh> mesh;
+    godot::MultiMeshInstance3D* instance = nullptr;
+    Ref<MultiMesh> multimesh;
+    int32_t vertices_per_instance = 0;
+    int32_t capacity = 0;  // MultiMesh instance_count
+    int32_t drawn = 0;     // Visible instances at the last fill
+    bool dirty = false;    // Needs a refill on the next frame
+    PackedFloat32Array buffer;  // 16 floats per instance, reused
+    std::vector<int32_t> members;  // Packed primitive slots
+  };
+
   bool debug_enabled = true;
-  MeshInstance3D* mesh_instance = nullptr;
-  Ref<ImmediateMesh> immediate_mesh = nullptr;
-  std::vector<PendingDraw> pending_draws;
+  uint32_t category_mask = 0xFFFFFFFFu;
+  int32_t vertex_budget = 200000;
+
+  Ref<StandardMaterial3D> material;
+  std::vector<Batch> batches;  // 0 = lines, then rings and discs
+  std::unordered_map<int32_t, int32_t> circle_batches;  // Segments -> batch
+  std::unordered_map<int32_t, int32_t> disc_batches;    // Segments -> batch
+  std::unordered_map<int32_t, std::vector<Vector2>> unit_circles;
+
+  std::vector<Primitive> primitives;
+  std::vector<int32_t> free_slots;
+  int32_t vertex_count = 0;
+  int32_t dropped_count = 0;
+  bool budget_warned = false;
 
  public:
+  static constexpr int32_t INVALID_HANDLE = -1;
+  static constexpr float LIFETIME_PERSISTENT = -1.0f;
+
   VisualDebugger();
   ~VisualDebugger();
 
   void _ready() override;
   void _process(double delta) override;
 
-  // Draw functions - queue up draws for flushing at end of frame
+  // Draw functions - shown for one frame
+  /// Rim of line quads honouring thickness; filled adds a solid disc
   void draw_circle_xz(const Vector3& center,
                       float radius,
                       const Color& color = Color(0, 1, 0, 1),
@@ -90,17 +154,85 @@ class VisualDebugger : public Node3D {
                   const Color& color = Color(1, 0, 0, 1),
                   float thickness = 1.0f);
 
+  // Primitives with a lifetime; the handle is only returned for
+  // LIFETIME_PERSISTENT primitives (timed ones free themselves)
+  // Handles pack the slot and its generation, so a handle kept after
+  // remove_primitive never moves or removes the primitive reusing its slot
+  int32_t add_line(const Vector3& from,
+                   const Vector3& to,
+                   const Color& color,
+                   float thickness,
+                   float duration,
+                   DebugCategory category);
+
+  int32_t add_circle_xz(const Vector3& center,
+                        float radius,
+                        const Color& color,
+                        float duration,
+                        DebugCategory category,
+                        int segments = 32);
+
+  /// Move a persistent primitive (circle center / line start)
+  void set_primitive_position(int32_t handle, const Vector3& position);
+  void remove_primitive(int32_t handle);
+
+  /// Remove every non-persistent primitive
   void clear();
 
   void set_debug_enabled(bool enabled);
   bool is_debug_enabled() const;
 
+  void set_category_enabled(DebugCategory category, bool enabled);
+  bool is_category_enabled(DebugCategory category) const;
+  /// Debugging on and category shown; callers check before building shapes
+  bool should_draw(DebugCategory category) const;
+
+  void set_vertex_budget(int32_t budget);
+  int32_t get_vertex_budget() const;
+
+  int32_t get_primitive_count() const;
+  int32_t get_vertex_count() const;
+  int32_t get_dropped_count() const;
+
   static VisualDebugger* get_singleton();
 
  private:
   static VisualDebugger* singleton_instance;
 
-  void _flush_draws();
+  // Bound (int) wrappers for categories
+  void _set_category_enabled_bind(int category, bool enabled);
+  bool _is_category_enabled_bind(int category) const;
+
+  const std::vector<Vector2>& _get_unit_circle(int32_t segments);
+  int32_t _get_line_batch();
+  int32_t _get_circle_batch(int32_t segments);
+  int32_t _get_disc_batch(int32_t segments);
+  int32_t _create_batch(const Ref<Mesh>& mesh, int32_t vertices);
+
+  int32_t _add(int32_t batch_index,
+               const Transform3D& transform,
+               const Color& color,
+               float duration,
+               DebugCategory category);
+  void _remove_at(int32_t slot);
+  /// Slot of a live persistent primitive, or -1 for a stale handle
+  int32_t _resolve_handle(int32_t handle) const;
+
+  // Low bits of a handle are the slot, the rest its generation (kept
+  // positive, so handles never collide with INVALID_HANDLE)
+  static constexpr int32_t HANDLE_SLOT_BITS = 20;
+  static constexpr int32_t HANDLE_SLOT_MASK = (1 << HANDLE_SLOT_BITS) - 1;
+  static constexpr uint32_t HANDLE_GENERATION_MASK =
+      (1u << (31 - HANDLE_SLOT_BITS)) - 1;
+
+  void _add_circle_oriented(const Vector3& center,
+                            const Vector3& axis_x,
+                            const Vector3& axis_y,
+                            const Vector3& axis_z,
+                            const Color& color,
+                            int segments);
+  void _fill_batch(Batch& batch);
+  void _grow_batch(Batch& batch, int32_t capacity);
 };
 
 #endif  // GDEXTENSION_VISUAL_DEBUGGER_H
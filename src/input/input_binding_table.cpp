@@ -0,0 +1,82 @@
+#include "input_binding_table.hpp"
+
+void InputBindingTable::resolve(const String& move_action,
+                                const String& cast_action) {
+  set_action_name(InputAction::STOP, "game_stop");
+  for (int32_t i = 0; i < ABILITY_KEY_COUNT; ++i) {
+    set_action_name(ability_action(i),
+                    "game_ability_" + String::num_int64(i + 1));
+  }
+  set_action_name(InputAction::MOVE, move_action);
+  set_action_name(InputAction::CAST, cast_action);
+}
+
+void InputBindingTable::set_action_name(InputAction action,
+                                        const String& name) {
+  if (action >= InputAction::COUNT) {
+    return;
+  }
+  action_names[static_cast<size_t>(action)] = StringName(name);
+}
+
+const StringName& InputBindingTable::get_action_name(
+    InputAction action) const {
+  return action_names[static_cast<size_t>(action)];
+}
+
+InputAction InputBindingTable::match_key_action(
+    const Ref<InputEvent>& event) const {
+  for (size_t i = static_cast<size_t>(InputAction::STOP);
+       i <= static_cast<size_t>(InputAction::ABILITY_6); ++i) {
+    if (event->is_action_pressed(action_names[i])) {
+      return static_cast<InputAction>(i);
+    }
+  }
+  return InputAction::COUNT;
+}
+
+bool InputBindingTable::is_pressed(const Ref<InputEvent>& event,
+                                   InputAction action) const {
+  return event->is_action_pressed(get_action_name(action));
+}
+
+int32_t InputBindingTable::find_ability_key(const String& action_name) const {
+  for (int32_t i = 0; i < ABILITY_KEY_COUNT; ++i) {
+    if (String(get_action_name(ability_action(i))) == action_name) {
+      return i;
+    }
+  }
+  return UNBOUND;
+}
+
+void InputBindingTable::bind_ability_key(int32_t key_index,
+                                         int32_t ability_slot) {
+  if (key_index < 0 || key_index >= ABILITY_KEY_COUNT) {
+    return;
+  }
+  ability_slots[key_index] = ability_slot;
+}
+
+int32_t InputBindingTable::get_ability_slot(int32_t key_index) const {
+  if (key_index < 0 || key_index >= ABILITY_KEY_COUNT) {
+    return UNBOUND;
+  }
+  return ability_slots[key_index];
+}
+
+bool InputBindingTable::is_ability_action(InputAction action) {
+  return action >= InputAction::ABILITY_1 && action <= InputAction::ABILITY_6;
+}
+
+int32_t InputBindingTable::ability_key_of(InputAction action) {
+  if (!is_ability_action(action)) {
+    return UNBOUND;
+  }
+  return static_cast<int32_t>(action) -
+         static_cast<int32_t>(InputAction::ABILITY_1);
+}
+
+InputAction InputBindingTable::ability_action(int32_t key_index) {
+  return static_cast<InputAction>(
+      static_cast<int32_t>(InputAction::ABILITY_1) + key_index);
+}
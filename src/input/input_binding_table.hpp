@@ -0,0 +1,70 @@
+#ifndef GDEXTENSION_INPUT_BINDING_TABLE_H
+#define GDEXTENSION_INPUT_BINDING_TABLE_H
+
+#include <array>
+#include <cstdint>
+#include <godot_cpp/classes/input_event.hpp>
+#include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+using godot::InputEvent;
+using godot::Ref;
+using godot::String;
+using godot::StringName;
+
+/// Input actions InputManager reacts to, in match order
+enum class InputAction : uint8_t {
+  STOP = 0,
+  ABILITY_1,
+  ABILITY_2,
+  ABILITY_3,
+  ABILITY_4,
+  ABILITY_5,
+  ABILITY_6,
+  MOVE,
+  CAST,
+  COUNT,
+};
+
+/// Action names and ability keybinds, resolved ahead of input handling
+/// Every action's StringName is built once (resolve at _ready, or when an
+/// action is renamed) and kept in a fixed array indexed by InputAction.
+/// Ability keys (game_ability_1..6) map to ability slots through a second
+/// fixed array, so rebinding a key writes one entry and input handling
+/// never builds, converts or hashes a String.
+class InputBindingTable {
+ public:
+  static constexpr int32_t ABILITY_KEY_COUNT = 6;
+  static constexpr int32_t UNBOUND = -1;
+
+  InputBindingTable() = default;
+  ~InputBindingTable() = default;
+
+  /// Build every action's StringName (names of game_ability_N are fixed)
+  void resolve(const String& move_action, const String& cast_action);
+  void set_action_name(InputAction action, const String& name);
+  const StringName& get_action_name(InputAction action) const;
+
+  /// First of STOP, ABILITY_1..6 pressed by the event, or COUNT
+  InputAction match_key_action(const Ref<InputEvent>& event) const;
+  bool is_pressed(const Ref<InputEvent>& event, InputAction action) const;
+
+  /// Ability key index (0-5) of an action name, or UNBOUND
+  int32_t find_ability_key(const String& action_name) const;
+  void bind_ability_key(int32_t key_index, int32_t ability_slot);
+  /// Ability slot bound to a key index, or UNBOUND
+  int32_t get_ability_slot(int32_t key_index) const;
+
+  static bool is_ability_action(InputAction action);
+  static int32_t ability_key_of(InputAction action);
+  static InputAction ability_action(int32_t key_index);
+
+ private:
+  std::array<StringName, static_cast<size_t>(InputAction::COUNT)>
+      action_names;
+  std::array<int32_t, ABILITY_KEY_COUNT> ability_slots = {
+      UNBOUND, UNBOUND, UNBOUND, UNBOUND, UNBOUND, UNBOUND};
+};
+
+#endif  // GDEXTENSION_INPUT_BINDING_TABLE_H
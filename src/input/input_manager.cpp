@@ -1,9 +1,11 @@
 #include "input_manager.hpp"
 
+#include <algorithm>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/input.hpp>
 #include <godot_cpp/classes/input_event_key.hpp>
 #include <godot_cpp/classes/input_event_mouse_button.hpp>
+#include <godot_cpp/classes/input_event_mouse_motion.hpp>
 #include <godot_cpp/classes/input_map.hpp>
 #include <godot_cpp/classes/node3d.hpp>
 #include <godot_cpp/classes/physics_direct_space_state3d.hpp>
@@ -11,6 +13,7 @@
 #include <godot_cpp/classes/viewport.hpp>
 #include <godot_cpp/classes/world3d.hpp>
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/object.hpp>
 #include <godot_cpp/core/property_info.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
 #include <godot_cpp/variant/string.hpp>
@@ -19,23 +22,30 @@
 #include <godot_cpp/variant/variant.hpp>
 #include <godot_cpp/variant/vector2.hpp>
 
+#include "../common/allegiance.hpp"
 #include "../common/unit_signals.hpp"
 #include "../components/abilities/ability_component.hpp"
 #include "../components/abilities/ability_node.hpp"
 #include "../components/interaction/interactable.hpp"
+#include "../core/faction_table.hpp"
 #include "../core/game_settings.hpp"
 #include "../core/unit.hpp"
 #include "../debug/debug_macros.hpp"
 #include "../debug/visual_debugger.hpp"
+#include "../systems/proxy_minion_system.hpp"
+#include "../visual/highlight/highlight_system.hpp"
+#include "screen_picker.hpp"
 
 using godot::ClassDB;
 using godot::D_METHOD;
 using godot::Dictionary;
 using godot::Engine;
 using godot::InputEventMouseButton;
+using godot::InputEventMouseMotion;
 using godot::MOUSE_BUTTON_RIGHT;
 using godot::Node;
 using godot::Node3D;
+using godot::ObjectDB;
 using godot::PhysicsRayQueryParameters3D;
 using godot::PropertyInfo;
 using godot::String;
@@ -43,7 +53,9 @@ using godot::UtilityFunctions;
 using godot::Variant;
 using godot::Vector2;
 
-InputManager::InputManager() = default;
+InputManager::InputManager() {
+  bindings.resolve(move_action, cast_action);
+}
 
 InputManager::~InputManager() {
   if (click_marker != nullptr) {
@@ -137,28 +149,35 @@ void InputManager::_input(const Ref<InputEvent>& event) {
     return;
   }
 
-  // Check for stop command (S key)
-  if (event->is_action_pressed(godot::StringName("game_stop"))) {
-    _handle_stop_command();
-    get_viewport()->set_input_as_handled();
+  // Mouse motion never presses an action, and with a high polling rate
+  // mouse it is most of what arrives here
+  if (Object::cast_to<InputEventMouseMotion>(event.ptr()) != nullptr) {
     return;
   }
 
-  // Check for keyboard input (ability slots 1-6)
-  // Support up to 6 ability slots via game_ability_1 through game_ability_6
-  // actions
-  for (int i = 1; i <= 6; i++) {
-    String action_name =
-        String("game_ability_") + String::num(i, 0);  // Force integer format
-    StringName action_sname = godot::StringName(action_name);
+  // Dispatch key actions (stop, ability slots 1-6) through the
+  // precomputed action table
+  InputAction key_action = bindings.match_key_action(event);
+  switch (key_action) {
+    case InputAction::STOP:
+      _handle_stop_command();
+      get_viewport()->set_input_as_handled();
+      return;
 
-    // Check for ability key press
-    if (event->is_action_pressed(action_sname)) {
+    case InputAction::ABILITY_1:
+    case InputAction::ABILITY_2:
+    case InputAction::ABILITY_3:
+    case InputAction::ABILITY_4:
+    case InputAction::ABILITY_5:
+    case InputAction::ABILITY_6:
       // Cancel any existing targeting state when pressing a new ability key
       _cancel_targeting();
-      _handle_ability_input(action_name);
-      break;  // Only process one ability key per input event
-    }
+      _handle_ability_input(bindings.get_ability_slot(
+          InputBindingTable::ability_key_of(key_action)));
+      break;
+
+    default:
+      break;
   }
 
   // Check for mouse button click
@@ -172,53 +191,51 @@ void InputManager::_input(const Ref<InputEvent>& event) {
   }
 
   // Check which action was triggered
-  bool is_cast_action =
-      event->is_action_pressed(godot::StringName(cast_action));
-  bool is_move_action =
-      event->is_action_pressed(godot::StringName(move_action));
+  bool is_cast_action = bindings.is_pressed(event, InputAction::CAST);
+  bool is_move_action = bindings.is_pressed(event, InputAction::MOVE);
 
   // If waiting for ability target, handle click for ability
   if (awaiting_target_slot >= 0 && is_cast_action) {
-    Vector3 click_position;
-    godot::Object* clicked_object = nullptr;
-    if (_try_raycast(click_position, clicked_object)) {
-      auto ability_component = controlled_unit->get_ability_component();
-      if (ability_component != nullptr) {
-        AbilityNode* ability =
-            ability_component->get_ability(awaiting_target_slot);
-        int cast_type = ability != nullptr ? ability->get_cast_type() : 0;
-
-        if (is_awaiting_unit_target) {
-          // Unit-target ability: only cast if valid target clicked
-          if (clicked_object != nullptr) {
-            ability_component->try_cast(awaiting_target_slot, clicked_object);
-            awaiting_target_slot = -1;
-          } else {
-            // No target clicked - stay in targeting mode
-            DBG_INFO("InputManager", "No valid target. Click on a unit.");
-            return;
-          }
-        } else {
-          // Position-target or skillshot ability: cast at clicked position
-          ability_component->try_cast_point(awaiting_target_slot,
-                                            click_position);
-          // Clear targeting mode
-          awaiting_target_slot = -1;
-        }
+    auto ability_component = controlled_unit->get_ability_component();
+    if (ability_component == nullptr) {
+      return;
+    }
 
-        // Log appropriate message based on ability type
-        if (cast_type == 2) {  // CHANNEL
-          DBG_INFO("InputManager", "Channel started on ability slot " +
-                                       String::num(awaiting_target_slot) +
-                                       " - use S (stop) to interrupt");
-        } else {
-          DBG_INFO("InputManager", "Cast ability at target");
-        }
+    AbilityNode* ability = ability_component->get_ability(awaiting_target_slot);
+    int cast_type = ability != nullptr ? ability->get_cast_type() : 0;
 
-        get_viewport()->set_input_as_handled();
+    if (is_awaiting_unit_target) {
+      // Unit-target ability: only cast if valid target clicked
+      Unit* clicked_unit = _pick_unit(FactionTable::ALL_FACTIONS);
+      if (clicked_unit == nullptr) {
+        // No target clicked - stay in targeting mode
+        DBG_INFO("InputManager", "No valid target. Click on a unit.");
+        return;
+      }
+      ability_component->try_cast(awaiting_target_slot, clicked_unit);
+      awaiting_target_slot = -1;
+    } else {
+      // Position-target or skillshot ability: cast at clicked terrain point
+      Vector3 click_position;
+      godot::Object* clicked_object = nullptr;
+      if (!_try_raycast(click_position, clicked_object)) {
         return;
       }
+      ability_component->try_cast_point(awaiting_target_slot, click_position);
+      // Clear targeting mode
+      awaiting_target_slot = -1;
+    }
+
+    // Log appropriate message based on ability type
+    if (cast_type == 2) {  // CHANNEL
+      DBG_INFO("InputManager", "Channel started on ability slot " +
+                                   String::num(awaiting_target_slot) +
+                                   " - use S (stop) to interrupt");
+    } else {
+      DBG_INFO("InputManager", "Cast ability at target");
     }
+
+    get_viewport()->set_input_as_handled();
     return;
   }
 
@@ -232,9 +249,14 @@ void InputManager::_input(const Ref<InputEvent>& event) {
   // Cancel any existing targeting state when attempting movement/attack
   _cancel_targeting();
 
+  // Enemy units come from the screen picker, so allies and neutrals under
+  // the cursor don't swallow the click; terrain and interactables need the
+  // physics ray
   Vector3 click_position;
-  godot::Object* clicked_object = nullptr;
-  if (_try_raycast(click_position, clicked_object)) {
+  godot::Object* clicked_object = _pick_unit(FactionTable::get_faction_mask(
+      controlled_unit->get_faction_id(), Allegiance::ENEMY));
+  if (clicked_object != nullptr ||
+      _try_raycast(click_position, clicked_object)) {
     if (auto clicked_unit = Object::cast_to<Unit>(clicked_object)) {
       if (clicked_unit == controlled_unit) {
         // Ignore right-clicks on the main unit itself.
@@ -242,19 +264,17 @@ void InputManager::_input(const Ref<InputEvent>& event) {
         return;
       }
 
-      // Allies: do nothing.
-      if (clicked_unit->get_faction_id() == controlled_unit->get_faction_id()) {
+      // Enemies: relay ATTACK order
+      // Allies and neutrals the ray hit fall through to a move order
+      if (FactionTable::are_enemies(controlled_unit->get_faction_id(),
+                                    clicked_unit->get_faction_id())) {
+        controlled_unit->relay(attack_requested, clicked_unit,
+                               clicked_unit->get_global_position());
+        DBG_INFO("InputManager", "Issued ATTACK order on: " +
+                                     String(clicked_unit->get_name()));
         get_viewport()->set_input_as_handled();
         return;
       }
-
-      // Enemies: relay ATTACK order
-      controlled_unit->relay(attack_requested, clicked_unit,
-                             clicked_unit->get_global_position());
-      DBG_INFO("InputManager",
-               "Issued ATTACK order on: " + String(clicked_unit->get_name()));
-      get_viewport()->set_input_as_handled();
-      return;
     }
 
     if (auto clicked_interactable =
@@ -265,6 +285,17 @@ void InputManager::_input(const Ref<InputEvent>& event) {
       return;
     }
 
+    // Proxy minions have no colliders: test them against the same ray,
+    // up to where it met the terrain
+    int64_t proxy = _pick_enemy_proxy(
+        camera->get_global_position().distance_to(click_position));
+    if (proxy != ProxyMinionSystem::INVALID_HANDLE) {
+      controlled_unit->relay(attack_proxy_requested, proxy);
+      DBG_INFO("InputManager", "Issued ATTACK order on a proxy minion");
+      get_viewport()->set_input_as_handled();
+      return;
+    }
+
     // Default: treat as terrain/world click.
     controlled_unit->relay(move_requested, click_position);
     _show_click_marker(click_position);
@@ -284,7 +315,7 @@ void InputManager::_process(double delta) {
   if (awaiting_target_slot >= 0 && controlled_unit != nullptr &&
       camera != nullptr) {
     VisualDebugger* debugger = VisualDebugger::get_singleton();
-    if (debugger != nullptr && debugger->is_debug_enabled()) {
+    if (debugger != nullptr && debugger->should_draw(DebugCategory::INPUT)) {
       // Get mouse position and raycast to ground
       Vector3 mouse_pos;
       godot::Object* dummy = nullptr;
@@ -298,15 +329,15 @@ void InputManager::_process(double delta) {
             float aoe_radius = ability->get_aoe_radius();
 
             // Draw aiming line from caster to cursor (yellow - very visible)
-            debugger->draw_line(caster_pos, mouse_pos, godot::Color(1, 1, 0, 1),
-                                1.0f);
+            debugger->add_line(caster_pos, mouse_pos, godot::Color(1, 1, 0, 1),
+                               1.0f, 0.0f, DebugCategory::INPUT);
 
             // Draw AoE radius at cursor position (bright green - shows impact
             // area)
             if (aoe_radius > 0.01f) {
-              debugger->draw_circle_xz(mouse_pos, aoe_radius,
-                                       godot::Color(0, 1, 0, 1), 32, 1.0f,
-                                       false);
+              debugger->add_circle_xz(mouse_pos, aoe_radius,
+                                      godot::Color(0, 1, 0, 1), 0.0f,
+                                      DebugCategory::INPUT);
             }
           }
         }
@@ -349,6 +380,7 @@ Ref<PackedScene> InputManager::get_click_indicator_scene() const {
 
 void InputManager::set_move_action(const String& action) {
   move_action = action;
+  bindings.set_action_name(InputAction::MOVE, action);
   DBG_INFO("InputManager", "Move action set to: " + action);
 }
 
@@ -358,6 +390,7 @@ String InputManager::get_move_action() const {
 
 void InputManager::set_cast_action(const String& action) {
   cast_action = action;
+  bindings.set_action_name(InputAction::CAST, action);
   DBG_INFO("InputManager", "Cast action set to: " + action);
 }
 
@@ -443,6 +476,30 @@ bool InputManager::_try_raycast(Vector3& out_position,
   return true;
 }
 
+int64_t InputManager::_pick_enemy_proxy(float max_distance) const {
+  ProxyMinionSystem* proxies = ProxyMinionSystem::get_singleton();
+  if (proxies == nullptr || camera == nullptr || controlled_unit == nullptr) {
+    return ProxyMinionSystem::INVALID_HANDLE;
+  }
+
+  // Allied proxies in front of an enemy don't swallow the click
+  Vector2 mouse_pos = get_viewport()->get_mouse_position();
+  uint32_t enemy_mask = FactionTable::get_faction_mask(
+      controlled_unit->get_faction_id(), Allegiance::ENEMY);
+  return proxies->pick_ray(camera->project_ray_origin(mouse_pos),
+                           camera->project_ray_normal(mouse_pos),
+                           max_distance, enemy_mask);
+}
+
+Unit* InputManager::_pick_unit(uint32_t faction_mask) const {
+  if (camera == nullptr) {
+    return nullptr;
+  }
+
+  return ScreenPicker::pick(camera, get_viewport()->get_mouse_position(),
+                            faction_mask, controlled_unit);
+}
+
 void InputManager::_show_click_marker(const Vector3& position) {
   // Clean up old marker if it exists
   if (click_marker != nullptr) {
@@ -514,23 +571,27 @@ void InputManager::bind_ability_to_key(const String& key, int ability_slot) {
              "Invalid ability slot: " + String::num(ability_slot));
     return;
   }
-  keybind_map[key] = ability_slot;
+  int32_t key_index = bindings.find_ability_key(key);
+  if (key_index == InputBindingTable::UNBOUND) {
+    DBG_INFO("InputManager", "Not an ability action: " + key);
+    return;
+  }
+  bindings.bind_ability_key(key_index, ability_slot);
   DBG_INFO("InputManager",
            "Bound " + key + " to ability slot " + String::num(ability_slot));
 }
 
 void InputManager::unbind_key(const String& key) {
-  if (keybind_map.has(key)) {
-    keybind_map.erase(key);
+  int32_t key_index = bindings.find_ability_key(key);
+  if (bindings.get_ability_slot(key_index) != InputBindingTable::UNBOUND) {
+    bindings.bind_ability_key(key_index, InputBindingTable::UNBOUND);
     DBG_INFO("InputManager", "Unbound " + key);
   }
 }
 
 int InputManager::get_bound_ability(const String& key) const {
-  if (keybind_map.has(key)) {
-    return keybind_map[key];
-  }
-  return -1;  // Not bound
+  // -1 (UNBOUND) if not bound
+  return bindings.get_ability_slot(bindings.find_ability_key(key));
 }
 
 void InputManager::_init_default_keybinds() {
@@ -546,13 +607,12 @@ void InputManager::_init_default_keybinds() {
   }
 
   int ability_count = ability_component->get_ability_count();
-  for (int i = 0; i < ability_count; i++) {
+  int key_count = std::min(ability_count, InputBindingTable::ABILITY_KEY_COUNT);
+  for (int i = 0; i < key_count; i++) {
     if (ability_component->has_ability(i)) {
-      String action_name =
-          String("game_ability_") +
-          String::num(i + 1, 0);  // Force integer format (no decimals)
-      keybind_map[action_name] = i;
-      String key_name = _get_key_name_for_action(action_name);
+      bindings.bind_ability_key(i, i);
+      String key_name = _get_key_name_for_action(
+          bindings.get_action_name(InputBindingTable::ability_action(i)));
       AbilityNode* ability = ability_component->get_ability(i);
       String ability_name =
           ability != nullptr ? ability->get_ability_name() : "Unknown";
@@ -566,7 +626,7 @@ void InputManager::_init_default_keybinds() {
                                String::num(ability_count) + " ability slots");
 }
 
-void InputManager::_handle_ability_input(const String& key) {
+void InputManager::_handle_ability_input(int ability_slot) {
   if (controlled_unit == nullptr) {
     return;
   }
@@ -578,8 +638,7 @@ void InputManager::_handle_ability_input(const String& key) {
     return;
   }
 
-  // Look up which ability slot this key is bound to
-  int ability_slot = get_bound_ability(key);
+  // Slot the pressed key is bound to (-1 if unbound)
   if (ability_slot < 0 || ability_slot > 3) {
     return;  // Key not bound to an ability
   }
@@ -617,19 +676,24 @@ void InputManager::_handle_ability_input(const String& key) {
   switch (casting_mode) {
     case CastingMode::INSTANT: {
       // Instant cast mode - cast all abilities at current cursor position
+      // UNIT_TARGET - use the enemy under the cursor if there is one
+      Unit* cursor_unit =
+          targeting_type == 0
+              ? _pick_unit(FactionTable::get_faction_mask(
+                    controlled_unit->get_faction_id(), Allegiance::ENEMY))
+              : nullptr;
+      if (cursor_unit != nullptr) {
+        ability_component->try_cast(ability_slot, cursor_unit);
+        DBG_INFO("InputManager", "Instant cast on unit target");
+        break;
+      }
+
       Vector3 cursor_position;
       godot::Object* cursor_target = nullptr;
       if (_try_raycast(cursor_position, cursor_target)) {
-        // Cast immediately using cursor position/target
-        if (targeting_type == 0 && cursor_target != nullptr) {
-          // UNIT_TARGET - use target if available
-          ability_component->try_cast(ability_slot, cursor_target);
-          DBG_INFO("InputManager", "Instant cast on unit target");
-        } else {
-          // SKILLSHOT, POINT_TARGET, AREA - use position
-          ability_component->try_cast_point(ability_slot, cursor_position);
-          DBG_INFO("InputManager", "Instant cast at cursor position");
-        }
+        // SKILLSHOT, POINT_TARGET, AREA - use position
+        ability_component->try_cast_point(ability_slot, cursor_position);
+        DBG_INFO("InputManager", "Instant cast at cursor position");
       } else {
         // No valid cursor position
         DBG_INFO("InputManager", "Cannot cast - no valid target position");
@@ -721,7 +785,7 @@ void InputManager::_cancel_targeting() {
   }
 }
 
-String InputManager::_get_key_name_for_action(const String& action) {
+String InputManager::_get_key_name_for_action(const StringName& action) {
   // Get the actual key bound to this action from Godot's InputMap
   godot::InputMap* input_map = godot::InputMap::get_singleton();
   if (input_map == nullptr) {
@@ -765,34 +829,23 @@ String InputManager::_get_key_name_for_action(const String& action) {
 }
 
 void InputManager::_update_hover_glow() {
-  if (controlled_unit == nullptr || camera == nullptr) {
-    return;
+  if (hovered_unit != nullptr &&
+      ObjectDB::get_instance(hovered_unit_id) == nullptr) {
+    hovered_unit = nullptr;  // Freed while hovered, nothing left to clear
   }
 
-  // Raycast to see what's under the cursor
-  Vector3 mouse_pos;
-  godot::Object* hovered_object = nullptr;
-  if (!_try_raycast(mouse_pos, hovered_object)) {
-    // Nothing hovered - remove glow if a unit was previously hovered
-    if (hovered_unit != nullptr) {
-      _remove_outline_glow(hovered_unit);
-      hovered_unit = nullptr;
-    }
+  if (controlled_unit == nullptr || camera == nullptr) {
     return;
   }
 
-  // Try to cast the hovered object to a Unit
-  auto hovered_candidate = Object::cast_to<Unit>(hovered_object);
-
-  // Check if this is a valid targetable unit
-  bool is_valid_target = false;
-  if (hovered_candidate != nullptr && hovered_candidate != controlled_unit) {
-    // Don't glow if it's the controlled unit or the same faction
-    if (hovered_candidate->get_faction_id() !=
-        controlled_unit->get_faction_id()) {
-      is_valid_target = true;
-    }
-  }
+  // Only enemies of the controlled unit glow; the picker skips everything
+  // else, so an ally in front doesn't hide the enemy behind it
+  uint32_t enemy_mask = FactionTable::get_faction_mask(
+      controlled_unit->get_faction_id(), Allegiance::ENEMY);
+  Unit* hovered_candidate = ScreenPicker::pick(
+      camera, get_viewport()->get_mouse_position(), enemy_mask,
+      controlled_unit);
+  bool is_valid_target = hovered_candidate != nullptr;
 
   // Update glow based on whether we're hovering a valid target
   if (is_valid_target && hovered_candidate != hovered_unit) {
@@ -801,6 +854,7 @@ void InputManager::_update_hover_glow() {
       _remove_outline_glow(hovered_unit);
     }
     hovered_unit = hovered_candidate;
+    hovered_unit_id = hovered_unit->get_instance_id();
     _apply_outline_glow(hovered_unit);
   } else if (!is_valid_target && hovered_unit != nullptr) {
     // Was hovering a valid target, but now hovering something else
@@ -810,65 +864,18 @@ void InputManager::_update_hover_glow() {
 }
 
 void InputManager::_apply_outline_glow(Unit* unit) {
-  if (unit == nullptr) {
-    return;
-  }
-
-  // Remove any existing glow overlay
-  if (glow_overlay != nullptr) {
-    glow_overlay->queue_free();
-    glow_overlay = nullptr;
+  // Flips the unit's highlight flag on the shared outline material; the
+  // first highlight of a unit attaches the material, later ones allocate
+  // nothing
+  HighlightSystem* highlights = HighlightSystem::ensure_singleton(this);
+  if (highlights != nullptr) {
+    highlights->set_highlighted(unit, true, glow_color);
   }
-
-  // Create a glow overlay by using the unit's mesh with a glowing material
-  // Find the main mesh instance of the unit
-  MeshInstance3D* main_mesh = nullptr;
-  for (int i = 0; i < unit->get_child_count(); ++i) {
-    godot::Node* child = unit->get_child(i);
-    auto mesh_instance = Object::cast_to<MeshInstance3D>(child);
-    if (mesh_instance != nullptr) {
-      main_mesh = mesh_instance;
-      break;  // Use the first mesh instance found
-    }
-  }
-
-  if (main_mesh == nullptr) {
-    return;  // No mesh to glow
-  }
-
-  // Create a new MeshInstance3D as the glow overlay
-  glow_overlay = memnew(MeshInstance3D);
-  unit->add_child(glow_overlay);
-
-  // Copy the mesh from the main mesh instance
-  Ref<godot::Mesh> mesh = main_mesh->get_mesh();
-  if (mesh.is_valid()) {
-    glow_overlay->set_mesh(mesh);
-  }
-
-  // Create a glowing material
-  Ref<StandardMaterial3D> glow_material = memnew(StandardMaterial3D);
-  glow_material->set_shading_mode(godot::BaseMaterial3D::SHADING_MODE_UNSHADED);
-  glow_material->set_albedo(glow_color);
-  glow_material->set_emission(glow_color);
-  glow_material->set_emission_energy_multiplier(0.5f);
-  glow_material->set_transparency(godot::BaseMaterial3D::TRANSPARENCY_ALPHA);
-
-  // Apply the glow material to all surfaces
-  glow_overlay->set_surface_override_material(0, glow_material);
-
-  // Copy the transform of the main mesh
-  glow_overlay->set_transform(main_mesh->get_transform());
 }
 
 void InputManager::_remove_outline_glow(Unit* unit) {
-  if (unit == nullptr) {
-    return;
-  }
-
-  // Remove the glow overlay
-  if (glow_overlay != nullptr) {
-    glow_overlay->queue_free();
-    glow_overlay = nullptr;
+  HighlightSystem* highlights = HighlightSystem::get_singleton();
+  if (highlights != nullptr) {
+    highlights->set_highlighted(unit, false, glow_color);
   }
 }
@@ -16,6 +16,7 @@
 
 #include "../common/casting_mode.hpp"
 #include "../common/unit_signals.hpp"
+#include "input_binding_table.hpp"
 
 namespace godot {
 class Object;
@@ -81,17 +82,23 @@ class InputManager : public Node {
 
  private:
   // Helper methods
+  // Physics ray under the cursor, for terrain points and interactables
   bool _try_raycast(Vector3& out_position, godot::Object*& out_collider);
+  // Unit of faction_mask under the cursor (ScreenPicker), never the
+  // controlled unit
+  Unit* _pick_unit(uint32_t faction_mask) const;
+  // Enemy proxy minion under the cursor, nearer than max_distance
+  int64_t _pick_enemy_proxy(float max_distance) const;
   void _show_click_marker(const Vector3& position);
   void _update_click_marker(double delta);
-  void _handle_ability_input(const String& key);
+  void _handle_ability_input(int ability_slot);
   void _enter_ability_targeting_mode(int ability_slot, int targeting_type);
   void _handle_stop_command();
   void _cancel_targeting();
   void _init_default_keybinds();
 
   // Get key name from input action (e.g., "game_ability_1" -> "Q")
-  String _get_key_name_for_action(const String& action);
+  String _get_key_name_for_action(const StringName& action);
 
   // Hover glow effect methods
   void _update_hover_glow();
@@ -117,8 +124,9 @@ class InputManager : public Node {
   bool marker_active = false;
   Ref<PackedScene> click_indicator_scene = nullptr;
 
-  // Keybinds: Maps key name to ability slot (e.g., "KEY_Q" -> 0)
-  Dictionary keybind_map;
+  // Action StringNames and ability keybinds (e.g., "game_ability_1" -> 0),
+  // resolved once so _input does no string work
+  InputBindingTable bindings;
 
   // Ability targeting state
   int awaiting_target_slot =
@@ -133,8 +141,10 @@ class InputManager : public Node {
   double indicator_charge_time = 0.0;
 
   // Hover glow effect state
+  // The id is checked before touching hovered_unit, which may have been
+  // freed since it was hovered
   Unit* hovered_unit = nullptr;
-  godot::MeshInstance3D* glow_overlay = nullptr;
+  uint64_t hovered_unit_id = 0;
   Color glow_color =
       Color(0.3f, 0.8f, 1.0f, 0.3f);  // Light blue glow with alpha
 };
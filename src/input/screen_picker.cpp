@@ -0,0 +1,190 @@
+#include "screen_picker.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <godot_cpp/classes/camera3d.hpp>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/viewport.hpp>
+#include <godot_cpp/variant/projection.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+#include <limits>
+
+#include "../core/unit.hpp"
+#include "../systems/unit_index.hpp"
+
+using godot::Camera3D;
+using godot::Engine;
+using godot::Projection;
+using godot::Transform3D;
+
+std::vector<ScreenPicker::Entry> ScreenPicker::entries;
+std::vector<int32_t> ScreenPicker::cell_start;
+std::vector<int32_t> ScreenPicker::cell_entries;
+std::vector<int32_t> ScreenPicker::scratch_cursor;
+int32_t ScreenPicker::columns = 0;
+int32_t ScreenPicker::rows = 0;
+uint64_t ScreenPicker::built_frame = 0;
+uint64_t ScreenPicker::built_camera = 0;
+bool ScreenPicker::built = false;
+
+Unit* ScreenPicker::pick(Camera3D* camera,
+                         const Vector2& screen_pos,
+                         uint32_t faction_mask,
+                         const Unit* exclude) {
+  if (camera == nullptr || !camera->is_inside_tree()) {
+    return nullptr;
+  }
+
+  _refresh(camera);
+  if (entries.empty() || screen_pos.x < 0.0f || screen_pos.y < 0.0f) {
+    return nullptr;
+  }
+
+  int32_t cx = static_cast<int32_t>(screen_pos.x) / CELL_PIXELS;
+  int32_t cy = static_cast<int32_t>(screen_pos.y) / CELL_PIXELS;
+  if (cx >= columns || cy >= rows) {
+    return nullptr;
+  }
+
+  // Nearest to the camera wins where rectangles overlap
+  int32_t cell = cy * columns + cx;
+  Unit* best = nullptr;
+  float best_depth = std::numeric_limits<float>::max();
+  for (int32_t i = cell_start[cell]; i < cell_start[cell + 1]; i++) {
+    const Entry& entry = entries[cell_entries[i]];
+    if (entry.unit == exclude || (entry.faction_bit & faction_mask) == 0 ||
+        entry.depth >= best_depth) {
+      continue;
+    }
+    if (screen_pos.x < entry.min.x || screen_pos.x > entry.max.x ||
+        screen_pos.y < entry.min.y || screen_pos.y > entry.max.y) {
+      continue;
+    }
+    // Removed or killed since the rebuild
+    if (UnitIndex::get_live_unit(entry.index_slot) != entry.unit) {
+      continue;
+    }
+
+    best = entry.unit;
+    best_depth = entry.depth;
+  }
+  return best;
+}
+
+int32_t ScreenPicker::get_entry_count() {
+  return static_cast<int32_t>(entries.size());
+}
+
+void ScreenPicker::_refresh(Camera3D* camera) {
+  uint64_t frame = Engine::get_singleton()->get_process_frames();
+  uint64_t camera_id = camera->get_instance_id();
+  if (built && frame == built_frame && camera_id == built_camera) {
+    return;
+  }
+  built_frame = frame;
+  built_camera = camera_id;
+  built = true;
+
+  entries.clear();
+  godot::Viewport* viewport = camera->get_viewport();
+  Vector2 size =
+      viewport != nullptr ? viewport->get_visible_rect().size : Vector2();
+  columns = std::max(1, static_cast<int32_t>(std::ceil(size.x / CELL_PIXELS)));
+  rows = std::max(1, static_cast<int32_t>(std::ceil(size.y / CELL_PIXELS)));
+
+  // Camera matrices fetched once; every unit is projected with plain math
+  Transform3D camera_transform = camera->get_camera_transform();
+  Transform3D view = camera_transform.affine_inverse();
+  Projection projection = camera->get_camera_projection();
+  Vector3 right = camera_transform.basis.get_column(0).normalized();
+
+  auto project = [&](const Vector3& world, Vector2& out, float& depth) {
+    Vector3 local = view.xform(world);
+    if (local.z > -0.001f) {
+      return false;  // Behind the camera
+    }
+    Vector3 ndc = projection.xform(local);
+    out = Vector2((ndc.x * 0.5f + 0.5f) * size.x,
+                  (0.5f - ndc.y * 0.5f) * size.y);
+    depth = -local.z;
+    return true;
+  };
+
+  float extent = UnitIndex::HALF_EXTENT;
+  UnitIndex::visit_box_ranges(
+      -extent, -extent, extent, extent, FactionTable::ALL_FACTIONS,
+      [&](const float*, const float*, const int32_t* slots, int32_t count) {
+        for (int32_t i = 0; i < count; i++) {
+          Unit* unit = UnitIndex::get_live_unit(slots[i]);
+          if (unit == nullptr || !unit->is_visible()) {
+            continue;
+          }
+
+          // Rendered (interpolated) position, matching what's on screen
+          Vector3 base = unit->get_global_transform_interpolated().origin;
+          Entry entry;
+          Vector2 base_px;
+          if (!project(base, base_px, entry.depth)) {
+            continue;
+          }
+
+          float unused_depth = 0.0f;
+          Vector2 top_px = base_px;
+          project(base + Vector3(0, unit->get_pick_height(), 0), top_px,
+                  unused_depth);
+          Vector2 side_px = base_px;
+          project(base + right * unit->get_pick_radius(), side_px,
+                  unused_depth);
+          float radius_px = side_px.distance_to(base_px);
+
+          entry.min = Vector2(std::min(base_px.x, top_px.x) - radius_px,
+                              std::min(base_px.y, top_px.y) - radius_px);
+          entry.max = Vector2(std::max(base_px.x, top_px.x) + radius_px,
+                              std::max(base_px.y, top_px.y) + radius_px);
+          if (entry.max.x < 0.0f || entry.max.y < 0.0f ||
+              entry.min.x > size.x || entry.min.y > size.y) {
+            continue;
+          }
+
+          entry.unit = unit;
+          entry.index_slot = slots[i];
+          entry.faction_bit = 1u << UnitIndex::get_faction(slots[i]);
+          entries.push_back(entry);
+        }
+      });
+
+  // Counting sort of entry indices into the cells their rectangles cover
+  int32_t cell_count = columns * rows;
+  cell_start.assign(cell_count + 1, 0);
+  auto for_each_cell = [&](const Entry& entry, auto&& visit) {
+    int32_t min_cx = std::clamp(
+        static_cast<int32_t>(entry.min.x) / CELL_PIXELS, 0, columns - 1);
+    int32_t max_cx = std::clamp(
+        static_cast<int32_t>(entry.max.x) / CELL_PIXELS, 0, columns - 1);
+    int32_t min_cy = std::clamp(
+        static_cast<int32_t>(entry.min.y) / CELL_PIXELS, 0, rows - 1);
+    int32_t max_cy = std::clamp(
+        static_cast<int32_t>(entry.max.y) / CELL_PIXELS, 0, rows - 1);
+    for (int32_t cy = min_cy; cy <= max_cy; cy++) {
+      for (int32_t cx = min_cx; cx <= max_cx; cx++) {
+        visit(cy * columns + cx);
+      }
+    }
+  };
+
+  for (const Entry& entry : entries) {
+    for_each_cell(entry, [&](int32_t cell) { cell_start[cell + 1]++; });
+  }
+  for (int32_t cell = 0; cell < cell_count; cell++) {
+    cell_start[cell + 1] += cell_start[cell];
+  }
+
+  cell_entries.resize(cell_start[cell_count]);
+  scratch_cursor.assign(cell_start.begin(), cell_start.end() - 1);
+  for (int32_t index = 0; index < static_cast<int32_t>(entries.size());
+       index++) {
+    for_each_cell(entries[index], [&](int32_t cell) {
+      cell_entries[scratch_cursor[cell]++] = index;
+    });
+  }
+}
@@ -0,0 +1,66 @@
+#ifndef GDEXTENSION_SCREEN_PICKER_H
+#define GDEXTENSION_SCREEN_PICKER_H
+
+#include <cstdint>
+#include <godot_cpp/variant/vector2.hpp>
+#include <vector>
+
+#include "../core/faction_table.hpp"
+
+namespace godot {
+class Camera3D;
+}  // namespace godot
+
+using godot::Vector2;
+
+class Unit;
+
+/// Screen-space unit picking without physics queries
+/// Once per frame (lazily, on the first query) every living, visible unit
+/// in the UnitIndex is projected through the camera with plain matrix math:
+/// its pick bounds (see Unit::get_pick_radius/get_pick_height) become a
+/// screen rectangle, which is binned into a grid of CELL_PIXELS cells.
+/// A query reads the one cell under the cursor and returns the nearest unit
+/// whose rectangle contains it, so hovering a packed fight costs a handful
+/// of rectangle tests instead of a physics ray.
+///
+/// Terrain points (move clicks, point casts) still need a raycast; units
+/// are never looked up through physics.
+class ScreenPicker {
+ public:
+  static constexpr int32_t CELL_PIXELS = 32;
+
+  /// Nearest unit of the factions in faction_mask under screen_pos, or
+  /// nullptr. exclude (e.g. the player's own unit) is never returned.
+  static Unit* pick(godot::Camera3D* camera,
+                    const Vector2& screen_pos,
+                    uint32_t faction_mask = FactionTable::ALL_FACTIONS,
+                    const Unit* exclude = nullptr);
+
+  /// Units on screen at the last rebuild
+  static int32_t get_entry_count();
+
+ private:
+  struct Entry {
+    Unit* unit = nullptr;
+    int32_t index_slot = -1;  // UnitIndex slot, to catch removed units
+    uint32_t faction_bit = 0;
+    float depth = 0.0f;  // Distance in front of the camera
+    Vector2 min;
+    Vector2 max;
+  };
+
+  static void _refresh(godot::Camera3D* camera);
+
+  static std::vector<Entry> entries;
+  static std::vector<int32_t> cell_start;    // Cell count + 1 offsets
+  static std::vector<int32_t> cell_entries;  // Entry indices per cell
+  static std::vector<int32_t> scratch_cursor;
+  static int32_t columns;
+  static int32_t rows;
+  static uint64_t built_frame;
+  static uint64_t built_camera;
+  static bool built;
+};
+
+#endif  // GDEXTENSION_SCREEN_PICKER_H
@@ -11,6 +11,7 @@
 #include "components/abilities/ability_component.hpp"
 #include "components/abilities/ability_node.hpp"
 #include "components/abilities/implementations/beam_node.hpp"
+#include "components/abilities/implementations/chain_lightning_node.hpp"
 #include "components/abilities/implementations/explosion_node.hpp"
 #include "components/abilities/implementations/fireball_node.hpp"
 #include "components/abilities/implementations/frost_bolt_node.hpp"
@@ -25,7 +26,9 @@
 #include "components/revive/revive_component.hpp"
 #include "components/ui/cooldown_display_component.hpp"
 #include "components/ui/cooldown_icon.hpp"
+#include "components/ui/debug_label_overlay.hpp"
 #include "components/ui/head_bar.hpp"
+#include "components/ui/head_bar_renderer.hpp"
 #include "components/ui/label_component.hpp"
 #include "components/ui/main_health_display.hpp"
 #include "components/ui/main_resource_display.hpp"
@@ -33,11 +36,25 @@
 #include "components/unit_component.hpp"
 #include "core/match_manager.hpp"
 #include "core/unit.hpp"
+#include "core/wave_spawner.hpp"
 #include "debug/debug_logger.hpp"
+#include "debug/highlight_benchmark.hpp"
+#include "debug/unit_query_check.hpp"
 #include "debug/visual_debugger.hpp"
 #include "input/input_manager.hpp"
+#include "systems/activity_system.hpp"
+#include "systems/channel_system.hpp"
+#include "systems/damage_queue.hpp"
+#include "systems/projectile_scheduler.hpp"
+#include "systems/proxy_minion_system.hpp"
+#include "systems/status_effect_system.hpp"
+#include "systems/target_acquisition.hpp"
+#include "systems/transform_writeback.hpp"
+#include "systems/zone_system.hpp"
 #include "visual/area_effects/area_effect_vfx.hpp"
 #include "visual/explosions/explosion_vfx.hpp"
+#include "visual/highlight/highlight_system.hpp"
+#include "visual/projectiles/projectile_renderer.hpp"
 #include "visual/projectiles/projectile_vfx.hpp"
 #include "visual/vfx_node.hpp"
 
@@ -53,6 +70,7 @@ void initialize_example_module(ModuleInitializationLevel p_level) {
   GDREGISTER_CLASS(InputManager)
   GDREGISTER_CLASS(MOBACamera)
   GDREGISTER_CLASS(MatchManager)
+  GDREGISTER_CLASS(WaveSpawner)
   GDREGISTER_CLASS(TestMovement)
   GDREGISTER_CLASS(UnitComponent)
   GDREGISTER_CLASS(MovementComponent)
@@ -60,7 +78,9 @@ void initialize_example_module(ModuleInitializationLevel p_level) {
   GDREGISTER_CLASS(ReviveComponent)
   GDREGISTER_CLASS(ResourcePoolComponent)
   GDREGISTER_CLASS(LabelComponent)
+  GDREGISTER_CLASS(DebugLabelOverlay)
   GDREGISTER_CLASS(HeadBar)
+  GDREGISTER_CLASS(HeadBarRenderer)
   GDREGISTER_CLASS(ResourceBar)
   GDREGISTER_CLASS(CooldownIcon)
   GDREGISTER_CLASS(CooldownDisplayComponent)
@@ -71,6 +91,7 @@ void initialize_example_module(ModuleInitializationLevel p_level) {
   GDREGISTER_CLASS(SkillshotProjectile)
   GDREGISTER_CLASS(AbilityNode)
   GDREGISTER_CLASS(BeamNode)
+  GDREGISTER_CLASS(ChainLightningNode)
   GDREGISTER_CLASS(ExplosionNode)
   GDREGISTER_CLASS(InstantStrikeNode)
   GDREGISTER_CLASS(FrostBoltNode)
@@ -78,12 +99,25 @@ void initialize_example_module(ModuleInitializationLevel p_level) {
   GDREGISTER_CLASS(AbilityComponent)
   GDREGISTER_CLASS(VisualDebugger)
   GDREGISTER_CLASS(DebugLogger)
+  GDREGISTER_CLASS(HighlightBenchmark)
+  GDREGISTER_CLASS(UnitQueryCheck)
+  GDREGISTER_CLASS(TransformWriteback)
+  GDREGISTER_CLASS(ProjectileScheduler)
+  GDREGISTER_CLASS(TargetAcquisition)
+  GDREGISTER_CLASS(StatusEffectSystem)
+  GDREGISTER_CLASS(DamageQueue)
+  GDREGISTER_CLASS(ZoneSystem)
+  GDREGISTER_CLASS(ChannelSystem)
+  GDREGISTER_CLASS(ActivitySystem)
+  GDREGISTER_CLASS(ProxyMinionSystem)
 
   // VFX System
   GDREGISTER_CLASS(VFXNode)
   GDREGISTER_CLASS(ProjectileVFX)
+  GDREGISTER_CLASS(ProjectileRenderer)
   GDREGISTER_CLASS(ExplosionVFX)
   GDREGISTER_CLASS(AreaEffectVFX)
+  GDREGISTER_CLASS(HighlightSystem)
 }
 
 void uninitialize_example_module(ModuleInitializationLevel p_level) {
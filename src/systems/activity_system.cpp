@@ -0,0 +1,307 @@
+#include "activity_system.hpp"
+
+#include <algorithm>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/object.hpp>
+#include <godot_cpp/core/property_info.hpp>
+
+#include "../common/allegiance.hpp"
+#include "../components/movement/movement_component.hpp"
+#include "../components/unit_component.hpp"
+#include "../core/faction_table.hpp"
+#include "../core/unit.hpp"
+#include "../debug/debug_macros.hpp"
+#include "simulation_clock.hpp"
+#include "tick_stages.hpp"
+#include "unit_index.hpp"
+
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::Engine;
+using godot::Object;
+using godot::ObjectDB;
+using godot::PropertyInfo;
+using godot::Variant;
+
+ActivitySystem* ActivitySystem::singleton_instance = nullptr;
+
+ActivitySystem::ActivitySystem() {
+  singleton_instance = this;
+}
+
+ActivitySystem::~ActivitySystem() {
+  if (singleton_instance == this) {
+    singleton_instance = nullptr;
+  }
+}
+
+void ActivitySystem::_bind_methods() {
+  ClassDB::bind_method(D_METHOD("set_wake_radius", "radius"),
+                       &ActivitySystem::set_wake_radius);
+  ClassDB::bind_method(D_METHOD("get_wake_radius"),
+                       &ActivitySystem::get_wake_radius);
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "wake_radius"), "set_wake_radius",
+               "get_wake_radius");
+
+  ClassDB::bind_method(D_METHOD("set_sleep_delay", "seconds"),
+                       &ActivitySystem::set_sleep_delay);
+  ClassDB::bind_method(D_METHOD("get_sleep_delay"),
+                       &ActivitySystem::get_sleep_delay);
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "sleep_delay"), "set_sleep_delay",
+               "get_sleep_delay");
+
+  ClassDB::bind_method(D_METHOD("set_checks_per_tick", "count"),
+                       &ActivitySystem::set_checks_per_tick);
+  ClassDB::bind_method(D_METHOD("get_checks_per_tick"),
+                       &ActivitySystem::get_checks_per_tick);
+  ADD_PROPERTY(PropertyInfo(Variant::INT, "checks_per_tick"),
+               "set_checks_per_tick", "get_checks_per_tick");
+
+  ClassDB::bind_method(D_METHOD("get_unit_count"),
+                       &ActivitySystem::get_unit_count);
+  ClassDB::bind_method(D_METHOD("get_sleeping_count"),
+                       &ActivitySystem::get_sleeping_count);
+  ClassDB::bind_method(D_METHOD("get_last_tick_wakes"),
+                       &ActivitySystem::get_last_tick_wakes);
+}
+
+void ActivitySystem::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  singleton_instance = this;
+  set_physics_process_priority(TickStage::ACTIVITY);
+  set_physics_process(true);
+}
+
+void ActivitySystem::_physics_process(double delta) {
+  last_tick_wakes = 0;
+  int32_t count = static_cast<int32_t>(sleepers.size());
+  if (count == 0) {
+    return;
+  }
+
+  // Sleepers: coarse proximity test every tick so an approaching enemy wakes
+  // them before their components would have reacted anyway
+  if (sleeping_count > 0) {
+    for (Sleeper& sleeper : sleepers) {
+      if (sleeper.asleep &&
+          _has_enemy_nearby(sleeper.unit, sleeper.wake_radius)) {
+        _wake(sleeper);
+        last_tick_wakes++;
+      }
+    }
+  }
+
+  // Awake units: bounded round-robin idleness checks
+  uint64_t tick = SimulationClock::get_tick();
+  uint64_t delay_ticks =
+      static_cast<uint64_t>(SimulationClock::seconds_to_ticks(sleep_delay));
+  int32_t budget = std::min(checks_per_tick, count);
+  for (int32_t visited = 0; visited < budget; visited++) {
+    if (cursor >= count) {
+      cursor = 0;
+    }
+    Sleeper& sleeper = sleepers[cursor++];
+    if (sleeper.asleep) {
+      continue;
+    }
+
+    if (!_is_idle(sleeper) ||
+        _has_enemy_nearby(sleeper.unit,
+                          _compute_wake_radius(sleeper.unit))) {
+      sleeper.idle_since = 0;
+      continue;
+    }
+
+    // Tick 0 is reserved for "busy"
+    if (sleeper.idle_since == 0) {
+      sleeper.idle_since = tick + 1;
+      continue;
+    }
+
+    if (tick + 1 - sleeper.idle_since >= delay_ticks) {
+      _sleep(sleeper);
+    }
+  }
+}
+
+void ActivitySystem::add_unit(Unit* unit) {
+  if (unit == nullptr || sleeper_of.count(unit) != 0) {
+    return;
+  }
+
+  sleeper_of[unit] = static_cast<int32_t>(sleepers.size());
+  Sleeper sleeper;
+  sleeper.unit = unit;
+  sleepers.push_back(sleeper);
+}
+
+void ActivitySystem::remove_unit(Unit* unit) {
+  auto found = sleeper_of.find(unit);
+  if (found == sleeper_of.end()) {
+    return;
+  }
+
+  // Leave the unit processing, in case it re-enters the tree
+  int32_t index = found->second;
+  if (sleepers[index].asleep) {
+    _wake(sleepers[index]);
+  }
+
+  sleeper_of.erase(found);
+  int32_t last = static_cast<int32_t>(sleepers.size()) - 1;
+  if (index != last) {
+    sleepers[index] = std::move(sleepers[last]);
+    sleeper_of[sleepers[index].unit] = index;
+  }
+  sleepers.pop_back();
+}
+
+void ActivitySystem::wake_unit(Unit* unit) {
+  auto found = sleeper_of.find(unit);
+  if (found == sleeper_of.end()) {
+    return;
+  }
+
+  Sleeper& sleeper = sleepers[found->second];
+  if (sleeper.asleep) {
+    _wake(sleeper);
+    last_tick_wakes++;
+  }
+}
+
+bool ActivitySystem::_is_idle(const Sleeper& sleeper) const {
+  Unit* unit = sleeper.unit;
+  for (int32_t i = 0; i < unit->get_child_count(); i++) {
+    Node* child = unit->get_child(i);
+    UnitComponent* component = Object::cast_to<UnitComponent>(child);
+    if (component != nullptr && !component->is_idle()) {
+      return false;
+    }
+    MovementComponent* movement = Object::cast_to<MovementComponent>(child);
+    if (movement != nullptr && !movement->is_idle()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+float ActivitySystem::_compute_wake_radius(const Unit* unit) const {
+  float radius = wake_radius;
+  for (int32_t i = 0; i < unit->get_child_count(); i++) {
+    UnitComponent* component =
+        Object::cast_to<UnitComponent>(unit->get_child(i));
+    if (component != nullptr) {
+      radius = std::max(radius, component->get_wake_radius());
+    }
+  }
+  return radius;
+}
+
+bool ActivitySystem::_has_enemy_nearby(const Unit* unit, float radius) const {
+  Vector3 position = unit->get_global_position();
+  uint32_t enemy_factions =
+      FactionTable::get_faction_mask(unit->get_faction_id(), Allegiance::ENEMY);
+  return UnitIndex::has_units_in_box(position.x - radius, position.z - radius,
+                                     position.x + radius, position.z + radius,
+                                     enemy_factions);
+}
+
+void ActivitySystem::_sleep(Sleeper& sleeper) {
+  // Components are suspended, so their wake radius can't change meanwhile
+  Unit* unit = sleeper.unit;
+  sleeper.wake_radius = _compute_wake_radius(unit);
+  sleeper.suspended.clear();
+  for (int32_t i = 0; i < unit->get_child_count(); i++) {
+    // Only what _is_idle inspects; other nodes (e.g. TestMovement) keep
+    // ticking, and their orders wake the unit through relay
+    Node* child = unit->get_child(i);
+    bool inspected = Object::cast_to<UnitComponent>(child) != nullptr ||
+                     Object::cast_to<MovementComponent>(child) != nullptr;
+    if (inspected && child->is_physics_processing()) {
+      child->set_physics_process(false);
+      sleeper.suspended.push_back(child->get_instance_id());
+    }
+  }
+
+  sleeper.asleep = true;
+  unit->set_asleep(true);
+  sleeping_count++;
+}
+
+void ActivitySystem::_wake(Sleeper& sleeper) {
+  // Children freed while asleep are simply gone from ObjectDB
+  for (uint64_t child_id : sleeper.suspended) {
+    Node* child = Object::cast_to<Node>(ObjectDB::get_instance(child_id));
+    if (child != nullptr) {
+      child->set_physics_process(true);
+    }
+  }
+  sleeper.suspended.clear();
+
+  sleeper.asleep = false;
+  sleeper.idle_since = 0;
+  sleeper.unit->set_asleep(false);
+  sleeping_count--;
+}
+
+void ActivitySystem::set_wake_radius(float radius) {
+  wake_radius = std::max(0.0f, radius);
+}
+
+float ActivitySystem::get_wake_radius() const {
+  return wake_radius;
+}
+
+void ActivitySystem::set_sleep_delay(double seconds) {
+  sleep_delay = std::max(0.0, seconds);
+}
+
+double ActivitySystem::get_sleep_delay() const {
+  return sleep_delay;
+}
+
+void ActivitySystem::set_checks_per_tick(int32_t count) {
+  checks_per_tick = std::max(1, count);
+}
+
+int32_t ActivitySystem::get_checks_per_tick() const {
+  return checks_per_tick;
+}
+
+int32_t ActivitySystem::get_unit_count() const {
+  return static_cast<int32_t>(sleepers.size());
+}
+
+int32_t ActivitySystem::get_sleeping_count() const {
+  return sleeping_count;
+}
+
+int32_t ActivitySystem::get_last_tick_wakes() const {
+  return last_tick_wakes;
+}
+
+ActivitySystem* ActivitySystem::get_singleton() {
+  return singleton_instance;
+}
+
+ActivitySystem* ActivitySystem::ensure_singleton(Node* context) {
+  if (singleton_instance != nullptr) {
+    return singleton_instance;
+  }
+
+  if (context == nullptr || !context->is_inside_tree()) {
+    return nullptr;
+  }
+
+  ActivitySystem* system = memnew(ActivitySystem);
+  system->set_name("ActivitySystem");
+  context->get_tree()->get_root()->call_deferred("add_child", system);
+  DBG_INFO("ActivitySystem", "Created activity system");
+  return singleton_instance;
+}
@@ -0,0 +1,96 @@
+#ifndef GDEXTENSION_ACTIVITY_SYSTEM_H
+#define GDEXTENSION_ACTIVITY_SYSTEM_H
+
+#include <cstdint>
+#include <godot_cpp/classes/node.hpp>
+#include <unordered_map>
+#include <vector>
+
+using godot::Node;
+
+class Unit;
+
+/// Sleep/wake for idle units (jungle camps, minions waiting for a wave)
+/// A unit falls asleep once it has been idle for sleep_delay seconds:
+/// - Every component reports idle (no order, windup, cast, cooldown or
+///   revive pending; see UnitComponent::is_idle and MovementComponent)
+/// - No enemy occupies a UnitIndex cell within its wake radius
+///
+/// Sleeping suspends physics processing on the unit's components
+/// (UnitComponents and MovementComponent, labels included), so a sleeping
+/// unit costs nothing per tick beyond its UnitIndex record. Other child
+/// nodes keep processing. It
+/// wakes on any relay (orders, damage, see Unit::relay) or when an enemy
+/// enters a cell within its wake radius. The proximity check is a coarse
+/// per-cell occupancy test (UnitIndex::has_units_in_box): a few offset
+/// comparisons per sleeper and tick, never a per-unit scan.
+///
+/// Awake units are checked for idleness round-robin, at most
+/// checks_per_tick per tick.
+class ActivitySystem : public Node {
+  GDCLASS(ActivitySystem, Node)
+
+ protected:
+  static void _bind_methods();
+
+  struct Sleeper {
+    Unit* unit = nullptr;
+    bool asleep = false;
+    uint64_t idle_since = 0;          // Tick idle was first seen + 1, 0 = busy
+    float wake_radius = 0.0f;         // Fixed while asleep
+    std::vector<uint64_t> suspended;  // Children whose processing we stopped
+  };
+
+  std::vector<Sleeper> sleepers;
+  std::unordered_map<const Unit*, int32_t> sleeper_of;
+  int32_t cursor = 0;
+  int32_t sleeping_count = 0;
+
+  float wake_radius = 12.0f;
+  double sleep_delay = 1.0;
+  int32_t checks_per_tick = 32;
+
+  int32_t last_tick_wakes = 0;
+
+  bool _is_idle(const Sleeper& sleeper) const;
+  float _compute_wake_radius(const Unit* unit) const;
+  bool _has_enemy_nearby(const Unit* unit, float radius) const;
+  void _sleep(Sleeper& sleeper);
+  void _wake(Sleeper& sleeper);
+
+ public:
+  ActivitySystem();
+  ~ActivitySystem();
+
+  void _ready() override;
+  void _physics_process(double delta) override;
+
+  void add_unit(Unit* unit);
+  void remove_unit(Unit* unit);
+
+  /// Resume a sleeping unit right away (no-op if awake)
+  void wake_unit(Unit* unit);
+
+  /// Minimum wake radius; units that auto-acquire use their acquisition
+  /// range when larger
+  void set_wake_radius(float radius);
+  float get_wake_radius() const;
+
+  void set_sleep_delay(double seconds);
+  double get_sleep_delay() const;
+
+  void set_checks_per_tick(int32_t count);
+  int32_t get_checks_per_tick() const;
+
+  int32_t get_unit_count() const;
+  int32_t get_sleeping_count() const;
+  int32_t get_last_tick_wakes() const;
+
+  static ActivitySystem* get_singleton();
+  static ActivitySystem* ensure_singleton(Node* context);
+
+ private:
+  static ActivitySystem* singleton_instance;
+};
+
+#endif  // GDEXTENSION_ACTIVITY_SYSTEM_H
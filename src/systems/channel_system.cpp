@@ -0,0 +1,242 @@
+#include "channel_system.hpp"
+
+#include <algorithm>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/object.hpp>
+
+#include "../components/abilities/ability_component.hpp"
+#include "../core/unit.hpp"
+#include "../debug/debug_macros.hpp"
+#include "../debug/visual_debugger.hpp"
+#include "simulation_clock.hpp"
+#include "tick_stages.hpp"
+
+using godot::ClassDB;
+using godot::Color;
+using godot::D_METHOD;
+using godot::Engine;
+using godot::Object;
+using godot::ObjectDB;
+using godot::Vector3;
+
+ChannelSystem* ChannelSystem::singleton_instance = nullptr;
+
+namespace {
+Unit* resolve_unit(uint64_t unit_id) {
+  Unit* unit = Object::cast_to<Unit>(ObjectDB::get_instance(unit_id));
+  return unit != nullptr && unit->is_inside_tree() ? unit : nullptr;
+}
+
+AbilityComponent* resolve_component(uint64_t component_id) {
+  return Object::cast_to<AbilityComponent>(
+      ObjectDB::get_instance(component_id));
+}
+}  // namespace
+
+ChannelSystem::ChannelSystem() {
+  singleton_instance = this;
+}
+
+ChannelSystem::~ChannelSystem() {
+  if (singleton_instance == this) {
+    singleton_instance = nullptr;
+  }
+}
+
+void ChannelSystem::_bind_methods() {
+  ClassDB::bind_method(D_METHOD("get_channel_count"),
+                       &ChannelSystem::get_channel_count);
+  ClassDB::bind_method(D_METHOD("get_last_tick_fired"),
+                       &ChannelSystem::get_last_tick_fired);
+}
+
+void ChannelSystem::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  singleton_instance = this;
+  set_physics_process_priority(TickStage::CHANNELS);
+  set_physics_process(true);
+}
+
+void ChannelSystem::_physics_process(double delta) {
+  last_tick_fired = 0;
+  if (channels.empty()) {
+    return;
+  }
+
+  // Channel lines last one tick, so they don't flicker between ticks
+  VisualDebugger* debugger = VisualDebugger::get_singleton();
+  bool draw =
+      debugger != nullptr && debugger->should_draw(DebugCategory::CHANNELS);
+  float draw_duration = static_cast<float>(SimulationClock::get_fixed_delta());
+
+  // Sweep: validate, range-check and schedule every channel. Components are
+  // only called back afterwards, so they may begin or end channels freely
+  uint64_t tick = SimulationClock::get_tick();
+  events.clear();
+  int32_t index = 0;
+  while (index < static_cast<int32_t>(channels.size())) {
+    Channel& channel = channels[index];
+    Unit* caster = resolve_unit(channel.caster_id);
+    if (caster == nullptr) {
+      events.push_back({channel.component_id, EventType::END});
+      _remove_at(index);
+      continue;
+    }
+
+    if (channel.target_id != 0) {
+      Unit* target = resolve_unit(channel.target_id);
+      if (target == nullptr) {
+        DBG_INFO("ChannelSystem",
+                 "Channel interrupted: target no longer valid");
+        events.push_back({channel.component_id, EventType::END});
+        _remove_at(index);
+        continue;
+      }
+
+      Vector3 caster_pos = caster->get_global_position();
+      Vector3 target_pos = target->get_global_position();
+      if (draw) {
+        debugger->add_line(caster_pos, target_pos, Color(1, 1, 1, 1), 1.0f,
+                           draw_duration, DebugCategory::CHANNELS);
+      }
+      if (channel.range_sq > 0.0f &&
+          caster_pos.distance_squared_to(target_pos) > channel.range_sq) {
+        DBG_INFO("ChannelSystem", "Channel interrupted: target out of range");
+        events.push_back({channel.component_id, EventType::END});
+        _remove_at(index);
+        continue;
+      }
+    }
+
+    if (channel.interval_ticks > 0 && tick >= channel.next_tick) {
+      events.push_back({channel.component_id, EventType::TICK});
+      channel.next_tick += channel.interval_ticks;
+      last_tick_fired++;
+    }
+
+    if (tick >= channel.end_tick) {
+      events.push_back({channel.component_id, EventType::END});
+      _remove_at(index);
+      continue;
+    }
+    index++;
+  }
+
+  for (const ChannelEvent& event : events) {
+    AbilityComponent* component = resolve_component(event.component_id);
+    if (component == nullptr) {
+      continue;
+    }
+
+    if (event.type == EventType::TICK) {
+      // A tick that fails (e.g. deferred) ends the channel
+      if (!component->channel_tick()) {
+        end_channel(component);
+        component->finish_channel();
+      }
+    } else {
+      component->finish_channel();
+    }
+  }
+}
+
+void ChannelSystem::begin_channel(AbilityComponent* component,
+                                  Unit* caster,
+                                  Unit* target,
+                                  float range,
+                                  double duration,
+                                  double tick_interval) {
+  if (component == nullptr || caster == nullptr) {
+    return;
+  }
+
+  uint64_t component_id = component->get_instance_id();
+  auto found = channel_of.find(component_id);
+  int32_t index = 0;
+  if (found != channel_of.end()) {
+    index = found->second;
+  } else {
+    index = static_cast<int32_t>(channels.size());
+    channels.emplace_back();
+    channel_of[component_id] = index;
+  }
+
+  Channel& channel = channels[index];
+  channel.component_id = component_id;
+  channel.caster_id = caster->get_instance_id();
+  channel.target_id = target != nullptr ? target->get_instance_id() : 0;
+  channel.range_sq = range > 0.0f ? range * range : 0.0f;
+
+  // The cast point already fired the first tick
+  uint64_t tick = SimulationClock::get_tick();
+  channel.interval_ticks =
+      tick_interval > 0.0
+          ? static_cast<uint64_t>(SimulationClock::seconds_to_ticks(
+                tick_interval))
+          : 0;
+  channel.next_tick = tick + channel.interval_ticks;
+  int64_t duration_ticks = SimulationClock::seconds_to_ticks(duration);
+  channel.end_tick = tick + static_cast<uint64_t>(
+                                std::max<int64_t>(0, duration_ticks));
+}
+
+void ChannelSystem::end_channel(AbilityComponent* component) {
+  if (component == nullptr) {
+    return;
+  }
+
+  auto found = channel_of.find(component->get_instance_id());
+  if (found != channel_of.end()) {
+    _remove_at(found->second);
+  }
+}
+
+bool ChannelSystem::is_channeling(AbilityComponent* component) const {
+  return component != nullptr &&
+         channel_of.count(component->get_instance_id()) != 0;
+}
+
+void ChannelSystem::_remove_at(int32_t index) {
+  // Swap-remove keeps the array dense
+  channel_of.erase(channels[index].component_id);
+  int32_t last = static_cast<int32_t>(channels.size()) - 1;
+  if (index != last) {
+    channels[index] = channels[last];
+    channel_of[channels[index].component_id] = index;
+  }
+  channels.pop_back();
+}
+
+int32_t ChannelSystem::get_channel_count() const {
+  return static_cast<int32_t>(channels.size());
+}
+
+int32_t ChannelSystem::get_last_tick_fired() const {
+  return last_tick_fired;
+}
+
+ChannelSystem* ChannelSystem::get_singleton() {
+  return singleton_instance;
+}
+
+ChannelSystem* ChannelSystem::ensure_singleton(Node* context) {
+  if (singleton_instance != nullptr) {
+    return singleton_instance;
+  }
+
+  if (context == nullptr || !context->is_inside_tree()) {
+    return nullptr;
+  }
+
+  ChannelSystem* system = memnew(ChannelSystem);
+  system->set_name("ChannelSystem");
+  context->get_tree()->get_root()->call_deferred("add_child", system);
+  DBG_INFO("ChannelSystem", "Created channel system");
+  return singleton_instance;
+}
@@ -0,0 +1,93 @@
+#ifndef GDEXTENSION_CHANNEL_SYSTEM_H
+#define GDEXTENSION_CHANNEL_SYSTEM_H
+
+#include <cstdint>
+#include <godot_cpp/classes/node.hpp>
+#include <unordered_map>
+#include <vector>
+
+using godot::Node;
+
+class AbilityComponent;
+class Unit;
+
+/// Batched channel ticking (beams, drains, channeled chains)
+/// AbilityComponent hands a channel over once its cast point has fired; from
+/// then on a single pass per tick covers every active channel:
+/// - Channels live in one dense array, so the pass is a linear sweep no matter
+///   how many channelers a team fight has
+/// - Range checks compare squared distances against a cached range²
+/// - Tick times are whole simulation ticks, not accumulated float time
+///
+/// A channel ends when its duration elapses, its unit target is gone or out
+/// of range, or its component ends it (interrupt, new cast). Ticks and ends
+/// are dispatched back to the components after the sweep; target selection
+/// for multi-target and chain effects happens in the ability's execute().
+class ChannelSystem : public Node {
+  GDCLASS(ChannelSystem, Node)
+
+ protected:
+  static void _bind_methods();
+
+  struct Channel {
+    uint64_t component_id = 0;
+    uint64_t caster_id = 0;
+    uint64_t target_id = 0;  // 0 = no unit target, no range check
+    float range_sq = 0.0f;   // 0 = unlimited
+
+    // Timing, in simulation ticks
+    uint64_t next_tick = 0;
+    uint64_t interval_ticks = 0;  // 0 = no periodic ticks
+    uint64_t end_tick = 0;
+  };
+
+  enum class EventType : uint8_t { TICK, END };
+
+  struct ChannelEvent {
+    uint64_t component_id = 0;
+    EventType type = EventType::TICK;
+  };
+
+  std::vector<Channel> channels;
+  std::unordered_map<uint64_t, int32_t> channel_of;  // By component id
+
+  // Reused every tick
+  std::vector<ChannelEvent> events;
+
+  int32_t last_tick_fired = 0;
+
+  void _remove_at(int32_t index);
+
+ public:
+  ChannelSystem();
+  ~ChannelSystem();
+
+  void _ready() override;
+  void _physics_process(double delta) override;
+
+  /// Start ticking a channel for component (replaces its previous one)
+  /// duration and tick_interval are in seconds; range <= 0 or a null target
+  /// disables the range check
+  void begin_channel(AbilityComponent* component,
+                     Unit* caster,
+                     Unit* target,
+                     float range,
+                     double duration,
+                     double tick_interval);
+
+  /// Drop component's channel without a callback
+  void end_channel(AbilityComponent* component);
+
+  bool is_channeling(AbilityComponent* component) const;
+
+  int32_t get_channel_count() const;
+  int32_t get_last_tick_fired() const;
+
+  static ChannelSystem* get_singleton();
+  static ChannelSystem* ensure_singleton(Node* context);
+
+ private:
+  static ChannelSystem* singleton_instance;
+};
+
+#endif  // GDEXTENSION_CHANNEL_SYSTEM_H
@@ -0,0 +1,199 @@
+#include "damage_queue.hpp"
+
+#include <algorithm>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/object.hpp>
+
+#include "../common/unit_signals.hpp"
+#include "../core/unit.hpp"
+#include "../debug/debug_macros.hpp"
+#include "tick_stages.hpp"
+
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::Engine;
+using godot::Object;
+using godot::ObjectDB;
+
+DamageQueue* DamageQueue::singleton_instance = nullptr;
+
+DamageQueue::DamageQueue() {
+  singleton_instance = this;
+}
+
+DamageQueue::~DamageQueue() {
+  if (singleton_instance == this) {
+    singleton_instance = nullptr;
+  }
+}
+
+void DamageQueue::_bind_methods() {
+  ClassDB::bind_method(D_METHOD("get_pending_count"),
+                       &DamageQueue::get_pending_count);
+  ClassDB::bind_method(D_METHOD("get_last_tick_events"),
+                       &DamageQueue::get_last_tick_events);
+  ClassDB::bind_method(D_METHOD("get_last_tick_targets"),
+                       &DamageQueue::get_last_tick_targets);
+}
+
+void DamageQueue::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  singleton_instance = this;
+  set_physics_process_priority(TickStage::DAMAGE);
+  set_physics_process(true);
+}
+
+void DamageQueue::_physics_process(double delta) {
+  last_tick_events = static_cast<int32_t>(pending.size());
+  last_tick_targets = 0;
+  if (pending.empty()) {
+    return;
+  }
+
+  // Anything queued from here on (death reactions) belongs to the next tick
+  resolving.swap(pending);
+
+  // Pass 1: group hits by target (sorted reusable keys, so merging
+  // allocates nothing once the vectors have grown)
+  merge_keys.clear();
+  for (int32_t i = 0; i < static_cast<int32_t>(resolving.size()); ++i) {
+    merge_keys.push_back({resolving[i].target_id, i});
+  }
+  std::sort(merge_keys.begin(), merge_keys.end());
+
+  // Mitigate each hit and merge per target, in queue order
+  for (size_t run = 0; run < merge_keys.size();) {
+    uint64_t target_id = merge_keys[run].target_id;
+    size_t run_end = run;
+    while (run_end < merge_keys.size() &&
+           merge_keys[run_end].target_id == target_id) {
+      run_end++;
+    }
+
+    Unit* target = Object::cast_to<Unit>(ObjectDB::get_instance(target_id));
+    if (target != nullptr && target->is_inside_tree()) {
+      MergedDamage entry;
+      entry.target_id = target_id;
+      for (size_t i = run; i < run_end; ++i) {
+        const DamageEvent& event = resolving[merge_keys[i].index];
+        entry.amount += mitigate(target, event.amount, event.type);
+        if (event.source_id != 0) {
+          entry.source_id = event.source_id;
+        }
+      }
+      merged.push_back(entry);
+    }
+    run = run_end;
+  }
+  resolving.clear();
+
+  // Pass 2: one take_damage relay per target
+  for (const MergedDamage& entry : merged) {
+    Unit* target =
+        Object::cast_to<Unit>(ObjectDB::get_instance(entry.target_id));
+    if (target == nullptr || !target->is_inside_tree()) {
+      continue;
+    }
+
+    Object* source = entry.source_id != 0
+                         ? ObjectDB::get_instance(entry.source_id)
+                         : nullptr;
+    target->relay(take_damage, entry.amount, source);
+    last_tick_targets++;
+  }
+  merged.clear();
+}
+
+void DamageQueue::enqueue(Unit* target,
+                          float amount,
+                          DamageType type,
+                          Unit* source) {
+  if (target == nullptr || amount <= 0.0f) {
+    return;
+  }
+
+  DamageEvent event;
+  event.target_id = target->get_instance_id();
+  event.source_id = source != nullptr ? source->get_instance_id() : 0;
+  event.amount = amount;
+  event.type = type;
+  pending.push_back(event);
+}
+
+void DamageQueue::submit(Unit* target,
+                         float amount,
+                         DamageType type,
+                         Unit* source) {
+  if (target == nullptr) {
+    return;
+  }
+
+  DamageQueue* queue = ensure_singleton(target);
+  if (queue == nullptr) {
+    target->relay(take_damage, mitigate(target, amount, type), source);
+    return;
+  }
+  queue->enqueue(target, amount, type, source);
+}
+
+float DamageQueue::mitigate(const Unit* target,
+                            float amount,
+                            DamageType type) {
+  if (target == nullptr || type == DamageType::PURE) {
+    return amount;
+  }
+
+  const StatBlock& stats = target->get_stats();
+  return mitigate(amount, type, stats.get(Stat::ARMOR),
+                  stats.get(Stat::MAGIC_RESIST));
+}
+
+float DamageQueue::mitigate(float amount,
+                            DamageType type,
+                            float armor,
+                            float magic_resist) {
+  if (type == DamageType::PURE) {
+    return amount;
+  }
+
+  float resistance = type == DamageType::PHYSICAL ? armor : magic_resist;
+  return amount * 100.0f / (100.0f + resistance);
+}
+
+int32_t DamageQueue::get_pending_count() const {
+  return static_cast<int32_t>(pending.size());
+}
+
+int32_t DamageQueue::get_last_tick_events() const {
+  return last_tick_events;
+}
+
+int32_t DamageQueue::get_last_tick_targets() const {
+  return last_tick_targets;
+}
+
+DamageQueue* DamageQueue::get_singleton() {
+  return singleton_instance;
+}
+
+DamageQueue* DamageQueue::ensure_singleton(Node* context) {
+  if (singleton_instance != nullptr) {
+    return singleton_instance;
+  }
+
+  if (context == nullptr || !context->is_inside_tree()) {
+    return nullptr;
+  }
+
+  DamageQueue* queue = memnew(DamageQueue);
+  queue->set_name("DamageQueue");
+  context->get_tree()->get_root()->call_deferred("add_child", queue);
+  DBG_INFO("DamageQueue", "Created damage queue");
+  return singleton_instance;
+}
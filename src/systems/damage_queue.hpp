@@ -0,0 +1,98 @@
+#ifndef GDEXTENSION_DAMAGE_QUEUE_H
+#define GDEXTENSION_DAMAGE_QUEUE_H
+
+#include <cstdint>
+#include <godot_cpp/classes/node.hpp>
+#include <vector>
+
+#include "../common/damage_type.hpp"
+
+using godot::Node;
+
+class Unit;
+
+/// Per-tick damage queue
+/// Hits (attacks, projectiles, abilities) are queued instead of relayed
+/// immediately, and resolved in one pass at TickStage::DAMAGE:
+/// - Armor / magic resist from the target's StatBlock mitigate each hit
+/// - All hits on the same target are merged into one take_damage relay, so
+///   HealthComponent emits at most one health_changed per unit per tick
+/// - Deaths happen in this pass, never in the middle of another component's
+///   update; kill credit goes to the last source that hit the target
+///
+/// Damage queued while resolving (e.g. on-death effects) lands next tick.
+class DamageQueue : public Node {
+  GDCLASS(DamageQueue, Node)
+
+ protected:
+  static void _bind_methods();
+
+  struct DamageEvent {
+    uint64_t target_id = 0;
+    uint64_t source_id = 0;  // 0 = no source
+    float amount = 0.0f;
+    DamageType type = DamageType::PHYSICAL;
+  };
+
+  // Sorting these groups a tick's hits by target, queue order within
+  struct MergeKey {
+    uint64_t target_id = 0;
+    int32_t index = 0;  // Position in resolving
+
+    bool operator<(const MergeKey& other) const {
+      return target_id != other.target_id ? target_id < other.target_id
+                                          : index < other.index;
+    }
+  };
+
+  struct MergedDamage {
+    uint64_t target_id = 0;
+    uint64_t source_id = 0;  // Last source in queue order
+    float amount = 0.0f;
+  };
+
+  std::vector<DamageEvent> pending;
+  std::vector<DamageEvent> resolving;  // Swapped with pending each tick
+  std::vector<MergeKey> merge_keys;  // Reused every tick
+  std::vector<MergedDamage> merged;
+
+  int32_t last_tick_events = 0;
+  int32_t last_tick_targets = 0;
+
+ public:
+  DamageQueue();
+  ~DamageQueue();
+
+  void _ready() override;
+  void _physics_process(double delta) override;
+
+  void enqueue(Unit* target, float amount, DamageType type, Unit* source);
+
+  int32_t get_pending_count() const;
+  int32_t get_last_tick_events() const;
+  int32_t get_last_tick_targets() const;
+
+  /// Queue a hit, or relay take_damage right away if no queue can be created
+  /// (target outside the tree). Use this instead of relaying take_damage.
+  static void submit(Unit* target,
+                     float amount,
+                     DamageType type,
+                     Unit* source = nullptr);
+
+  /// Damage left after the target's armor / magic resist
+  static float mitigate(const Unit* target, float amount, DamageType type);
+
+  /// Same formula for targets without a StatBlock (proxy minions)
+  static float mitigate(float amount,
+                        DamageType type,
+                        float armor,
+                        float magic_resist);
+
+  static DamageQueue* get_singleton();
+  static DamageQueue* ensure_singleton(Node* context);
+
+ private:
+  static DamageQueue* singleton_instance;
+};
+
+#endif  // GDEXTENSION_DAMAGE_QUEUE_H
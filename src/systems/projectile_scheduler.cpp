@@ -0,0 +1,297 @@
+#include "projectile_scheduler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/object.hpp>
+
+#include "../components/combat/projectile.hpp"
+#include "../core/unit.hpp"
+#include "../debug/debug_macros.hpp"
+#include "simulation_clock.hpp"
+#include "tick_stages.hpp"
+
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::Engine;
+using godot::Object;
+using godot::ObjectDB;
+
+ProjectileScheduler* ProjectileScheduler::singleton_instance = nullptr;
+
+ProjectileScheduler::ProjectileScheduler() {
+  singleton_instance = this;
+}
+
+ProjectileScheduler::~ProjectileScheduler() {
+  if (singleton_instance == this) {
+    singleton_instance = nullptr;
+  }
+}
+
+void ProjectileScheduler::_bind_methods() {
+  ClassDB::bind_method(D_METHOD("get_in_flight_count"),
+                       &ProjectileScheduler::get_in_flight_count);
+}
+
+void ProjectileScheduler::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  singleton_instance = this;
+  set_physics_process_priority(TickStage::PROJECTILES);
+  set_physics_process(true);
+}
+
+void ProjectileScheduler::_physics_process(double delta) {
+  if (in_flight_count == 0) {
+    return;
+  }
+
+  uint64_t tick = SimulationClock::get_tick();
+
+  // Advance every flight along its predicted path; re-solve on target
+  // velocity changes only
+  for (int32_t slot = 0; slot < static_cast<int32_t>(flights.size()); slot++) {
+    Flight& flight = flights[slot];
+    if (flight.projectile == nullptr) {
+      continue;
+    }
+
+    Unit* target =
+        Object::cast_to<Unit>(ObjectDB::get_instance(flight.target_id));
+    if (target == nullptr || !target->is_inside_tree()) {
+      Projectile* projectile = flight.projectile;
+      _release(slot);
+      projectile->queue_free();
+      continue;
+    }
+
+    Vector3 position = _position_at(flight, tick);
+    Vector3 velocity = target->get_velocity();
+    if ((velocity - flight.target_velocity).length_squared() >
+        RESOLVE_VELOCITY_THRESHOLD * RESOLVE_VELOCITY_THRESHOLD) {
+      if (!_solve(flight, target, position, tick)) {
+        // Target now outruns the projectile - let it chase per tick
+        Projectile* projectile = flight.projectile;
+        _release(slot);
+        projectile->resume_homing(position);
+        continue;
+      }
+      flight.generation++;
+      _push_hit(slot);
+    }
+
+    flight.projectile->advance_flight(position);
+  }
+
+  // Land every hit that is due; stale entries (re-solved or cancelled
+  // flights) are skipped by generation
+  while (!hit_heap.empty() && hit_heap.front().tick <= tick) {
+    std::pop_heap(hit_heap.begin(), hit_heap.end(), _later_hit);
+    ScheduledHit hit = hit_heap.back();
+    hit_heap.pop_back();
+
+    Flight& flight = flights[hit.slot];
+    if (flight.projectile == nullptr || flight.generation != hit.generation) {
+      continue;
+    }
+
+    Projectile* projectile = flight.projectile;
+    _release(hit.slot);
+    projectile->land_flight();
+  }
+}
+
+int32_t ProjectileScheduler::schedule(Projectile* projectile,
+                                      Unit* target,
+                                      const Vector3& origin,
+                                      float speed,
+                                      float hit_radius) {
+  if (projectile == nullptr || target == nullptr || speed <= 0.0f) {
+    return INVALID_SLOT;
+  }
+
+  Flight flight;
+  flight.projectile = projectile;
+  flight.target_id = target->get_instance_id();
+  flight.speed = speed;
+  flight.hit_radius = hit_radius;
+  if (!_solve(flight, target, origin, SimulationClock::get_tick())) {
+    return INVALID_SLOT;
+  }
+
+  int32_t slot = INVALID_SLOT;
+  if (!free_slots.empty()) {
+    slot = free_slots.back();
+    free_slots.pop_back();
+    flight.generation = flights[slot].generation + 1;
+    flights[slot] = flight;
+  } else {
+    slot = static_cast<int32_t>(flights.size());
+    flights.push_back(flight);
+  }
+
+  in_flight_count++;
+  _push_hit(slot);
+  return slot;
+}
+
+void ProjectileScheduler::cancel(int32_t slot, const Projectile* projectile) {
+  if (slot < 0 || slot >= static_cast<int32_t>(flights.size())) {
+    return;
+  }
+
+  if (flights[slot].projectile != projectile) {
+    return;
+  }
+
+  _release(slot);
+}
+
+int32_t ProjectileScheduler::get_in_flight_count() const {
+  return in_flight_count;
+}
+
+bool ProjectileScheduler::_solve(Flight& flight,
+                                 const Unit* target,
+                                 const Vector3& origin,
+                                 uint64_t tick) {
+  Vector3 target_position = target->get_global_position();
+  Vector3 target_velocity = target->get_velocity();
+
+  double time = 0.0;
+  if (!solve_intercept_time(origin, target_position, target_velocity,
+                            flight.speed, flight.hit_radius, time)) {
+    return false;
+  }
+
+  // The projectile flies straight at the predicted contact point
+  Vector3 contact =
+      target_position + target_velocity * static_cast<float>(time);
+  Vector3 to_contact = contact - origin;
+  float distance = to_contact.length();
+  float travel = flight.speed * static_cast<float>(time);
+
+  flight.origin = origin;
+  flight.impact = distance > 0.001f ? origin + to_contact * (travel / distance)
+                                    : origin;
+  flight.target_velocity = target_velocity;
+  flight.origin_tick = tick;
+  flight.impact_tick = tick + SimulationClock::seconds_to_ticks(time);
+  flight.flight_time = time;
+  return true;
+}
+
+Vector3 ProjectileScheduler::_position_at(const Flight& flight,
+                                          uint64_t tick) const {
+  if (flight.flight_time <= 0.0 || tick <= flight.origin_tick) {
+    return flight.origin;
+  }
+
+  double elapsed = static_cast<double>(tick - flight.origin_tick) *
+                   SimulationClock::get_fixed_delta();
+  double fraction = std::min(1.0, elapsed / flight.flight_time);
+  return flight.origin.lerp(flight.impact, static_cast<float>(fraction));
+}
+
+void ProjectileScheduler::_push_hit(int32_t slot) {
+  ScheduledHit hit;
+  hit.tick = flights[slot].impact_tick;
+  hit.slot = slot;
+  hit.generation = flights[slot].generation;
+  hit_heap.push_back(hit);
+  std::push_heap(hit_heap.begin(), hit_heap.end(), _later_hit);
+}
+
+bool ProjectileScheduler::_later_hit(const ScheduledHit& a,
+                                     const ScheduledHit& b) {
+  // std heap functions build a max-heap; invert so the earliest tick is on top
+  return a.tick > b.tick;
+}
+
+void ProjectileScheduler::_release(int32_t slot) {
+  Flight& flight = flights[slot];
+  flight.projectile = nullptr;
+  flight.generation++;  // Invalidates any pending heap entry
+  free_slots.push_back(slot);
+  in_flight_count--;
+}
+
+bool ProjectileScheduler::solve_intercept_time(const Vector3& origin,
+                                               const Vector3& target_position,
+                                               const Vector3& target_velocity,
+                                               float speed,
+                                               float hit_radius,
+                                               double& out_time) {
+  // Contact when |D + V t| = s t + r, with D = target - origin. Squaring:
+  // (V.V - s^2) t^2 + 2 (D.V - s r) t + (D.D - r^2) = 0
+  Vector3 offset = target_position - origin;
+  double a = static_cast<double>(target_velocity.dot(target_velocity)) -
+             static_cast<double>(speed) * speed;
+  double b = 2.0 * (static_cast<double>(offset.dot(target_velocity)) -
+                    static_cast<double>(speed) * hit_radius);
+  double c = static_cast<double>(offset.dot(offset)) -
+             static_cast<double>(hit_radius) * hit_radius;
+
+  // Already in contact
+  if (c <= 0.0) {
+    out_time = 0.0;
+    return true;
+  }
+
+  // Target moves exactly as fast as the projectile: linear equation
+  if (std::abs(a) < 1e-6) {
+    if (b >= 0.0) {
+      return false;
+    }
+    out_time = -c / b;
+    return true;
+  }
+
+  double discriminant = b * b - 4.0 * a * c;
+  if (discriminant < 0.0) {
+    return false;
+  }
+
+  double root = std::sqrt(discriminant);
+  double t1 = (-b - root) / (2.0 * a);
+  double t2 = (-b + root) / (2.0 * a);
+  if (t1 > t2) {
+    std::swap(t1, t2);
+  }
+
+  if (t1 >= 0.0) {
+    out_time = t1;
+  } else if (t2 >= 0.0) {
+    out_time = t2;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+ProjectileScheduler* ProjectileScheduler::get_singleton() {
+  return singleton_instance;
+}
+
+ProjectileScheduler* ProjectileScheduler::ensure_singleton(Node* context) {
+  if (singleton_instance != nullptr) {
+    return singleton_instance;
+  }
+
+  if (context == nullptr || !context->is_inside_tree()) {
+    return nullptr;
+  }
+
+  // Flights scheduled before the node enters the tree start on its first tick
+  ProjectileScheduler* scheduler = memnew(ProjectileScheduler);
+  scheduler->set_name("ProjectileScheduler");
+  context->get_tree()->get_root()->call_deferred("add_child", scheduler);
+  DBG_INFO("ProjectileScheduler", "Created projectile scheduler");
+  return singleton_instance;
+}
@@ -0,0 +1,108 @@
+#ifndef GDEXTENSION_PROJECTILE_SCHEDULER_H
+#define GDEXTENSION_PROJECTILE_SCHEDULER_H
+
+#include <cstdint>
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <vector>
+
+using godot::Node;
+using godot::Vector3;
+
+class Projectile;
+class Unit;
+
+/// Event-driven scheduler for homing projectiles
+/// Instead of steering every projectile every tick, the intercept with the
+/// (constant-velocity) target is solved analytically when fired and the hit
+/// is scheduled for the matching simulation tick in a min-heap.
+///
+/// Per tick, in-flight projectiles only:
+/// - compare the target's velocity with the one used for the solve, and
+///   re-solve from the current position when it changed noticeably
+/// - write their position along the predicted path (batched through the
+///   TransformWriteback stage; rendering interpolates between ticks)
+///
+/// Projectiles whose target outruns them fall back to per-tick homing.
+class ProjectileScheduler : public Node {
+  GDCLASS(ProjectileScheduler, Node)
+
+ protected:
+  static void _bind_methods();
+
+  struct Flight {
+    Projectile* projectile = nullptr;  // nullptr = free slot
+    uint32_t generation = 0;           // Bumped on re-solve and release
+    uint64_t target_id = 0;            // Instance id; target may be freed
+    Vector3 origin;           // Position at origin_tick
+    Vector3 impact;           // Projectile position at contact
+    Vector3 target_velocity;  // Velocity the current solve assumed
+    uint64_t origin_tick = 0;
+    uint64_t impact_tick = 0;
+    double flight_time = 0.0;  // Seconds from origin to impact
+    float speed = 0.0f;
+    float hit_radius = 0.0f;
+  };
+
+  struct ScheduledHit {
+    uint64_t tick = 0;
+    int32_t slot = -1;
+    uint32_t generation = 0;
+  };
+
+  std::vector<Flight> flights;
+  std::vector<int32_t> free_slots;
+  std::vector<ScheduledHit> hit_heap;  // Min-heap on tick
+  int32_t in_flight_count = 0;
+
+  // Solve the flight from origin at the given tick; false if unreachable
+  bool _solve(Flight& flight,
+              const Unit* target,
+              const Vector3& origin,
+              uint64_t tick);
+  Vector3 _position_at(const Flight& flight, uint64_t tick) const;
+  void _push_hit(int32_t slot);
+  void _release(int32_t slot);
+  static bool _later_hit(const ScheduledHit& a, const ScheduledHit& b);
+
+ public:
+  static constexpr int32_t INVALID_SLOT = -1;
+
+  // Target velocity change (m/s) that triggers a re-solve
+  static constexpr float RESOLVE_VELOCITY_THRESHOLD = 0.25f;
+
+  ProjectileScheduler();
+  ~ProjectileScheduler();
+
+  void _ready() override;
+  void _physics_process(double delta) override;
+
+  /// Schedule a projectile's hit. Returns INVALID_SLOT when the target can't
+  /// be intercepted (caller should keep homing per tick instead)
+  int32_t schedule(Projectile* projectile,
+                   Unit* target,
+                   const Vector3& origin,
+                   float speed,
+                   float hit_radius);
+  void cancel(int32_t slot, const Projectile* projectile);
+
+  int32_t get_in_flight_count() const;
+
+  /// Earliest time t >= 0 at which a projectile leaving origin at speed
+  /// reaches hit_radius of a target at target_position moving at
+  /// target_velocity. Returns false if it never does.
+  static bool solve_intercept_time(const Vector3& origin,
+                                   const Vector3& target_position,
+                                   const Vector3& target_velocity,
+                                   float speed,
+                                   float hit_radius,
+                                   double& out_time);
+
+  static ProjectileScheduler* get_singleton();
+  static ProjectileScheduler* ensure_singleton(Node* context);
+
+ private:
+  static ProjectileScheduler* singleton_instance;
+};
+
+#endif  // GDEXTENSION_PROJECTILE_SCHEDULER_H
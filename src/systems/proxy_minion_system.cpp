@@ -0,0 +1,547 @@
+#include "proxy_minion_system.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/multi_mesh_instance3d.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/object.hpp>
+
+#include "../core/faction_table.hpp"
+#include "../debug/debug_macros.hpp"
+#include "damage_queue.hpp"
+#include "tick_stages.hpp"
+
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::DEFVAL;
+using godot::Engine;
+using godot::MultiMeshInstance3D;
+
+ProxyMinionSystem* ProxyMinionSystem::singleton_instance = nullptr;
+
+namespace {
+// MultiMesh TRANSFORM_3D instances are a row-major 3x4 matrix
+constexpr int32_t FLOATS_PER_INSTANCE = 12;
+constexpr int32_t MIN_ARCHETYPE_CAPACITY = 64;
+}  // namespace
+
+ProxyMinionSystem::ProxyMinionSystem() {
+  singleton_instance = this;
+}
+
+ProxyMinionSystem::~ProxyMinionSystem() {
+  if (singleton_instance == this) {
+    singleton_instance = nullptr;
+  }
+}
+
+void ProxyMinionSystem::_bind_methods() {
+  ClassDB::bind_method(
+      D_METHOD("add_archetype", "mesh", "max_health", "speed", "radius"),
+      &ProxyMinionSystem::add_archetype);
+  ClassDB::bind_method(D_METHOD("set_archetype_resistances", "archetype",
+                                "armor", "magic_resist"),
+                       &ProxyMinionSystem::set_archetype_resistances);
+  ClassDB::bind_method(D_METHOD("reserve", "archetype", "count"),
+                       &ProxyMinionSystem::reserve);
+  ClassDB::bind_method(
+      D_METHOD("spawn", "archetype", "position", "faction_id", "target"),
+      &ProxyMinionSystem::spawn);
+  ClassDB::bind_method(D_METHOD("kill", "handle"), &ProxyMinionSystem::kill);
+  ClassDB::bind_method(D_METHOD("set_target", "handle", "target"),
+                       &ProxyMinionSystem::set_target);
+  ClassDB::bind_method(D_METHOD("is_alive", "handle"),
+                       &ProxyMinionSystem::is_alive);
+  ClassDB::bind_method(D_METHOD("get_proxy_position", "handle"),
+                       &ProxyMinionSystem::get_proxy_position);
+  ClassDB::bind_method(D_METHOD("get_health", "handle"),
+                       &ProxyMinionSystem::get_health);
+  ClassDB::bind_method(
+      D_METHOD("apply_damage", "handle", "amount", "damage_type"),
+      &ProxyMinionSystem::apply_damage,
+      DEFVAL(static_cast<int>(DamageType::MAGICAL)));
+  ClassDB::bind_method(D_METHOD("get_count"), &ProxyMinionSystem::get_count);
+  ClassDB::bind_method(D_METHOD("get_last_tick_deaths"),
+                       &ProxyMinionSystem::get_last_tick_deaths);
+}
+
+void ProxyMinionSystem::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  singleton_instance = this;
+  set_physics_process_priority(TickStage::PROXIES);
+  set_physics_process(true);
+}
+
+void ProxyMinionSystem::_physics_process(double delta) {
+  last_tick_deaths = 0;
+  _resolve_damage();
+  if (live_count > 0) {
+    _march(delta);
+  }
+  _fill_buffers();
+}
+
+int32_t ProxyMinionSystem::add_archetype(const Ref<Mesh>& mesh,
+                                         float max_health,
+                                         float speed,
+                                         float radius) {
+  Archetype archetype;
+  archetype.mesh = mesh;
+  archetype.max_health = std::max(1.0f, max_health);
+  archetype.speed = std::max(0.0f, speed);
+  archetype.radius = std::max(0.05f, radius);
+  max_radius = std::max(max_radius, archetype.radius);
+
+  archetype.multimesh.instantiate();
+  archetype.multimesh->set_transform_format(MultiMesh::TRANSFORM_3D);
+  archetype.multimesh->set_mesh(mesh);
+  archetype.instance = memnew(MultiMeshInstance3D);
+  archetype.instance->set_multimesh(archetype.multimesh);
+  add_child(archetype.instance);
+
+  archetypes.push_back(archetype);
+  return static_cast<int32_t>(archetypes.size()) - 1;
+}
+
+void ProxyMinionSystem::set_archetype_resistances(int32_t archetype,
+                                                  float armor,
+                                                  float magic_resist) {
+  if (archetype < 0 || archetype >= static_cast<int32_t>(archetypes.size())) {
+    return;
+  }
+  archetypes[archetype].armor = armor;
+  archetypes[archetype].magic_resist = magic_resist;
+}
+
+void ProxyMinionSystem::reserve(int32_t archetype, int32_t count) {
+  if (archetype < 0 || archetype >= static_cast<int32_t>(archetypes.size()) ||
+      count <= 0) {
+    return;
+  }
+
+  Archetype& type = archetypes[archetype];
+  _grow_archetype(type, type.population + count);
+
+  size_t slots = xs.size() + static_cast<size_t>(count);
+  xs.reserve(slots);
+  ys.reserve(slots);
+  zs.reserve(slots);
+  target_xs.reserve(slots);
+  target_zs.reserve(slots);
+  facing_sin.reserve(slots);
+  facing_cos.reserve(slots);
+  health.reserve(slots);
+  pending_damage.reserve(slots);
+  faction_bits.reserve(slots);
+  archetype_of.reserve(slots);
+  generations.reserve(slots);
+  alive.reserve(slots);
+  free_slots.reserve(slots);
+  damaged_slots.reserve(slots);
+}
+
+int64_t ProxyMinionSystem::spawn(int32_t archetype,
+                                 const Vector3& position,
+                                 int32_t faction_id,
+                                 const Vector3& target) {
+  if (archetype < 0 || archetype >= static_cast<int32_t>(archetypes.size())) {
+    DBG_WARN("ProxyMinionSystem", "Unknown archetype " +
+                                      godot::String::num(archetype));
+    return INVALID_HANDLE;
+  }
+
+  Archetype& type = archetypes[archetype];
+  int32_t slot = _allocate_slot();
+  xs[slot] = position.x;
+  ys[slot] = position.y;
+  zs[slot] = position.z;
+  target_xs[slot] = target.x;
+  target_zs[slot] = target.z;
+  facing_sin[slot] = 0.0f;
+  facing_cos[slot] = 1.0f;
+  health[slot] = type.max_health;
+  pending_damage[slot] = 0.0f;
+  faction_bits[slot] = FactionTable::faction_bit(faction_id);
+  archetype_of[slot] = archetype;
+  alive[slot] = 1;
+
+  type.population++;
+  live_count++;
+  grid_dirty = true;
+  _grow_archetype(type, type.population);
+  return _make_handle(slot, generations[slot]);
+}
+
+void ProxyMinionSystem::kill(int64_t handle) {
+  int32_t slot = _resolve(handle);
+  if (slot >= 0) {
+    _kill_slot(slot);
+  }
+}
+
+void ProxyMinionSystem::set_target(int64_t handle, const Vector3& target) {
+  int32_t slot = _resolve(handle);
+  if (slot >= 0) {
+    target_xs[slot] = target.x;
+    target_zs[slot] = target.z;
+  }
+}
+
+bool ProxyMinionSystem::is_alive(int64_t handle) const {
+  return _resolve(handle) >= 0;
+}
+
+bool ProxyMinionSystem::get_position(int64_t handle,
+                                     Vector3& out_position) const {
+  int32_t slot = _resolve(handle);
+  if (slot < 0) {
+    return false;
+  }
+  out_position = Vector3(xs[slot], ys[slot], zs[slot]);
+  return true;
+}
+
+uint32_t ProxyMinionSystem::get_faction_bit(int64_t handle) const {
+  int32_t slot = _resolve(handle);
+  return slot >= 0 ? faction_bits[slot] : 0;
+}
+
+float ProxyMinionSystem::get_radius(int64_t handle) const {
+  int32_t slot = _resolve(handle);
+  return slot >= 0 ? archetypes[archetype_of[slot]].radius : 0.0f;
+}
+
+float ProxyMinionSystem::get_health(int64_t handle) const {
+  int32_t slot = _resolve(handle);
+  return slot >= 0 ? health[slot] : 0.0f;
+}
+
+float ProxyMinionSystem::submit_damage(int64_t handle,
+                                       float amount,
+                                       DamageType type) {
+  int32_t slot = _resolve(handle);
+  if (slot < 0 || amount <= 0.0f) {
+    return 0.0f;
+  }
+
+  const Archetype& archetype = archetypes[archetype_of[slot]];
+  float mitigated = DamageQueue::mitigate(amount, type, archetype.armor,
+                                          archetype.magic_resist);
+  if (pending_damage[slot] <= 0.0f) {
+    damaged_slots.push_back(slot);
+  }
+  pending_damage[slot] += mitigated;
+  return mitigated;
+}
+
+int32_t ProxyMinionSystem::damage_radius(const Vector3& center,
+                                         float radius,
+                                         uint32_t faction_mask,
+                                         float amount,
+                                         DamageType type) {
+  int32_t hit = 0;
+  visit_radius(center, radius, faction_mask,
+               [&](int64_t handle, float distance_sq) {
+                 submit_damage(handle, amount, type);
+                 hit++;
+               });
+  return hit;
+}
+
+int64_t ProxyMinionSystem::find_nearest(const Vector3& center,
+                                        float max_range,
+                                        uint32_t faction_mask) const {
+  int64_t nearest = INVALID_HANDLE;
+  float best_sq = max_range * max_range;
+  visit_radius(center, max_range, faction_mask,
+               [&](int64_t handle, float distance_sq) {
+                 if (distance_sq <= best_sq) {
+                   best_sq = distance_sq;
+                   nearest = handle;
+                 }
+               });
+  return nearest;
+}
+
+int64_t ProxyMinionSystem::pick_ray(const Vector3& from,
+                                    const Vector3& direction,
+                                    float max_distance,
+                                    uint32_t faction_mask) const {
+  if (live_count == 0) {
+    return INVALID_HANDLE;
+  }
+  if (grid_dirty) {
+    _rebuild_grid();
+  }
+
+  // Clip the ray to the height band the bounding spheres occupy, so only
+  // the cells under that stretch are visited
+  float band_low = grid_min_y;
+  float band_high = grid_max_y + 2.0f * max_radius;
+  float t_min = 0.0f;
+  float t_max = max_distance;
+  if (std::abs(direction.y) > 1e-6f) {
+    float t_low = (band_low - from.y) / direction.y;
+    float t_high = (band_high - from.y) / direction.y;
+    t_min = std::max(t_min, std::min(t_low, t_high));
+    t_max = std::min(t_max, std::max(t_low, t_high));
+  } else if (from.y < band_low || from.y > band_high) {
+    return INVALID_HANDLE;
+  }
+  if (t_min > t_max) {
+    return INVALID_HANDLE;
+  }
+
+  Vector3 start = from + direction * t_min;
+  Vector3 end = from + direction * t_max;
+  int64_t picked = INVALID_HANDLE;
+  float best_t = t_max;
+  _visit_box(
+      std::min(start.x, end.x) - max_radius,
+      std::min(start.z, end.z) - max_radius,
+      std::max(start.x, end.x) + max_radius,
+      std::max(start.z, end.z) + max_radius, [&](int32_t slot) {
+        if ((faction_bits[slot] & faction_mask) == 0) {
+          return;
+        }
+
+        // Bounding sphere resting on the ground point
+        float radius = archetypes[archetype_of[slot]].radius;
+        float px = xs[slot] - from.x;
+        float py = ys[slot] + radius - from.y;
+        float pz = zs[slot] - from.z;
+        float t = px * direction.x + py * direction.y + pz * direction.z;
+        if (t < 0.0f || t > best_t) {
+          return;
+        }
+
+        float ox = px - direction.x * t;
+        float oy = py - direction.y * t;
+        float oz = pz - direction.z * t;
+        if (ox * ox + oy * oy + oz * oz <= radius * radius) {
+          best_t = t;
+          picked = _make_handle(slot, generations[slot]);
+        }
+      });
+  return picked;
+}
+
+int32_t ProxyMinionSystem::_resolve(int64_t handle) const {
+  if (handle < 0) {
+    return -1;
+  }
+
+  int32_t slot = static_cast<int32_t>(handle & 0xffffffff);
+  uint32_t generation = static_cast<uint32_t>(handle >> 32);
+  if (slot >= static_cast<int32_t>(xs.size()) || alive[slot] == 0 ||
+      generations[slot] != generation) {
+    return -1;
+  }
+  return slot;
+}
+
+int32_t ProxyMinionSystem::_allocate_slot() {
+  if (!free_slots.empty()) {
+    int32_t slot = free_slots.back();
+    free_slots.pop_back();
+    return slot;
+  }
+
+  xs.push_back(0.0f);
+  ys.push_back(0.0f);
+  zs.push_back(0.0f);
+  target_xs.push_back(0.0f);
+  target_zs.push_back(0.0f);
+  facing_sin.push_back(0.0f);
+  facing_cos.push_back(1.0f);
+  health.push_back(0.0f);
+  pending_damage.push_back(0.0f);
+  faction_bits.push_back(0);
+  archetype_of.push_back(0);
+  generations.push_back(1);
+  alive.push_back(0);
+  return static_cast<int32_t>(xs.size()) - 1;
+}
+
+void ProxyMinionSystem::_kill_slot(int32_t slot) {
+  // A new generation invalidates every handle to this proxy
+  alive[slot] = 0;
+  generations[slot] = std::max(1u, generations[slot] + 1);
+  pending_damage[slot] = 0.0f;
+  archetypes[archetype_of[slot]].population--;
+  live_count--;
+  free_slots.push_back(slot);
+}
+
+void ProxyMinionSystem::_grow_archetype(Archetype& archetype,
+                                        int32_t capacity) {
+  if (capacity <= archetype.capacity) {
+    return;
+  }
+
+  // Doubling keeps MultiMesh reallocations rare; reserve() avoids them
+  int32_t new_capacity = std::max(
+      {capacity, archetype.capacity * 2, MIN_ARCHETYPE_CAPACITY});
+  archetype.multimesh->set_instance_count(new_capacity);
+  archetype.buffer.resize(new_capacity * FLOATS_PER_INSTANCE);
+  archetype.capacity = new_capacity;
+}
+
+void ProxyMinionSystem::_resolve_damage() {
+  for (int32_t slot : damaged_slots) {
+    float damage = pending_damage[slot];
+    if (alive[slot] == 0 || damage <= 0.0f) {
+      continue;
+    }
+
+    pending_damage[slot] = 0.0f;
+    health[slot] -= damage;
+    if (health[slot] <= 0.0f) {
+      _kill_slot(slot);
+      last_tick_deaths++;
+    }
+  }
+  damaged_slots.clear();
+}
+
+void ProxyMinionSystem::_march(double delta) {
+  int32_t count = static_cast<int32_t>(xs.size());
+  for (int32_t slot = 0; slot < count; slot++) {
+    if (alive[slot] == 0) {
+      continue;
+    }
+
+    float dx = target_xs[slot] - xs[slot];
+    float dz = target_zs[slot] - zs[slot];
+    float distance_sq = dx * dx + dz * dz;
+    if (distance_sq < 1e-6f) {
+      continue;
+    }
+
+    float distance = std::sqrt(distance_sq);
+    float step = archetypes[archetype_of[slot]].speed *
+                 static_cast<float>(delta);
+    if (step >= distance) {
+      xs[slot] = target_xs[slot];
+      zs[slot] = target_zs[slot];
+    } else {
+      xs[slot] += dx / distance * step;
+      zs[slot] += dz / distance * step;
+    }
+
+    // Yaw that turns -Z (forward) onto the step direction
+    facing_sin[slot] = -dx / distance;
+    facing_cos[slot] = -dz / distance;
+  }
+  grid_dirty = true;
+}
+
+void ProxyMinionSystem::_rebuild_grid() const {
+  grid_dirty = false;
+  cell_start.assign(UnitIndex::CELL_COUNT + 1, 0);
+  cell_slots.resize(live_count);
+
+  int32_t count = static_cast<int32_t>(xs.size());
+  slot_cells.resize(count);
+  grid_min_y = std::numeric_limits<float>::max();
+  grid_max_y = std::numeric_limits<float>::lowest();
+  for (int32_t slot = 0; slot < count; slot++) {
+    if (alive[slot] == 0) {
+      continue;
+    }
+    int32_t cell = _grid_coord(zs[slot]) * UnitIndex::GRID_DIM +
+                   _grid_coord(xs[slot]);
+    slot_cells[slot] = cell;
+    cell_start[cell]++;
+    grid_min_y = std::min(grid_min_y, ys[slot]);
+    grid_max_y = std::max(grid_max_y, ys[slot]);
+  }
+
+  // Inclusive prefix sums: cell_start[cell] is the end of the cell for now
+  for (int32_t cell = 1; cell < UnitIndex::CELL_COUNT; cell++) {
+    cell_start[cell] += cell_start[cell - 1];
+  }
+  cell_start[UnitIndex::CELL_COUNT] = live_count;
+
+  // Filling each cell from its end leaves cell_start at the cell's start
+  for (int32_t slot = count - 1; slot >= 0; slot--) {
+    if (alive[slot] != 0) {
+      cell_slots[--cell_start[slot_cells[slot]]] = slot;
+    }
+  }
+}
+
+void ProxyMinionSystem::_fill_buffers() {
+  int32_t archetype_count = static_cast<int32_t>(archetypes.size());
+  fill_cursors.resize(archetype_count);
+  for (int32_t i = 0; i < archetype_count; i++) {
+    fill_cursors[i] = archetypes[i].population > 0
+                          ? archetypes[i].buffer.ptrw()
+                          : nullptr;
+  }
+
+  // Living proxies are packed into the front of their archetype's buffer
+  int32_t count = static_cast<int32_t>(xs.size());
+  for (int32_t slot = 0; slot < count; slot++) {
+    if (alive[slot] == 0) {
+      continue;
+    }
+
+    float* out = fill_cursors[archetype_of[slot]];
+    float s = facing_sin[slot];
+    float c = facing_cos[slot];
+    out[0] = c;
+    out[1] = 0.0f;
+    out[2] = s;
+    out[3] = xs[slot];
+    out[4] = 0.0f;
+    out[5] = 1.0f;
+    out[6] = 0.0f;
+    out[7] = ys[slot];
+    out[8] = -s;
+    out[9] = 0.0f;
+    out[10] = c;
+    out[11] = zs[slot];
+    fill_cursors[archetype_of[slot]] = out + FLOATS_PER_INSTANCE;
+  }
+
+  for (Archetype& archetype : archetypes) {
+    if (archetype.population == 0 && archetype.drawn == 0) {
+      continue;
+    }
+    archetype.multimesh->set_visible_instance_count(archetype.population);
+    if (archetype.population > 0) {
+      archetype.multimesh->set_buffer(archetype.buffer);
+    }
+    archetype.drawn = archetype.population;
+  }
+}
+
+int32_t ProxyMinionSystem::get_count() const {
+  return live_count;
+}
+
+int32_t ProxyMinionSystem::get_last_tick_deaths() const {
+  return last_tick_deaths;
+}
+
+Vector3 ProxyMinionSystem::get_proxy_position(int64_t handle) const {
+  Vector3 position;
+  get_position(handle, position);
+  return position;
+}
+
+float ProxyMinionSystem::apply_damage(int64_t handle,
+                                      float amount,
+                                      int damage_type) {
+  return submit_damage(handle, amount, static_cast<DamageType>(damage_type));
+}
+
+ProxyMinionSystem* ProxyMinionSystem::get_singleton() {
+  return singleton_instance;
+}
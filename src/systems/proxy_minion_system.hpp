@@ -0,0 +1,253 @@
+#ifndef GDEXTENSION_PROXY_MINION_SYSTEM_H
+#define GDEXTENSION_PROXY_MINION_SYSTEM_H
+
+#include <algorithm>
+#include <cstdint>
+#include <godot_cpp/classes/mesh.hpp>
+#include <godot_cpp/classes/multi_mesh.hpp>
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <vector>
+
+#include "../common/damage_type.hpp"
+#include "unit_index.hpp"
+
+using godot::Mesh;
+using godot::MultiMesh;
+using godot::Node;
+using godot::PackedFloat32Array;
+using godot::Ref;
+using godot::Vector3;
+
+namespace godot {
+class MultiMeshInstance3D;
+}  // namespace godot
+
+/// Node-less minions for crowds too large for full Units
+/// A proxy is a row in structure-of-arrays storage - position, march
+/// target, facing, health, faction - with no scene nodes at all. Each
+/// archetype (mesh, health, speed, resistances) is drawn by one
+/// MultiMeshInstance3D whose buffer is refilled once per tick, so 2,000
+/// proxies cost a handful of nodes instead of 20,000.
+///
+/// Proxies march in a straight line to their target and can be hit:
+/// - AbilityAPI area damage and find_nearest_proxy
+/// - SkillshotProjectile collision and ExplosionNode damage
+/// - Projectile::setup_proxy (homing on a proxy)
+/// - AttackComponent proxy orders (attack_proxy_requested relay)
+/// - InputManager right-clicks, through pick_ray
+///
+/// Spatial queries go through a private XZ grid with UnitIndex's cell layout,
+/// counting-sorted lazily on the first query after proxies spawn or march.
+/// Proxies are not Units and are not in UnitIndex itself: UnitQuery shapes,
+/// k-nearest, beams and chain lightning still pass through them.
+///
+/// Handles pack a slot and its generation, so a handle to a dead proxy never
+/// resolves to the proxy that reuses its slot. Hits are mitigated when
+/// submitted and applied at TickStage::PROXIES, after the unit damage phase.
+class ProxyMinionSystem : public Node {
+  GDCLASS(ProxyMinionSystem, Node)
+
+ public:
+  static constexpr int64_t INVALID_HANDLE = -1;
+
+ protected:
+  static void _bind_methods();
+
+  struct Archetype {
+    Ref<Mesh> mesh;
+    float max_health = 100.0f;
+    float speed = 3.0f;
+    float radius = 0.5f;  // Picking and projectile hit radius
+    float armor = 0.0f;
+    float magic_resist = 0.0f;
+
+    godot::MultiMeshInstance3D* instance = nullptr;
+    Ref<MultiMesh> multimesh;
+    int32_t capacity = 0;       // MultiMesh instance_count
+    int32_t population = 0;     // Living proxies of this archetype
+    int32_t drawn = 0;          // Visible instances at the last fill
+    PackedFloat32Array buffer;  // 12 floats per instance, reused every tick
+  };
+
+  std::vector<Archetype> archetypes;
+
+  // Proxy storage, one entry per slot (SoA)
+  std::vector<float> xs;
+  std::vector<float> ys;
+  std::vector<float> zs;
+  std::vector<float> target_xs;
+  std::vector<float> target_zs;
+  std::vector<float> facing_sin;  // Yaw of the last step, as sin/cos
+  std::vector<float> facing_cos;
+  std::vector<float> health;
+  std::vector<float> pending_damage;  // Mitigated hits of this tick
+  std::vector<uint32_t> faction_bits;
+  std::vector<int32_t> archetype_of;
+  std::vector<uint32_t> generations;
+  std::vector<uint8_t> alive;
+
+  std::vector<int32_t> free_slots;
+  std::vector<int32_t> damaged_slots;  // Slots with pending_damage > 0
+  std::vector<float*> fill_cursors;    // Per archetype, reused every tick
+  int32_t live_count = 0;
+  int32_t last_tick_deaths = 0;
+  float max_radius = 0.0f;  // Largest archetype radius
+
+  // Query grid: living slots counting-sorted by UnitIndex cell
+  mutable std::vector<int32_t> cell_start;  // CELL_COUNT + 1 offsets
+  mutable std::vector<int32_t> cell_slots;
+  mutable std::vector<int32_t> slot_cells;  // Cell of each slot at rebuild
+  mutable float grid_min_y = 0.0f;          // Ground height band of proxies
+  mutable float grid_max_y = 0.0f;
+  mutable bool grid_dirty = true;
+
+  int32_t _resolve(int64_t handle) const;
+  int32_t _allocate_slot();
+  void _kill_slot(int32_t slot);
+  void _grow_archetype(Archetype& archetype, int32_t capacity);
+  void _resolve_damage();
+  void _march(double delta);
+  void _fill_buffers();
+  void _rebuild_grid() const;
+
+  /// Visit the living slots in the grid cells overlapping the XZ box
+  template <typename Visitor>
+  void _visit_box(float min_x,
+                  float min_z,
+                  float max_x,
+                  float max_z,
+                  Visitor&& visit) const {
+    if (grid_dirty) {
+      _rebuild_grid();
+    }
+
+    int32_t min_cx = _grid_coord(min_x);
+    int32_t max_cx = _grid_coord(max_x);
+    int32_t min_cz = _grid_coord(min_z);
+    int32_t max_cz = _grid_coord(max_z);
+    for (int32_t cz = min_cz; cz <= max_cz; cz++) {
+      int32_t row = cz * UnitIndex::GRID_DIM;
+      int32_t end = cell_start[row + max_cx + 1];
+      for (int32_t i = cell_start[row + min_cx]; i < end; i++) {
+        int32_t slot = cell_slots[i];
+        if (alive[slot] != 0) {
+          visit(slot);
+        }
+      }
+    }
+  }
+
+  static int32_t _grid_coord(float world) {
+    // Clamp before the cast, so an unbounded range stays defined
+    constexpr float LIMIT = 2.0f * UnitIndex::HALF_EXTENT;
+    float clamped = std::clamp(world, -LIMIT, LIMIT);
+    int32_t coord = static_cast<int32_t>((clamped + UnitIndex::HALF_EXTENT) /
+                                         UnitIndex::CELL_SIZE);
+    return std::clamp(coord, 0, UnitIndex::GRID_DIM - 1);
+  }
+
+  static int64_t _make_handle(int32_t slot, uint32_t generation) {
+    return (static_cast<int64_t>(generation) << 32) |
+           static_cast<int64_t>(static_cast<uint32_t>(slot));
+  }
+
+ public:
+  ProxyMinionSystem();
+  ~ProxyMinionSystem();
+
+  void _ready() override;
+  void _physics_process(double delta) override;
+
+  /// Register an archetype; returns its id
+  int32_t add_archetype(const Ref<Mesh>& mesh,
+                        float max_health,
+                        float speed,
+                        float radius);
+  void set_archetype_resistances(int32_t archetype,
+                                 float armor,
+                                 float magic_resist);
+
+  /// Size the storage and the archetype's MultiMesh up front, so spawning up
+  /// to count proxies of it allocates nothing
+  void reserve(int32_t archetype, int32_t count);
+
+  int64_t spawn(int32_t archetype,
+                const Vector3& position,
+                int32_t faction_id,
+                const Vector3& target);
+  void kill(int64_t handle);
+  void set_target(int64_t handle, const Vector3& target);
+
+  bool is_alive(int64_t handle) const;
+  bool get_position(int64_t handle, Vector3& out_position) const;
+  uint32_t get_faction_bit(int64_t handle) const;  // 0 if gone
+  float get_radius(int64_t handle) const;
+  float get_health(int64_t handle) const;
+
+  /// Queue a hit (mitigated by the archetype's resistances)
+  /// Returns the damage after mitigation, 0 if the proxy is gone
+  float submit_damage(int64_t handle, float amount, DamageType type);
+
+  /// Queue a hit on every proxy of faction_mask within radius (XZ)
+  /// Returns the number of proxies hit
+  int32_t damage_radius(const Vector3& center,
+                        float radius,
+                        uint32_t faction_mask,
+                        float amount,
+                        DamageType type);
+
+  /// Nearest proxy of faction_mask within max_range (XZ), or INVALID_HANDLE
+  int64_t find_nearest(const Vector3& center,
+                       float max_range,
+                       uint32_t faction_mask) const;
+
+  /// First proxy of faction_mask whose bounding sphere the ray crosses
+  /// within max_distance (direction normalized), or INVALID_HANDLE
+  int64_t pick_ray(const Vector3& from,
+                   const Vector3& direction,
+                   float max_distance,
+                   uint32_t faction_mask) const;
+
+  /// Visit every living proxy of faction_mask within radius of center (XZ)
+  /// visit(int64_t handle, float distance_sq); don't spawn or kill inside
+  template <typename Visitor>
+  void visit_radius(const Vector3& center,
+                    float radius,
+                    uint32_t faction_mask,
+                    Visitor&& visit) const {
+    if (live_count == 0) {
+      return;
+    }
+
+    float radius_sq = radius * radius;
+    _visit_box(center.x - radius, center.z - radius, center.x + radius,
+               center.z + radius, [&](int32_t slot) {
+                 if ((faction_bits[slot] & faction_mask) == 0) {
+                   return;
+                 }
+                 float dx = xs[slot] - center.x;
+                 float dz = zs[slot] - center.z;
+                 float distance_sq = dx * dx + dz * dz;
+                 if (distance_sq <= radius_sq) {
+                   visit(_make_handle(slot, generations[slot]), distance_sq);
+                 }
+               });
+  }
+
+  int32_t get_count() const;
+  int32_t get_last_tick_deaths() const;
+
+  // Script wrappers (bindings can't take out-parameters)
+  Vector3 get_proxy_position(int64_t handle) const;
+  float apply_damage(int64_t handle, float amount, int damage_type);
+
+  /// Placed in the scene by whoever spawns proxies; never created on demand
+  static ProxyMinionSystem* get_singleton();
+
+ private:
+  static ProxyMinionSystem* singleton_instance;
+};
+
+#endif  // GDEXTENSION_PROXY_MINION_SYSTEM_H
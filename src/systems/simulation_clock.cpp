@@ -0,0 +1,84 @@
+#include "simulation_clock.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <godot_cpp/classes/display_server.hpp>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+
+#include "../core/game_settings.hpp"
+#include "../debug/debug_macros.hpp"
+
+using godot::DisplayServer;
+using godot::Engine;
+using godot::OS;
+using godot::SceneTree;
+
+uint64_t SimulationClock::start_physics_frame = 0;
+bool SimulationClock::interpolating = false;
+
+void SimulationClock::configure(SceneTree* tree) {
+  bool server = is_server();
+  int32_t rate = server ? GameSettings::get_simulation_server_tick_rate()
+                        : GameSettings::get_simulation_tick_rate();
+  rate = std::clamp(rate, MIN_TICK_RATE, MAX_TICK_RATE);
+
+  Engine* engine = Engine::get_singleton();
+  engine->set_physics_ticks_per_second(rate);
+
+  // Servers never render, so interpolation would only cost time
+  interpolating =
+      !server && GameSettings::get_simulation_interpolate_rendering();
+  if (tree != nullptr) {
+    tree->set_physics_interpolation_enabled(interpolating);
+  }
+
+  start_physics_frame = engine->get_physics_frames();
+
+  DBG_INFO("SimulationClock",
+           "Simulation running at " + godot::String::num_int64(rate) +
+               " Hz (" + (server ? "server" : "client") + ", interpolation " +
+               (interpolating ? "on" : "off") + ")");
+}
+
+bool SimulationClock::is_server() {
+  if (OS::get_singleton()->has_feature("dedicated_server")) {
+    return true;
+  }
+
+  DisplayServer* display = DisplayServer::get_singleton();
+  return display != nullptr && display->get_name() == "headless";
+}
+
+bool SimulationClock::is_interpolating() {
+  return interpolating;
+}
+
+int32_t SimulationClock::get_tick_rate() {
+  return Engine::get_singleton()->get_physics_ticks_per_second();
+}
+
+double SimulationClock::get_fixed_delta() {
+  return 1.0 / static_cast<double>(std::max(get_tick_rate(), MIN_TICK_RATE));
+}
+
+uint64_t SimulationClock::get_tick() {
+  return Engine::get_singleton()->get_physics_frames() - start_physics_frame;
+}
+
+int64_t SimulationClock::seconds_to_ticks(double seconds) {
+  if (seconds <= 0.0) {
+    return 0;
+  }
+
+  // Small epsilon so exact multiples of the tick length don't round up
+  double ticks = seconds * static_cast<double>(get_tick_rate());
+  return std::max<int64_t>(1, static_cast<int64_t>(std::ceil(ticks - 1e-6)));
+}
+
+double SimulationClock::get_interpolation_fraction() {
+  return interpolating
+             ? Engine::get_singleton()->get_physics_interpolation_fraction()
+             : 0.0;
+}
@@ -0,0 +1,51 @@
+#ifndef GDEXTENSION_SIMULATION_CLOCK_H
+#define GDEXTENSION_SIMULATION_CLOCK_H
+
+#include <cstdint>
+
+namespace godot {
+class SceneTree;
+}  // namespace godot
+
+/// Fixed-rate simulation clock
+/// The simulation runs on Godot's physics tick, which is already a fixed
+/// timestep decoupled from rendering. This class owns its rate and the
+/// render interpolation policy so gameplay code never depends on frame rate:
+///
+/// - Clients tick at gameplay/simulation/tick_rate and render Unit and
+///   projectile transforms interpolated between ticks (physics interpolation)
+/// - Headless/dedicated servers tick at gameplay/simulation/server_tick_rate
+///   (e.g. 20-30 Hz) and skip interpolation entirely
+///
+/// Gameplay code must advance timers by the physics delta (never by counting
+/// frames) and reset interpolation after teleporting a node.
+class SimulationClock {
+ public:
+  /// Apply the configured tick rate and interpolation policy to the engine
+  /// Called once when a match starts; safe to call again after settings change
+  static void configure(godot::SceneTree* tree);
+
+  static bool is_server();
+  static bool is_interpolating();
+
+  static int32_t get_tick_rate();
+  static double get_fixed_delta();
+
+  /// Simulation ticks elapsed since configure()
+  static uint64_t get_tick();
+
+  /// Convert a duration to whole ticks (rounded up, at least 1 for > 0)
+  static int64_t seconds_to_ticks(double seconds);
+
+  /// Render-time fraction [0, 1) between the previous and current tick
+  static double get_interpolation_fraction();
+
+ private:
+  static constexpr int32_t MIN_TICK_RATE = 1;
+  static constexpr int32_t MAX_TICK_RATE = 240;
+
+  static uint64_t start_physics_frame;
+  static bool interpolating;
+};
+
+#endif  // GDEXTENSION_SIMULATION_CLOCK_H
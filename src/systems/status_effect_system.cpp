@@ -0,0 +1,382 @@
+#include "status_effect_system.hpp"
+
+#include <algorithm>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/object.hpp>
+
+#include "../common/crowd_control.hpp"
+#include "../core/unit.hpp"
+#include "../debug/debug_macros.hpp"
+#include "simulation_clock.hpp"
+#include "tick_stages.hpp"
+
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::Engine;
+using godot::Object;
+using godot::ObjectDB;
+
+StatusEffectSystem* StatusEffectSystem::singleton_instance = nullptr;
+
+StatusEffectSystem::StatusEffectSystem() {
+  singleton_instance = this;
+}
+
+StatusEffectSystem::~StatusEffectSystem() {
+  if (singleton_instance == this) {
+    singleton_instance = nullptr;
+  }
+}
+
+void StatusEffectSystem::_bind_methods() {
+  ClassDB::bind_method(D_METHOD("get_active_effect_count"),
+                       &StatusEffectSystem::get_active_effect_count);
+  ClassDB::bind_method(D_METHOD("get_affected_unit_count"),
+                       &StatusEffectSystem::get_affected_unit_count);
+}
+
+void StatusEffectSystem::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  singleton_instance = this;
+  set_physics_process_priority(TickStage::STATUS);
+  set_physics_process(true);
+}
+
+void StatusEffectSystem::_physics_process(double delta) {
+  if (expiry_heap.empty()) {
+    return;
+  }
+
+  uint64_t tick = SimulationClock::get_tick();
+
+  // Knockbacks move their unit every tick until they expire
+  if (knockbacks.active_count > 0) {
+    _advance_knockbacks(tick, delta);
+  }
+
+  // Expire everything that is due; stale entries are skipped by generation
+  while (!expiry_heap.empty() && expiry_heap.front().tick <= tick) {
+    std::pop_heap(expiry_heap.begin(), expiry_heap.end(), _later_expiry);
+    Expiry expiry = expiry_heap.back();
+    expiry_heap.pop_back();
+    _expire(expiry);
+  }
+
+  // Re-resolve each touched unit once, however many of its effects ended
+  for (int32_t status : dirty_statuses) {
+    _resolve(status);
+  }
+  dirty_statuses.clear();
+}
+
+void StatusEffectSystem::apply_slow(Unit* target,
+                                    float slow_percent,
+                                    double duration) {
+  if (duration <= 0.0 || slow_percent <= 0.0f) {
+    return;
+  }
+
+  int32_t status = _acquire_status(target);
+  if (status < 0) {
+    return;
+  }
+
+  int32_t slot = slows.acquire();
+  SlowEffect& effect = slows.effects[slot];
+  effect.status = status;
+  effect.percent = std::min(slow_percent, 1.0f);
+  statuses[status].slow_slots.push_back(slot);
+
+  _schedule_expiry(EffectType::SLOW, slot, effect.generation,
+                   _ticks_from_now(duration));
+  _resolve(status);
+}
+
+void StatusEffectSystem::apply_stun(Unit* target, double duration) {
+  if (duration <= 0.0) {
+    return;
+  }
+
+  int32_t status = _acquire_status(target);
+  if (status < 0) {
+    return;
+  }
+
+  int32_t slot = stuns.acquire();
+  StunEffect& effect = stuns.effects[slot];
+  effect.status = status;
+  statuses[status].stun_count++;
+
+  _schedule_expiry(EffectType::STUN, slot, effect.generation,
+                   _ticks_from_now(duration));
+  _resolve(status);
+}
+
+void StatusEffectSystem::apply_knockback(Unit* target,
+                                         const Vector3& direction,
+                                         float force) {
+  Vector3 horizontal(direction.x, 0.0f, direction.z);
+  if (force <= 0.0f || horizontal.is_zero_approx()) {
+    return;
+  }
+
+  int32_t status = _acquire_status(target);
+  if (status < 0) {
+    return;
+  }
+
+  int32_t slot = knockbacks.acquire();
+  KnockbackEffect& effect = knockbacks.effects[slot];
+  effect.status = status;
+  effect.initial_velocity = horizontal.normalized() * force;
+  effect.start_tick = SimulationClock::get_tick();
+  effect.end_tick = _ticks_from_now(KNOCKBACK_DURATION);
+  statuses[status].knockback_count++;
+
+  _schedule_expiry(EffectType::KNOCKBACK, slot, effect.generation,
+                   effect.end_tick);
+  _resolve(status);
+}
+
+void StatusEffectSystem::clear_effects(Unit* target) {
+  if (target == nullptr) {
+    return;
+  }
+
+  auto found = status_by_unit.find(target->get_instance_id());
+  if (found == status_by_unit.end()) {
+    return;
+  }
+
+  int32_t index = found->second;
+  UnitStatus& status = statuses[index];
+  for (int32_t slot : status.slow_slots) {
+    slows.release(slot);
+  }
+  status.slow_slots.clear();
+
+  // Stuns and knockbacks aren't listed per unit; this only runs on respawn
+  for (size_t slot = 0; slot < stuns.effects.size(); slot++) {
+    if (stuns.effects[slot].status == index) {
+      stuns.release(static_cast<int32_t>(slot));
+    }
+  }
+  for (size_t slot = 0; slot < knockbacks.effects.size(); slot++) {
+    if (knockbacks.effects[slot].status == index) {
+      knockbacks.release(static_cast<int32_t>(slot));
+    }
+  }
+  status.stun_count = 0;
+  status.knockback_count = 0;
+
+  // Released slots' expiries are stale by generation; resolving clears the
+  // crowd-control word, removes the slow modifier and recycles the record
+  _resolve(index);
+}
+
+void StatusEffectSystem::_advance_knockbacks(uint64_t tick, double delta) {
+  for (KnockbackEffect& effect : knockbacks.effects) {
+    if (effect.status < 0 || tick >= effect.end_tick) {
+      continue;
+    }
+
+    Unit* unit = Object::cast_to<Unit>(
+        ObjectDB::get_instance(statuses[effect.status].unit_id));
+    if (unit == nullptr || !unit->is_inside_tree()) {
+      continue;
+    }
+
+    // Linear deceleration: full speed at start_tick, zero at end_tick
+    double span = static_cast<double>(effect.end_tick - effect.start_tick);
+    double remaining = static_cast<double>(effect.end_tick - tick) / span;
+    float step = static_cast<float>(remaining * delta);
+    unit->move_and_collide(effect.initial_velocity * step);
+  }
+}
+
+void StatusEffectSystem::_expire(const Expiry& expiry) {
+  int32_t status = -1;
+  switch (expiry.type) {
+    case EffectType::SLOW: {
+      SlowEffect& effect = slows.effects[expiry.slot];
+      if (effect.status < 0 || effect.generation != expiry.generation) {
+        return;
+      }
+      status = effect.status;
+      std::vector<int32_t>& active = statuses[status].slow_slots;
+      auto found = std::find(active.begin(), active.end(), expiry.slot);
+      if (found != active.end()) {
+        *found = active.back();
+        active.pop_back();
+      }
+      slows.release(expiry.slot);
+      break;
+    }
+    case EffectType::STUN: {
+      StunEffect& effect = stuns.effects[expiry.slot];
+      if (effect.status < 0 || effect.generation != expiry.generation) {
+        return;
+      }
+      status = effect.status;
+      statuses[status].stun_count--;
+      stuns.release(expiry.slot);
+      break;
+    }
+    case EffectType::KNOCKBACK: {
+      KnockbackEffect& effect = knockbacks.effects[expiry.slot];
+      if (effect.status < 0 || effect.generation != expiry.generation) {
+        return;
+      }
+      status = effect.status;
+      statuses[status].knockback_count--;
+      knockbacks.release(expiry.slot);
+      break;
+    }
+  }
+
+  _mark_dirty(status);
+}
+
+void StatusEffectSystem::_mark_dirty(int32_t status) {
+  if (status < 0 || statuses[status].dirty) {
+    return;
+  }
+
+  statuses[status].dirty = true;
+  dirty_statuses.push_back(status);
+}
+
+void StatusEffectSystem::_resolve(int32_t status_index) {
+  UnitStatus& status = statuses[status_index];
+  status.dirty = false;
+
+  uint32_t state = CrowdControl::NONE;
+  if (status.stun_count > 0) {
+    state |= CrowdControl::STUNNED;
+  }
+  if (status.knockback_count > 0) {
+    state |= CrowdControl::DISPLACED;
+  }
+
+  // Slows don't stack - only the strongest one applies
+  float strongest_slow = 0.0f;
+  for (int32_t slot : status.slow_slots) {
+    strongest_slow = std::max(strongest_slow, slows.effects[slot].percent);
+  }
+  if (strongest_slow > 0.0f) {
+    state |= CrowdControl::SLOWED;
+  }
+
+  Unit* unit = Object::cast_to<Unit>(ObjectDB::get_instance(status.unit_id));
+  if (unit != nullptr) {
+    unit->set_crowd_control(state);
+
+    // Swap the move speed modifier only when the strongest slow changed
+    if (strongest_slow != status.applied_slow) {
+      unit->remove_stat_modifier(status.slow_modifier);
+      status.slow_modifier = StatBlock::INVALID_MODIFIER;
+      if (strongest_slow > 0.0f) {
+        status.slow_modifier = unit->add_stat_modifier(
+            Stat::MOVE_SPEED, StatModifierType::MULTIPLICATIVE,
+            -strongest_slow);
+      }
+      status.applied_slow = strongest_slow;
+    }
+  }
+
+  // Nothing left on this unit - recycle the record
+  if (state == CrowdControl::NONE) {
+    status_by_unit.erase(status.unit_id);
+    status.unit_id = 0;
+    free_statuses.push_back(status_index);
+  }
+}
+
+int32_t StatusEffectSystem::_acquire_status(Unit* unit) {
+  if (unit == nullptr || !unit->is_inside_tree()) {
+    return -1;
+  }
+
+  uint64_t unit_id = unit->get_instance_id();
+  auto found = status_by_unit.find(unit_id);
+  if (found != status_by_unit.end()) {
+    return found->second;
+  }
+
+  int32_t status = -1;
+  if (!free_statuses.empty()) {
+    status = free_statuses.back();
+    free_statuses.pop_back();
+  } else {
+    status = static_cast<int32_t>(statuses.size());
+    statuses.emplace_back();
+  }
+
+  UnitStatus& record = statuses[status];
+  record.unit_id = unit_id;
+  record.stun_count = 0;
+  record.knockback_count = 0;
+  record.slow_slots.clear();
+  record.applied_slow = 0.0f;
+  record.slow_modifier = StatBlock::INVALID_MODIFIER;
+  record.dirty = false;
+  status_by_unit[unit_id] = status;
+  return status;
+}
+
+void StatusEffectSystem::_schedule_expiry(EffectType type,
+                                          int32_t slot,
+                                          uint32_t generation,
+                                          uint64_t tick) {
+  Expiry expiry;
+  expiry.tick = tick;
+  expiry.type = type;
+  expiry.slot = slot;
+  expiry.generation = generation;
+  expiry_heap.push_back(expiry);
+  std::push_heap(expiry_heap.begin(), expiry_heap.end(), _later_expiry);
+}
+
+uint64_t StatusEffectSystem::_ticks_from_now(double seconds) {
+  return SimulationClock::get_tick() +
+         static_cast<uint64_t>(SimulationClock::seconds_to_ticks(seconds));
+}
+
+bool StatusEffectSystem::_later_expiry(const Expiry& a, const Expiry& b) {
+  // std heap functions build a max-heap; invert so the earliest tick is on top
+  return a.tick > b.tick;
+}
+
+int32_t StatusEffectSystem::get_active_effect_count() const {
+  return slows.active_count + stuns.active_count + knockbacks.active_count;
+}
+
+int32_t StatusEffectSystem::get_affected_unit_count() const {
+  return static_cast<int32_t>(status_by_unit.size());
+}
+
+StatusEffectSystem* StatusEffectSystem::get_singleton() {
+  return singleton_instance;
+}
+
+StatusEffectSystem* StatusEffectSystem::ensure_singleton(Node* context) {
+  if (singleton_instance != nullptr) {
+    return singleton_instance;
+  }
+
+  if (context == nullptr || !context->is_inside_tree()) {
+    return nullptr;
+  }
+
+  StatusEffectSystem* system = memnew(StatusEffectSystem);
+  system->set_name("StatusEffectSystem");
+  context->get_tree()->get_root()->call_deferred("add_child", system);
+  DBG_INFO("StatusEffectSystem", "Created status effect system");
+  return singleton_instance;
+}
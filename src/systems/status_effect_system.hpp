@@ -0,0 +1,160 @@
+#ifndef GDEXTENSION_STATUS_EFFECT_SYSTEM_H
+#define GDEXTENSION_STATUS_EFFECT_SYSTEM_H
+
+#include <cstdint>
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <unordered_map>
+#include <vector>
+
+#include "../core/stat_block.hpp"
+
+using godot::Node;
+using godot::Vector3;
+
+class Unit;
+
+/// Timed status effects (slow, stun, knockback) for every unit
+/// Effects are plain records in one pooled array per effect type - there are
+/// no per-effect nodes or timers. Each effect's end tick is pushed on a
+/// min-heap owned by the system, so a tick only touches effects that actually
+/// expire (plus active knockbacks, which move their unit).
+///
+/// Stacking is resolved once per change (apply or expiry) into the unit's
+/// crowd-control word (see common/crowd_control.hpp):
+/// - Stuns and knockbacks: active while any instance is active
+/// - Slows: the strongest active slow wins, they don't add up; it is applied
+///   as a single multiplicative MOVE_SPEED modifier on the unit's StatBlock
+///
+/// MovementComponent, AttackComponent and AbilityComponent read that word
+/// (and the cached move speed) from the Unit and never query this system.
+class StatusEffectSystem : public Node {
+  GDCLASS(StatusEffectSystem, Node)
+
+ public:
+  enum class EffectType : uint8_t { SLOW, STUN, KNOCKBACK };
+
+ protected:
+  static void _bind_methods();
+
+  /// Per-unit aggregate, alive while the unit has at least one effect
+  struct UnitStatus {
+    uint64_t unit_id = 0;  // 0 = free record
+    int32_t stun_count = 0;
+    int32_t knockback_count = 0;
+    std::vector<int32_t> slow_slots;  // Active slows, for strongest-wins
+    float applied_slow = 0.0f;        // Slow behind slow_modifier
+    StatBlock::ModifierHandle slow_modifier = StatBlock::INVALID_MODIFIER;
+    bool dirty = false;
+  };
+
+  struct SlowEffect {
+    int32_t status = -1;  // -1 = free slot
+    uint32_t generation = 0;
+    float percent = 0.0f;
+  };
+
+  struct StunEffect {
+    int32_t status = -1;
+    uint32_t generation = 0;
+  };
+
+  struct KnockbackEffect {
+    int32_t status = -1;
+    uint32_t generation = 0;
+    Vector3 initial_velocity;  // Decays linearly to zero at end_tick
+    uint64_t start_tick = 0;
+    uint64_t end_tick = 0;
+  };
+
+  template <typename Effect>
+  struct EffectPool {
+    std::vector<Effect> effects;
+    std::vector<int32_t> free_slots;
+    int32_t active_count = 0;
+
+    int32_t acquire() {
+      int32_t slot = -1;
+      if (!free_slots.empty()) {
+        slot = free_slots.back();
+        free_slots.pop_back();
+      } else {
+        slot = static_cast<int32_t>(effects.size());
+        effects.emplace_back();
+      }
+      active_count++;
+      return slot;
+    }
+
+    void release(int32_t slot) {
+      effects[slot].status = -1;
+      effects[slot].generation++;  // Invalidates the pending expiry
+      free_slots.push_back(slot);
+      active_count--;
+    }
+  };
+
+  struct Expiry {
+    uint64_t tick = 0;
+    EffectType type = EffectType::SLOW;
+    int32_t slot = -1;
+    uint32_t generation = 0;
+  };
+
+  EffectPool<SlowEffect> slows;
+  EffectPool<StunEffect> stuns;
+  EffectPool<KnockbackEffect> knockbacks;
+
+  std::vector<UnitStatus> statuses;
+  std::vector<int32_t> free_statuses;
+  std::unordered_map<uint64_t, int32_t> status_by_unit;
+  std::vector<int32_t> dirty_statuses;  // Resolved at the end of the tick
+
+  std::vector<Expiry> expiry_heap;  // Min-heap on tick
+
+  int32_t _acquire_status(Unit* unit);
+  void _schedule_expiry(EffectType type,
+                        int32_t slot,
+                        uint32_t generation,
+                        uint64_t tick);
+  void _expire(const Expiry& expiry);
+  void _mark_dirty(int32_t status);
+  void _resolve(int32_t status);
+  void _advance_knockbacks(uint64_t tick, double delta);
+  static uint64_t _ticks_from_now(double seconds);
+  static bool _later_expiry(const Expiry& a, const Expiry& b);
+
+ public:
+  // Knockbacks push their unit for this long, decelerating to a stop
+  static constexpr double KNOCKBACK_DURATION = 0.25;
+
+  StatusEffectSystem();
+  ~StatusEffectSystem();
+
+  void _ready() override;
+  void _physics_process(double delta) override;
+
+  /// Reduce movement speed by slow_percent (0-1) for duration seconds
+  void apply_slow(Unit* target, float slow_percent, double duration);
+
+  /// Block movement, attacks and casting for duration seconds
+  void apply_stun(Unit* target, double duration);
+
+  /// Push the unit along direction (XZ), starting at force m/s
+  void apply_knockback(Unit* target, const Vector3& direction, float force);
+
+  /// Drop every effect on the unit and its move speed modifier at once
+  /// (pooled / respawned units must not carry a previous life's effects)
+  void clear_effects(Unit* target);
+
+  int32_t get_active_effect_count() const;
+  int32_t get_affected_unit_count() const;
+
+  static StatusEffectSystem* get_singleton();
+  static StatusEffectSystem* ensure_singleton(Node* context);
+
+ private:
+  static StatusEffectSystem* singleton_instance;
+};
+
+#endif  // GDEXTENSION_STATUS_EFFECT_SYSTEM_H
@@ -0,0 +1,222 @@
+#include "target_acquisition.hpp"
+
+#include <algorithm>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/property_info.hpp>
+#include <limits>
+
+#include "../common/allegiance.hpp"
+#include "../components/combat/attack_component.hpp"
+#include "../core/faction_table.hpp"
+#include "../core/unit.hpp"
+#include "../debug/debug_macros.hpp"
+#include "tick_stages.hpp"
+#include "unit_index.hpp"
+
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::Engine;
+using godot::PropertyInfo;
+using godot::Variant;
+
+TargetAcquisition* TargetAcquisition::singleton_instance = nullptr;
+
+TargetAcquisition::TargetAcquisition() {
+  singleton_instance = this;
+}
+
+TargetAcquisition::~TargetAcquisition() {
+  if (singleton_instance == this) {
+    singleton_instance = nullptr;
+  }
+}
+
+void TargetAcquisition::_bind_methods() {
+  ClassDB::bind_method(D_METHOD("set_scans_per_tick", "count"),
+                       &TargetAcquisition::set_scans_per_tick);
+  ClassDB::bind_method(D_METHOD("get_scans_per_tick"),
+                       &TargetAcquisition::get_scans_per_tick);
+  ADD_PROPERTY(PropertyInfo(Variant::INT, "scans_per_tick"),
+               "set_scans_per_tick", "get_scans_per_tick");
+
+  ClassDB::bind_method(D_METHOD("get_seeker_count"),
+                       &TargetAcquisition::get_seeker_count);
+  ClassDB::bind_method(D_METHOD("get_last_tick_scans"),
+                       &TargetAcquisition::get_last_tick_scans);
+}
+
+void TargetAcquisition::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  singleton_instance = this;
+  set_physics_process_priority(TickStage::SENSING);
+  set_physics_process(true);
+}
+
+void TargetAcquisition::_physics_process(double delta) {
+  last_tick_scans = 0;
+  int32_t count = static_cast<int32_t>(seekers.size());
+  if (count == 0) {
+    return;
+  }
+
+  // Visit at most scans_per_tick seekers, continuing where the last tick
+  // stopped, so the work per tick is bounded no matter how many are idle
+  int32_t budget = std::min(scans_per_tick, count);
+  for (int32_t visited = 0; visited < budget; visited++) {
+    if (cursor >= count) {
+      cursor = 0;
+    }
+    Seeker& seeker = seekers[cursor++];
+    AttackComponent* component = seeker.component;
+
+    if (!component->wants_auto_target()) {
+      seeker.has_cached_miss = false;
+      continue;
+    }
+
+    // Sleeping units are woken by ActivitySystem once enemies come close
+    Unit* self = component->get_unit();
+    if (self == nullptr || !self->is_inside_tree() || self->is_asleep()) {
+      continue;
+    }
+
+    // Nothing around us changed since the last empty scan
+    uint64_t signature = UnitIndex::get_area_signature(
+        self->get_global_position(), component->get_auto_attack_range());
+    if (seeker.has_cached_miss && seeker.signature == signature) {
+      continue;
+    }
+
+    last_tick_scans++;
+    Unit* target = _select_target(component, self);
+    if (target == nullptr) {
+      seeker.signature = signature;
+      seeker.has_cached_miss = true;
+      continue;
+    }
+
+    seeker.has_cached_miss = false;
+    component->acquire_target(target);
+  }
+}
+
+Unit* TargetAcquisition::_select_target(AttackComponent* component,
+                                        Unit* self) const {
+  Vector3 origin = self->get_global_position();
+  float range = component->get_auto_attack_range();
+  uint32_t enemy_factions =
+      FactionTable::get_faction_mask(self->get_faction_id(), Allegiance::ENEMY);
+  TargetPriority priority = component->get_target_priority_enum();
+
+  // Retaliate first if the last attacker is a valid enemy in range
+  if (priority == TargetPriority::LAST_ATTACKER) {
+    Unit* attacker = component->get_last_attacker();
+    if (attacker != nullptr && attacker->is_inside_tree() &&
+        FactionTable::are_enemies(self->get_faction_id(),
+                                  attacker->get_faction_id()) &&
+        UnitIndex::is_alive(attacker) &&
+        origin.distance_squared_to(attacker->get_global_position()) <=
+            range * range) {
+      return attacker;
+    }
+  }
+
+  Unit* best = nullptr;
+  float best_distance_sq = std::numeric_limits<float>::max();
+  float best_health = std::numeric_limits<float>::max();
+
+  // Only enemy faction buckets are visited
+  UnitIndex::visit_radius(
+      origin, range, enemy_factions,
+      [&](Unit* unit, float distance_sq, int32_t slot) {
+        if (unit == self) {
+          return;
+        }
+
+        if (priority == TargetPriority::LOWEST_HEALTH) {
+          float health = UnitIndex::get_health(slot);
+          if (health < best_health ||
+              (health == best_health && distance_sq < best_distance_sq)) {
+            best = unit;
+            best_health = health;
+            best_distance_sq = distance_sq;
+          }
+          return;
+        }
+
+        if (distance_sq < best_distance_sq) {
+          best = unit;
+          best_distance_sq = distance_sq;
+        }
+      });
+
+  return best;
+}
+
+void TargetAcquisition::add_seeker(AttackComponent* component) {
+  if (component == nullptr) {
+    return;
+  }
+
+  for (const Seeker& seeker : seekers) {
+    if (seeker.component == component) {
+      return;
+    }
+  }
+
+  Seeker seeker;
+  seeker.component = component;
+  seekers.push_back(seeker);
+}
+
+void TargetAcquisition::remove_seeker(AttackComponent* component) {
+  for (size_t i = 0; i < seekers.size(); i++) {
+    if (seekers[i].component == component) {
+      seekers[i] = seekers.back();
+      seekers.pop_back();
+      return;
+    }
+  }
+}
+
+void TargetAcquisition::set_scans_per_tick(int32_t count) {
+  scans_per_tick = std::max(1, count);
+}
+
+int32_t TargetAcquisition::get_scans_per_tick() const {
+  return scans_per_tick;
+}
+
+int32_t TargetAcquisition::get_seeker_count() const {
+  return static_cast<int32_t>(seekers.size());
+}
+
+int32_t TargetAcquisition::get_last_tick_scans() const {
+  return last_tick_scans;
+}
+
+TargetAcquisition* TargetAcquisition::get_singleton() {
+  return singleton_instance;
+}
+
+TargetAcquisition* TargetAcquisition::ensure_singleton(Node* context) {
+  if (singleton_instance != nullptr) {
+    return singleton_instance;
+  }
+
+  if (context == nullptr || !context->is_inside_tree()) {
+    return nullptr;
+  }
+
+  TargetAcquisition* acquisition = memnew(TargetAcquisition);
+  acquisition->set_name("TargetAcquisition");
+  context->get_tree()->get_root()->call_deferred("add_child", acquisition);
+  DBG_INFO("TargetAcquisition", "Created target acquisition service");
+  return singleton_instance;
+}
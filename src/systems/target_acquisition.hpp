@@ -0,0 +1,67 @@
+#ifndef GDEXTENSION_TARGET_ACQUISITION_H
+#define GDEXTENSION_TARGET_ACQUISITION_H
+
+#include <cstdint>
+#include <godot_cpp/classes/node.hpp>
+#include <vector>
+
+using godot::Node;
+
+class AttackComponent;
+class Unit;
+
+/// Auto-attack target acquisition service
+/// AttackComponents with auto_acquire_targets enabled register as seekers.
+/// Each tick a bounded number of seekers (scans_per_tick, round-robin) look
+/// for the best enemy inside their auto_attack_range using the UnitIndex
+/// grid, so hundreds of idle minions/towers cost a fixed amount per tick.
+///
+/// Caching: an empty scan result is kept until the UnitIndex area signature
+/// around the seeker changes (a unit entered, left or moved), so idle units
+/// with nobody nearby do no distance math at all.
+///
+/// A found target is issued as a regular attack order (attack_requested
+/// relay), exactly as if a player had clicked it.
+class TargetAcquisition : public Node {
+  GDCLASS(TargetAcquisition, Node)
+
+ protected:
+  static void _bind_methods();
+
+  struct Seeker {
+    AttackComponent* component = nullptr;
+    uint64_t signature = 0;  // Area signature of the last empty scan
+    bool has_cached_miss = false;
+  };
+
+  std::vector<Seeker> seekers;
+  int32_t cursor = 0;
+  int32_t scans_per_tick = 16;
+  int32_t last_tick_scans = 0;
+
+  Unit* _select_target(AttackComponent* component, Unit* self) const;
+
+ public:
+  TargetAcquisition();
+  ~TargetAcquisition();
+
+  void _ready() override;
+  void _physics_process(double delta) override;
+
+  void add_seeker(AttackComponent* component);
+  void remove_seeker(AttackComponent* component);
+
+  void set_scans_per_tick(int32_t count);
+  int32_t get_scans_per_tick() const;
+
+  int32_t get_seeker_count() const;
+  int32_t get_last_tick_scans() const;
+
+  static TargetAcquisition* get_singleton();
+  static TargetAcquisition* ensure_singleton(Node* context);
+
+ private:
+  static TargetAcquisition* singleton_instance;
+};
+
+#endif  // GDEXTENSION_TARGET_ACQUISITION_H
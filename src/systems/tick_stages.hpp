@@ -0,0 +1,23 @@
+#ifndef GDEXTENSION_TICK_STAGES_H
+#define GDEXTENSION_TICK_STAGES_H
+
+#include <cstdint>
+
+// Physics process priorities for world-level systems
+// Godot runs lower priorities first; components stay at the default (0) and
+// systems that consume what components produced during the tick run later.
+namespace TickStage {
+constexpr int32_t CLOCK = -300;       // Simulation time for the HUD
+constexpr int32_t ACTIVITY = -200;    // Sleep/wake idle units before gameplay
+constexpr int32_t SENSING = -100;     // Target acquisition (orders for tick)
+constexpr int32_t STATUS = -50;       // Effect expiry, knockback, CC state
+constexpr int32_t SIMULATION = 0;
+constexpr int32_t CHANNELS = 50;      // Channel range checks and ticks
+constexpr int32_t PROJECTILES = 100;  // Scheduled projectile flights and hits
+constexpr int32_t ZONES = 150;        // Ground zone occupancy and tick effects
+constexpr int32_t DAMAGE = 200;       // Resolve the tick's queued damage
+constexpr int32_t PROXIES = 250;      // Proxy minion hits, marching, MultiMesh
+constexpr int32_t WRITEBACK = 1000;   // Always last: pushes results to scene
+}  // namespace TickStage
+
+#endif  // GDEXTENSION_TICK_STAGES_H
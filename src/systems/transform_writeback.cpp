@@ -0,0 +1,208 @@
+#include "transform_writeback.hpp"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/node3d.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/basis.hpp>
+
+#include "../debug/debug_macros.hpp"
+#include "tick_stages.hpp"
+
+using godot::Basis;
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::Engine;
+using godot::Node3D;
+
+TransformWriteback* TransformWriteback::singleton_instance = nullptr;
+
+TransformWriteback::TransformWriteback() {
+  singleton_instance = this;
+}
+
+TransformWriteback::~TransformWriteback() {
+  if (singleton_instance == this) {
+    singleton_instance = nullptr;
+  }
+}
+
+void TransformWriteback::_bind_methods() {
+  ClassDB::bind_method(D_METHOD("flush"), &TransformWriteback::flush);
+  ClassDB::bind_method(D_METHOD("get_registered_count"),
+                       &TransformWriteback::get_registered_count);
+  ClassDB::bind_method(D_METHOD("get_last_flush_count"),
+                       &TransformWriteback::get_last_flush_count);
+}
+
+void TransformWriteback::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  singleton_instance = this;
+  set_physics_process_priority(TickStage::WRITEBACK);
+  set_physics_process(true);
+}
+
+void TransformWriteback::_physics_process(double delta) {
+  flush();
+}
+
+int32_t TransformWriteback::acquire_slot(Node3D* node) {
+  if (node == nullptr) {
+    return INVALID_SLOT;
+  }
+
+  int32_t slot = INVALID_SLOT;
+  if (!free_slots.empty()) {
+    slot = free_slots.back();
+    free_slots.pop_back();
+  } else {
+    slot = static_cast<int32_t>(nodes.size());
+    nodes.push_back(nullptr);
+    positions.push_back(Vector3());
+    facings.push_back(Vector3(0, 0, -1));
+    dirty_flags.push_back(DIRTY_NONE);
+  }
+
+  nodes[slot] = node;
+  positions[slot] =
+      node->is_inside_tree() ? node->get_global_position() : Vector3();
+  facings[slot] = Vector3(0, 0, -1);
+  dirty_flags[slot] = DIRTY_NONE;
+  registered_count++;
+  return slot;
+}
+
+void TransformWriteback::release_slot(int32_t slot, const Node3D* node) {
+  if (slot < 0 || slot >= static_cast<int32_t>(nodes.size())) {
+    return;
+  }
+
+  // Guard against stale slots handed out by a previous writeback instance
+  if (nodes[slot] != node) {
+    return;
+  }
+
+  // Any pending entry in dirty_slots is skipped because flags are cleared
+  nodes[slot] = nullptr;
+  dirty_flags[slot] = DIRTY_NONE;
+  free_slots.push_back(slot);
+  registered_count--;
+}
+
+void TransformWriteback::write_position(int32_t slot,
+                                        const Vector3& global_position) {
+  if (slot < 0 || slot >= static_cast<int32_t>(nodes.size())) {
+    return;
+  }
+
+  positions[slot] = global_position;
+  _mark_dirty(slot, DIRTY_POSITION);
+}
+
+void TransformWriteback::write_facing(int32_t slot,
+                                      const Vector3& horizontal_direction) {
+  if (slot < 0 || slot >= static_cast<int32_t>(nodes.size())) {
+    return;
+  }
+
+  facings[slot] = horizontal_direction;
+  _mark_dirty(slot, DIRTY_FACING);
+}
+
+void TransformWriteback::_mark_dirty(int32_t slot, uint8_t flag) {
+  if (nodes[slot] == nullptr) {
+    return;
+  }
+
+  if (dirty_flags[slot] == DIRTY_NONE) {
+    dirty_slots.push_back(slot);
+  }
+  dirty_flags[slot] |= flag;
+}
+
+void TransformWriteback::flush() {
+  last_flush_count = 0;
+  if (dirty_slots.empty()) {
+    return;
+  }
+
+  // Facings first: projectiles may be parented under a unit, so their global
+  // position must be written after the parent's basis is final
+  for (int32_t slot : dirty_slots) {
+    if ((dirty_flags[slot] & DIRTY_FACING) == 0) {
+      continue;
+    }
+    Node3D* node = nodes[slot];
+    if (node != nullptr && node->is_inside_tree()) {
+      apply_facing(node, facings[slot]);
+    }
+  }
+
+  for (int32_t slot : dirty_slots) {
+    uint8_t flags = dirty_flags[slot];
+    if (flags == DIRTY_NONE) {
+      continue;  // Released after being written
+    }
+
+    Node3D* node = nodes[slot];
+    if ((flags & DIRTY_POSITION) != 0 && node != nullptr &&
+        node->is_inside_tree()) {
+      node->set_global_position(positions[slot]);
+    }
+
+    dirty_flags[slot] = DIRTY_NONE;
+    last_flush_count++;
+  }
+
+  dirty_slots.clear();
+}
+
+int32_t TransformWriteback::get_registered_count() const {
+  return registered_count;
+}
+
+int32_t TransformWriteback::get_last_flush_count() const {
+  return last_flush_count;
+}
+
+void TransformWriteback::apply_facing(Node3D* node,
+                                      const Vector3& horizontal_direction) {
+  if (node == nullptr) {
+    return;
+  }
+
+  // For yaw a: forward = (-sin a, 0, -cos a), so cos a = -dir.z and
+  // sin a = -dir.x. Columns are right, up and back (-forward).
+  const Vector3& dir = horizontal_direction;
+  Basis basis;
+  basis.set_column(0, Vector3(-dir.z, 0, dir.x));
+  basis.set_column(1, Vector3(0, 1, 0));
+  basis.set_column(2, Vector3(-dir.x, 0, -dir.z));
+  node->set_basis(basis);
+}
+
+TransformWriteback* TransformWriteback::get_singleton() {
+  return singleton_instance;
+}
+
+TransformWriteback* TransformWriteback::ensure_singleton(Node* context) {
+  if (singleton_instance != nullptr) {
+    return singleton_instance;
+  }
+
+  if (context == nullptr || !context->is_inside_tree()) {
+    return nullptr;
+  }
+
+  // The root may be busy adding the current scene, so defer the add_child.
+  // Writes made before the node enters the tree are flushed on its first tick.
+  TransformWriteback* writeback = memnew(TransformWriteback);
+  writeback->set_name("TransformWriteback");
+  context->get_tree()->get_root()->call_deferred("add_child", writeback);
+  DBG_INFO("TransformWriteback", "Created transform writeback stage");
+  return singleton_instance;
+}
@@ -0,0 +1,91 @@
+#ifndef GDEXTENSION_TRANSFORM_WRITEBACK_H
+#define GDEXTENSION_TRANSFORM_WRITEBACK_H
+
+#include <cstdint>
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <vector>
+
+namespace godot {
+class Node3D;
+}  // namespace godot
+
+using godot::Node;
+using godot::Vector3;
+
+/// Buffered transform writeback stage
+/// Simulation code (movement, projectiles) writes positions and facings into
+/// slots instead of touching the scene graph. Once per physics tick, after
+/// every component has run, flush() pushes only the dirty slots to their
+/// nodes. Units whose transform did not change cost nothing.
+///
+/// Usage:
+/// - acquire_slot(node) when the node enters the tree, release_slot() on exit
+/// - write_position()/write_facing() during simulation
+/// - Facing is a horizontal unit direction, so no trig is needed anywhere
+///
+/// Created on demand by ensure_singleton(); may also be placed in the scene.
+class TransformWriteback : public Node {
+  GDCLASS(TransformWriteback, Node)
+
+ protected:
+  static void _bind_methods();
+
+  enum DirtyFlags : uint8_t {
+    DIRTY_NONE = 0,
+    DIRTY_POSITION = 1 << 0,
+    DIRTY_FACING = 1 << 1,
+  };
+
+  // Slot storage (parallel arrays indexed by slot)
+  std::vector<godot::Node3D*> nodes;
+  std::vector<Vector3> positions;  // Global positions
+  std::vector<Vector3> facings;    // Horizontal forward directions
+  std::vector<uint8_t> dirty_flags;
+
+  std::vector<int32_t> dirty_slots;  // Slots written since the last flush
+  std::vector<int32_t> free_slots;   // Released slots for reuse
+
+  int32_t registered_count = 0;
+  int32_t last_flush_count = 0;
+
+  void _mark_dirty(int32_t slot, uint8_t flag);
+
+ public:
+  static constexpr int32_t INVALID_SLOT = -1;
+
+  // Facings closer than this (dot product) are treated as unchanged
+  static constexpr float FACING_DOT_THRESHOLD = 0.99999f;
+
+  TransformWriteback();
+  ~TransformWriteback();
+
+  void _ready() override;
+  void _physics_process(double delta) override;
+
+  int32_t acquire_slot(godot::Node3D* node);
+  void release_slot(int32_t slot, const godot::Node3D* node);
+
+  void write_position(int32_t slot, const Vector3& global_position);
+  void write_facing(int32_t slot, const Vector3& horizontal_direction);
+
+  // Push all dirty slots to the scene (runs automatically at the end of tick)
+  void flush();
+
+  int32_t get_registered_count() const;
+  int32_t get_last_flush_count() const;
+
+  /// Orient a node to face a normalized horizontal direction (Y-up)
+  /// Builds the basis directly from the direction, without atan2/sin/cos
+  static void apply_facing(godot::Node3D* node,
+                           const Vector3& horizontal_direction);
+
+  static TransformWriteback* get_singleton();
+  // Creates the singleton under the scene root if needed (deferred add)
+  static TransformWriteback* ensure_singleton(Node* context);
+
+ private:
+  static TransformWriteback* singleton_instance;
+};
+
+#endif  // GDEXTENSION_TRANSFORM_WRITEBACK_H
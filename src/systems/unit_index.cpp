@@ -0,0 +1,315 @@
+#include "unit_index.hpp"
+
+#include <cmath>
+#include <godot_cpp/classes/engine.hpp>
+
+#include "../core/unit.hpp"
+
+using godot::Engine;
+
+std::vector<UnitIndex::Record> UnitIndex::records;
+std::vector<int32_t> UnitIndex::free_slots;
+int32_t UnitIndex::unit_count = 0;
+
+std::vector<int32_t> UnitIndex::bucket_start;
+std::vector<uint64_t> UnitIndex::cell_signature;
+uint32_t UnitIndex::present_factions = 0;
+std::vector<float> UnitIndex::sorted_x;
+std::vector<float> UnitIndex::sorted_z;
+std::vector<int32_t> UnitIndex::sorted_slot;
+std::vector<int32_t> UnitIndex::scratch_slot_bucket;
+std::vector<Vector3> UnitIndex::scratch_slot_position;
+std::vector<int32_t> UnitIndex::scratch_cursor;
+uint64_t UnitIndex::built_frame = 0;
+std::vector<UnitIndex::CellMove> UnitIndex::cell_moves;
+bool UnitIndex::tracking_moves = false;
+bool UnitIndex::built = false;
+
+namespace {
+// splitmix64 finalizer - spreads ids and cell coordinates across all bits
+uint64_t mix_bits(uint64_t value) {
+  value += 0x9E3779B97F4A7C15ULL;
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+  return value ^ (value >> 31);
+}
+}  // namespace
+
+void UnitIndex::add_unit(Unit* unit) {
+  if (unit == nullptr || unit->get_index_slot() != INVALID_SLOT) {
+    return;
+  }
+
+  int32_t slot = INVALID_SLOT;
+  if (!free_slots.empty()) {
+    slot = free_slots.back();
+    free_slots.pop_back();
+  } else {
+    slot = static_cast<int32_t>(records.size());
+    records.emplace_back();
+  }
+
+  Record& record = records[slot];
+  record.unit = unit;
+  record.id = unit->get_instance_id();
+  record.faction_id = FactionTable::clamp_faction(unit->get_faction_id());
+  record.health = 0.0f;
+  record.alive = true;
+  unit->set_index_slot(slot);
+  unit_count++;
+
+  // Becomes visible to queries on the next rebuild
+  built = false;
+}
+
+void UnitIndex::remove_unit(Unit* unit) {
+  int32_t slot = _slot_of(unit);
+  if (slot == INVALID_SLOT) {
+    return;
+  }
+
+  Record& record = records[slot];
+  if (record.cell != INVALID_SLOT) {
+    _log_move(record, record.faction_id, INVALID_SLOT, Vector3());
+  }
+
+  record = Record();
+  free_slots.push_back(slot);
+  unit->set_index_slot(INVALID_SLOT);
+  unit_count--;
+}
+
+void UnitIndex::update_health(Unit* unit, float health, bool alive) {
+  int32_t slot = _slot_of(unit);
+  if (slot == INVALID_SLOT) {
+    return;
+  }
+
+  Record& record = records[slot];
+  record.health = health;
+  if (record.alive != alive) {
+    record.alive = alive;
+    // Revived units must re-enter the grid; deaths are filtered on visit
+    if (alive) {
+      built = false;
+    }
+  }
+}
+
+bool UnitIndex::is_alive(const Unit* unit) {
+  int32_t slot = _slot_of(unit);
+  return slot != INVALID_SLOT && records[slot].alive;
+}
+
+float UnitIndex::get_health(int32_t slot) {
+  return records[slot].health;
+}
+
+int32_t UnitIndex::get_faction(int32_t slot) {
+  return records[slot].faction_id;
+}
+
+int32_t UnitIndex::get_unit_count() {
+  return unit_count;
+}
+
+void UnitIndex::set_move_tracking(bool enabled) {
+  tracking_moves = enabled;
+  if (!enabled) {
+    cell_moves.clear();
+  }
+}
+
+void UnitIndex::take_cell_moves(std::vector<CellMove>& out) {
+  out.clear();
+  out.swap(cell_moves);
+}
+
+void UnitIndex::refresh() {
+  uint64_t frame = Engine::get_singleton()->get_physics_frames();
+  if (built && frame == built_frame) {
+    return;
+  }
+
+  _rebuild();
+  built_frame = frame;
+  built = true;
+}
+
+bool UnitIndex::has_units_in_box(float min_x,
+                                 float min_z,
+                                 float max_x,
+                                 float max_z,
+                                 uint32_t faction_mask) {
+  refresh();
+
+  int32_t min_cx = _cell_coord(min_x);
+  int32_t max_cx = _cell_coord(max_x);
+  int32_t min_cz = _cell_coord(min_z);
+  int32_t max_cz = _cell_coord(max_z);
+
+  // One offset comparison per row and faction
+  uint32_t factions = faction_mask & present_factions;
+  for (int32_t faction = 0; factions != 0; faction++, factions >>= 1) {
+    if ((factions & 1u) == 0) {
+      continue;
+    }
+
+    int32_t bucket_base = faction * CELL_COUNT;
+    for (int32_t cz = min_cz; cz <= max_cz; cz++) {
+      int32_t row = bucket_base + cz * GRID_DIM;
+      if (bucket_start[row + min_cx] < bucket_start[row + max_cx + 1]) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+uint64_t UnitIndex::get_area_signature(const Vector3& center, float radius) {
+  refresh();
+
+  int32_t min_cx = _cell_coord(center.x - radius);
+  int32_t max_cx = _cell_coord(center.x + radius);
+  int32_t min_cz = _cell_coord(center.z - radius);
+  int32_t max_cz = _cell_coord(center.z + radius);
+
+  uint64_t signature = 0;
+  for (int32_t cz = min_cz; cz <= max_cz; cz++) {
+    for (int32_t cx = min_cx; cx <= max_cx; cx++) {
+      signature += cell_signature[cz * GRID_DIM + cx];
+    }
+  }
+  return signature;
+}
+
+int32_t UnitIndex::_slot_of(const Unit* unit) {
+  if (unit == nullptr) {
+    return INVALID_SLOT;
+  }
+
+  int32_t slot = unit->get_index_slot();
+  if (slot < 0 || slot >= static_cast<int32_t>(records.size()) ||
+      records[slot].unit != unit) {
+    return INVALID_SLOT;
+  }
+  return slot;
+}
+
+void UnitIndex::_rebuild() {
+  // Only factions indexed last time have entries to clear; a faction's
+  // start offset and counts live in
+  // bucket_start[f * CELL_COUNT .. (f + 1) * CELL_COUNT]. The start offset
+  // must go too: faction f - 1 counts its last cell in the same entry, and
+  // it may be absent last time but present now
+  if (bucket_start.empty()) {
+    bucket_start.assign(BUCKET_COUNT + 1, 0);
+    scratch_cursor.resize(BUCKET_COUNT);
+  }
+  uint32_t previous = present_factions;
+  for (int32_t faction = 0; previous != 0; faction++, previous >>= 1) {
+    if ((previous & 1u) != 0) {
+      auto first = bucket_start.begin() + faction * CELL_COUNT;
+      std::fill(first, first + CELL_COUNT + 1, 0);
+    }
+  }
+  cell_signature.assign(CELL_COUNT, 0);
+  present_factions = 0;
+
+  // Pass 1: sample positions, bucket counts and per-cell signatures
+  int32_t slot_count = static_cast<int32_t>(records.size());
+  std::vector<int32_t>& slot_bucket = scratch_slot_bucket;
+  std::vector<Vector3>& slot_position = scratch_slot_position;
+  slot_bucket.assign(slot_count, INVALID_SLOT);
+  slot_position.resize(slot_count);
+  int32_t indexed = 0;
+
+  for (int32_t slot = 0; slot < slot_count; slot++) {
+    Record& record = records[slot];
+    if (record.unit == nullptr || !record.alive ||
+        !record.unit->is_inside_tree()) {
+      if (record.cell != INVALID_SLOT) {
+        _log_move(record, record.faction_id, INVALID_SLOT, Vector3());
+        record.cell = INVALID_SLOT;
+      }
+      continue;
+    }
+
+    // Faction can change at runtime (e.g. mind control); sample it here
+    int32_t faction_id =
+        FactionTable::clamp_faction(record.unit->get_faction_id());
+    Vector3 position = record.unit->get_global_position();
+    int32_t cell = get_cell(position.x, position.z);
+    if (cell != record.cell || faction_id != record.faction_id) {
+      _log_move(record, faction_id, cell, position);
+    }
+    record.faction_id = faction_id;
+    record.cell = cell;
+    present_factions |= 1u << record.faction_id;
+
+    int32_t bucket = record.faction_id * CELL_COUNT + cell;
+    slot_bucket[slot] = bucket;
+    slot_position[slot] = position;
+    bucket_start[bucket + 1]++;
+    indexed++;
+
+    auto qx = static_cast<int64_t>(std::floor(position.x / SIGNATURE_QUANTUM));
+    auto qz = static_cast<int64_t>(std::floor(position.z / SIGNATURE_QUANTUM));
+    uint64_t quantized =
+        static_cast<uint64_t>(qx) ^ (static_cast<uint64_t>(qz) << 32);
+    cell_signature[cell] += mix_bits(record.id ^ mix_bits(quantized));
+  }
+
+  // Prefix sum turns counts into start offsets, over present factions only
+  // (queries never read the buckets of absent ones)
+  std::vector<int32_t>& cursor = scratch_cursor;
+  int32_t total = 0;
+  uint32_t factions = present_factions;
+  for (int32_t faction = 0; factions != 0; faction++, factions >>= 1) {
+    if ((factions & 1u) == 0) {
+      continue;
+    }
+
+    int32_t base = faction * CELL_COUNT;
+    bucket_start[base] = total;
+    for (int32_t cell = 0; cell < CELL_COUNT; cell++) {
+      cursor[base + cell] = bucket_start[base + cell];
+      bucket_start[base + cell + 1] += bucket_start[base + cell];
+    }
+    total = bucket_start[base + CELL_COUNT];
+  }
+
+  // Pass 2: scatter into the flat, (faction, cell)-ordered arrays
+  sorted_x.resize(indexed);
+  sorted_z.resize(indexed);
+  sorted_slot.resize(indexed);
+  for (int32_t slot = 0; slot < slot_count; slot++) {
+    int32_t bucket = slot_bucket[slot];
+    if (bucket == INVALID_SLOT) {
+      continue;
+    }
+
+    int32_t i = cursor[bucket]++;
+    sorted_x[i] = slot_position[slot].x;
+    sorted_z[i] = slot_position[slot].z;
+    sorted_slot[i] = slot;
+  }
+}
+
+void UnitIndex::_log_move(const Record& record,
+                          int32_t faction_id,
+                          int32_t to_cell,
+                          const Vector3& position) {
+  if (!tracking_moves) {
+    return;
+  }
+
+  CellMove move;
+  move.unit_id = record.id;
+  move.faction_id = faction_id;
+  move.from_cell = record.cell;
+  move.to_cell = to_cell;
+  move.x = position.x;
+  move.z = position.z;
+  cell_moves.push_back(move);
+}
@@ -0,0 +1,242 @@
+#ifndef GDEXTENSION_UNIT_INDEX_H
+#define GDEXTENSION_UNIT_INDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <godot_cpp/variant/vector3.hpp>
+#include <vector>
+
+#include "../core/faction_table.hpp"
+
+using godot::Vector3;
+
+class Unit;
+
+/// Shared spatial index of living units
+/// A uniform XZ grid rebuilt lazily, at most once per physics frame, the first
+/// time anything queries it. Units register on enter/exit tree; health is
+/// pushed by HealthComponent so dead units drop out of every query.
+///
+/// Layout:
+/// - Records are stable slots (Unit pointer, id, faction, health)
+/// - Each rebuild counting-sorts living units by (faction, cell) into flat
+///   arrays (sorted_x/sorted_z/sorted_slot), so every faction has its own
+///   bucketed grid and a cell of one faction is a contiguous range
+/// - Queries take a faction mask (see FactionTable); factions outside it are
+///   never visited, so enemy-only queries don't even read ally positions
+/// - Positions outside the grid bounds are clamped into the border cells
+/// - With move tracking on, every rebuild logs the units whose cell (or
+///   faction) changed, so consumers like ZoneSystem can update incrementally
+///
+/// Distances are measured on the XZ plane (units stand on the ground).
+class UnitIndex {
+ public:
+  static constexpr int32_t INVALID_SLOT = -1;
+  static constexpr float CELL_SIZE = 8.0f;
+  static constexpr float HALF_EXTENT = 128.0f;  // Grid covers +/-128m
+  static constexpr int32_t GRID_DIM =
+      static_cast<int32_t>(2.0f * HALF_EXTENT / CELL_SIZE);
+  static constexpr int32_t CELL_COUNT = GRID_DIM * GRID_DIM;
+  static constexpr int32_t BUCKET_COUNT =
+      FactionTable::MAX_FACTIONS * CELL_COUNT;
+
+  /// A unit that changed cell or faction between two rebuilds
+  struct CellMove {
+    uint64_t unit_id = 0;
+    int32_t faction_id = 0;
+    int32_t from_cell = INVALID_SLOT;  // INVALID_SLOT = wasn't indexed
+    int32_t to_cell = INVALID_SLOT;    // INVALID_SLOT = died, left the tree
+    float x = 0.0f;                    // Position at the rebuild (to_cell)
+    float z = 0.0f;
+  };
+
+  static void add_unit(Unit* unit);
+  static void remove_unit(Unit* unit);
+  static void update_health(Unit* unit, float health, bool alive);
+
+  /// Rebuild the grid if the current physics frame hasn't been indexed yet
+  static void refresh();
+
+  static bool is_alive(const Unit* unit);
+  static float get_health(int32_t slot);
+  static int32_t get_faction(int32_t slot);
+  static int32_t get_unit_count();
+
+  /// Log CellMoves on every rebuild until disabled (single consumer)
+  static void set_move_tracking(bool enabled);
+
+  /// Moves logged since the last call, handed over by swapping into out
+  static void take_cell_moves(std::vector<CellMove>& out);
+
+  static int32_t get_cell(float x, float z) {
+    return _cell_coord(z) * GRID_DIM + _cell_coord(x);
+  }
+
+  /// Visit every living unit of the factions in faction_mask within radius
+  /// of center (XZ)
+  /// visit(Unit* unit, float distance_sq, int32_t slot)
+  template <typename Visitor>
+  static void visit_radius(const Vector3& center,
+                           float radius,
+                           uint32_t faction_mask,
+                           Visitor&& visit) {
+    float radius_sq = radius * radius;
+    visit_box_ranges(
+        center.x - radius, center.z - radius, center.x + radius,
+        center.z + radius, faction_mask,
+        [&](const float* xs, const float* zs, const int32_t* slots,
+            int32_t count) {
+          for (int32_t i = 0; i < count; i++) {
+            float dx = xs[i] - center.x;
+            float dz = zs[i] - center.z;
+            float distance_sq = dx * dx + dz * dz;
+            if (distance_sq > radius_sq) {
+              continue;
+            }
+            Unit* unit = get_live_unit(slots[i]);
+            if (unit != nullptr) {
+              visit(unit, distance_sq, slots[i]);
+            }
+          }
+        });
+  }
+
+  /// Visit the sorted ranges of every cell overlapping the XZ box, for the
+  /// factions in faction_mask. Ranges are contiguous SoA slices, so shape
+  /// tests can run as straight-line loops over xs/zs before touching units.
+  /// Slots may hold units removed or killed since the rebuild; resolve them
+  /// with get_live_unit.
+  /// visit(const float* xs, const float* zs, const int32_t* slots, count)
+  template <typename Visitor>
+  static void visit_box_ranges(float min_x,
+                               float min_z,
+                               float max_x,
+                               float max_z,
+                               uint32_t faction_mask,
+                               Visitor&& visit) {
+    refresh();
+
+    int32_t min_cx = _cell_coord(min_x);
+    int32_t max_cx = _cell_coord(max_x);
+    int32_t min_cz = _cell_coord(min_z);
+    int32_t max_cz = _cell_coord(max_z);
+
+    // Whole faction buckets are skipped before any distance math
+    uint32_t factions = faction_mask & present_factions;
+    for (int32_t faction = 0; factions != 0; faction++, factions >>= 1) {
+      if ((factions & 1u) == 0) {
+        continue;
+      }
+
+      // Cells of a row are adjacent buckets, so each row is one range
+      int32_t bucket_base = faction * CELL_COUNT;
+      for (int32_t cz = min_cz; cz <= max_cz; cz++) {
+        int32_t row = bucket_base + cz * GRID_DIM;
+        int32_t begin = bucket_start[row + min_cx];
+        int32_t end = bucket_start[row + max_cx + 1];
+        if (begin < end) {
+          visit(sorted_x.data() + begin, sorted_z.data() + begin,
+                sorted_slot.data() + begin, end - begin);
+        }
+      }
+    }
+  }
+
+  /// Visit the sorted ranges of one cell for the factions in faction_mask
+  /// visit(const float* xs, const float* zs, const int32_t* slots, count)
+  template <typename Visitor>
+  static void visit_cell(int32_t cell, uint32_t faction_mask, Visitor&& visit) {
+    refresh();
+
+    uint32_t factions = faction_mask & present_factions;
+    for (int32_t faction = 0; factions != 0; faction++, factions >>= 1) {
+      if ((factions & 1u) == 0) {
+        continue;
+      }
+
+      int32_t bucket = faction * CELL_COUNT + cell;
+      int32_t begin = bucket_start[bucket];
+      int32_t end = bucket_start[bucket + 1];
+      if (begin < end) {
+        visit(sorted_x.data() + begin, sorted_z.data() + begin,
+              sorted_slot.data() + begin, end - begin);
+      }
+    }
+  }
+
+  /// Unit in slot, or nullptr if it was removed or died since the rebuild
+  static Unit* get_live_unit(int32_t slot) {
+    const Record& record = records[slot];
+    return record.alive ? record.unit : nullptr;
+  }
+
+  /// True if the XZ box covers every cell (queries can't grow further)
+  static bool covers_grid(float min_x, float min_z, float max_x, float max_z) {
+    return _cell_coord(min_x) == 0 && _cell_coord(min_z) == 0 &&
+           _cell_coord(max_x) == GRID_DIM - 1 &&
+           _cell_coord(max_z) == GRID_DIM - 1;
+  }
+
+  /// True if a unit of the factions in faction_mask occupies any cell
+  /// overlapping the XZ box. Cell granularity, no distance math: a cheap
+  /// "anything around?" test to run before real queries.
+  static bool has_units_in_box(float min_x,
+                               float min_z,
+                               float max_x,
+                               float max_z,
+                               uint32_t faction_mask);
+
+  /// Order-independent hash of which units occupy the cells covering the
+  /// circle, and where (quantized). Equal signatures mean the neighborhood
+  /// has not changed, so cached query results are still valid.
+  static uint64_t get_area_signature(const Vector3& center, float radius);
+
+ private:
+  struct Record {
+    Unit* unit = nullptr;  // nullptr = free slot
+    uint64_t id = 0;
+    int32_t faction_id = 0;
+    int32_t cell = INVALID_SLOT;  // Cell at the last rebuild
+    float health = 0.0f;
+    bool alive = true;
+  };
+
+  // Signature position quantum - movement below this doesn't invalidate
+  static constexpr float SIGNATURE_QUANTUM = 1.0f;
+
+  static int32_t _cell_coord(float world) {
+    int32_t coord = static_cast<int32_t>((world + HALF_EXTENT) / CELL_SIZE);
+    return std::clamp(coord, 0, GRID_DIM - 1);
+  }
+
+  static int32_t _slot_of(const Unit* unit);
+  static void _rebuild();
+  static void _log_move(const Record& record,
+                        int32_t faction_id,
+                        int32_t to_cell,
+                        const Vector3& position);
+
+  static std::vector<Record> records;
+  static std::vector<int32_t> free_slots;
+  static int32_t unit_count;
+
+  // Rebuilt per physics frame
+  static std::vector<int32_t> bucket_start;  // BUCKET_COUNT + 1 offsets
+  static std::vector<uint64_t> cell_signature;  // All factions per cell
+  static uint32_t present_factions;
+  static std::vector<float> sorted_x;
+  static std::vector<float> sorted_z;
+  static std::vector<int32_t> sorted_slot;
+  static uint64_t built_frame;
+
+  static std::vector<CellMove> cell_moves;
+  static bool tracking_moves;
+
+  // Rebuild scratch, kept to avoid per-frame allocation
+  static std::vector<int32_t> scratch_slot_bucket;
+  static std::vector<Vector3> scratch_slot_position;
+  static std::vector<int32_t> scratch_cursor;
+  static bool built;
+};
+
+#endif  // GDEXTENSION_UNIT_INDEX_H
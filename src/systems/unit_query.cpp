@@ -0,0 +1,461 @@
+#include "unit_query.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <godot_cpp/classes/engine.hpp>
+
+#include "../core/faction_table.hpp"
+#include "../core/unit.hpp"
+#include "unit_index.hpp"
+
+using godot::Engine;
+
+std::vector<UnitQuery::ArenaBlock> UnitQuery::arena_blocks;
+int32_t UnitQuery::arena_block_index = 0;
+int32_t UnitQuery::arena_block_used = 0;
+uint64_t UnitQuery::arena_frame = 0;
+bool UnitQuery::arena_started = false;
+
+namespace {
+// Range kernels: hits[i] = 1 if (xs[i], zs[i]) is inside the shape
+// Straight-line loops over SoA data, written so the compiler can vectorize
+// them; the bounding box already culled everything far away.
+
+struct SphereKernel {
+  float center_x;
+  float center_z;
+  float radius_sq;
+
+  void operator()(const float* xs,
+                  const float* zs,
+                  int32_t count,
+                  uint8_t* hits) const {
+    for (int32_t i = 0; i < count; i++) {
+      float dx = xs[i] - center_x;
+      float dz = zs[i] - center_z;
+      hits[i] = static_cast<uint8_t>(dx * dx + dz * dz <= radius_sq);
+    }
+  }
+};
+
+struct ConeKernel {
+  float apex_x;
+  float apex_z;
+  float dir_x;  // Unit length
+  float dir_z;
+  float range_sq;
+  float cos_half_angle;
+
+  void operator()(const float* xs,
+                  const float* zs,
+                  int32_t count,
+                  uint8_t* hits) const {
+    for (int32_t i = 0; i < count; i++) {
+      float dx = xs[i] - apex_x;
+      float dz = zs[i] - apex_z;
+      float distance_sq = dx * dx + dz * dz;
+      float along = dx * dir_x + dz * dir_z;
+      hits[i] = static_cast<uint8_t>(
+          (distance_sq <= range_sq) &
+          (along >= cos_half_angle * std::sqrt(distance_sq)));
+    }
+  }
+};
+
+struct CapsuleKernel {
+  float start_x;
+  float start_z;
+  float segment_x;
+  float segment_z;
+  float inv_length_sq;  // 0 for a degenerate segment (plain circle)
+  float radius_sq;
+
+  void operator()(const float* xs,
+                  const float* zs,
+                  int32_t count,
+                  uint8_t* hits) const {
+    for (int32_t i = 0; i < count; i++) {
+      float px = xs[i] - start_x;
+      float pz = zs[i] - start_z;
+      float t = (px * segment_x + pz * segment_z) * inv_length_sq;
+      t = std::min(std::max(t, 0.0f), 1.0f);
+      float ex = px - segment_x * t;
+      float ez = pz - segment_z * t;
+      hits[i] = static_cast<uint8_t>(ex * ex + ez * ez <= radius_sq);
+    }
+  }
+};
+
+struct OrientedRectKernel {
+  float center_x;
+  float center_z;
+  float forward_x;  // Unit length
+  float forward_z;
+  float half_length;
+  float half_width;
+
+  void operator()(const float* xs,
+                  const float* zs,
+                  int32_t count,
+                  uint8_t* hits) const {
+    for (int32_t i = 0; i < count; i++) {
+      float dx = xs[i] - center_x;
+      float dz = zs[i] - center_z;
+      float along = dx * forward_x + dz * forward_z;
+      float across = dx * forward_z - dz * forward_x;
+      hits[i] = static_cast<uint8_t>((std::abs(along) <= half_length) &
+                                     (std::abs(across) <= half_width));
+    }
+  }
+};
+
+// Direction on the XZ plane; false if it has no horizontal component
+bool flat_direction(const Vector3& direction, float& out_x, float& out_z) {
+  float length = std::sqrt(direction.x * direction.x +
+                           direction.z * direction.z);
+  if (length <= 0.0001f) {
+    return false;
+  }
+  out_x = direction.x / length;
+  out_z = direction.z / length;
+  return true;
+}
+}  // namespace
+
+std::vector<uint8_t> UnitQuery::scratch_hits;
+std::vector<UnitQuery::Candidate> UnitQuery::scratch_candidates;
+
+Array UnitSpan::to_array() const {
+  Array result;
+  result.resize(count);
+  for (int32_t i = 0; i < count; i++) {
+    result[i] = data[i];
+  }
+  return result;
+}
+
+template <typename Kernel, typename Sink>
+void UnitQuery::_collect(float min_x,
+                         float min_z,
+                         float max_x,
+                         float max_z,
+                         Unit* reference_unit,
+                         uint32_t allegiance,
+                         const Kernel& kernel,
+                         Sink&& sink) {
+  // Factions that can't match are skipped by the grid; the per-unit check
+  // only separates the reference unit from its own faction
+  uint32_t faction_mask = FactionTable::ALL_FACTIONS;
+  if (reference_unit != nullptr) {
+    faction_mask = FactionTable::get_faction_mask(
+        reference_unit->get_faction_id(), allegiance);
+  }
+
+  UnitIndex::visit_box_ranges(
+      min_x, min_z, max_x, max_z, faction_mask,
+      [&](const float* xs, const float* zs, const int32_t* slots,
+          int32_t count) {
+        if (static_cast<int32_t>(scratch_hits.size()) < count) {
+          scratch_hits.resize(count);
+        }
+        uint8_t* hits = scratch_hits.data();
+        kernel(xs, zs, count, hits);
+
+        for (int32_t i = 0; i < count; i++) {
+          if (hits[i] == 0) {
+            continue;
+          }
+          Unit* unit = UnitIndex::get_live_unit(slots[i]);
+          if (unit == nullptr) {
+            continue;
+          }
+          if (reference_unit != nullptr &&
+              !FactionTable::matches(reference_unit, unit, allegiance)) {
+            continue;
+          }
+          sink(unit, xs[i], zs[i], slots[i]);
+        }
+      });
+}
+
+int32_t UnitQuery::sphere(const Vector3& center,
+                          float radius,
+                          Unit* reference_unit,
+                          uint32_t allegiance,
+                          Unit** out,
+                          int32_t capacity) {
+  int32_t written = 0;
+  if (out == nullptr || capacity <= 0) {
+    return written;
+  }
+
+  SphereKernel kernel{center.x, center.z, radius * radius};
+  _collect(center.x - radius, center.z - radius, center.x + radius,
+           center.z + radius, reference_unit, allegiance, kernel,
+           [&](Unit* unit, float x, float z, int32_t slot) {
+             if (written < capacity) {
+               out[written++] = unit;
+             }
+           });
+  return written;
+}
+
+UnitSpan UnitQuery::sphere(const Vector3& center,
+                           float radius,
+                           Unit* reference_unit,
+                           uint32_t allegiance) {
+  ArenaWriter writer;
+  SphereKernel kernel{center.x, center.z, radius * radius};
+  _collect(center.x - radius, center.z - radius, center.x + radius,
+           center.z + radius, reference_unit, allegiance, kernel,
+           [&](Unit* unit, float x, float z, int32_t slot) {
+             writer.push(unit);
+           });
+  return writer.commit();
+}
+
+UnitSpan UnitQuery::cone(const Vector3& apex,
+                         const Vector3& direction,
+                         float range,
+                         float half_angle,
+                         Unit* reference_unit,
+                         uint32_t allegiance) {
+  ArenaWriter writer;
+  ConeKernel kernel{apex.x, apex.z, 0.0f, 0.0f, range * range,
+                    std::cos(std::min(half_angle, 3.14159265f))};
+  if (!flat_direction(direction, kernel.dir_x, kernel.dir_z)) {
+    return writer.commit();
+  }
+
+  _collect(apex.x - range, apex.z - range, apex.x + range, apex.z + range,
+           reference_unit, allegiance, kernel,
+           [&](Unit* unit, float x, float z, int32_t slot) {
+             writer.push(unit);
+           });
+  return writer.commit();
+}
+
+UnitSpan UnitQuery::capsule(const Vector3& start,
+                            const Vector3& end,
+                            float radius,
+                            Unit* reference_unit,
+                            uint32_t allegiance) {
+  ArenaWriter writer;
+  float segment_x = end.x - start.x;
+  float segment_z = end.z - start.z;
+  float length_sq = segment_x * segment_x + segment_z * segment_z;
+  CapsuleKernel kernel{start.x,
+                       start.z,
+                       segment_x,
+                       segment_z,
+                       length_sq > 0.0f ? 1.0f / length_sq : 0.0f,
+                       radius * radius};
+
+  _collect(std::min(start.x, end.x) - radius,
+           std::min(start.z, end.z) - radius,
+           std::max(start.x, end.x) + radius,
+           std::max(start.z, end.z) + radius, reference_unit, allegiance,
+           kernel, [&](Unit* unit, float x, float z, int32_t slot) {
+             writer.push(unit);
+           });
+  return writer.commit();
+}
+
+UnitSpan UnitQuery::oriented_rect(const Vector3& center,
+                                  const Vector3& forward,
+                                  float half_length,
+                                  float half_width,
+                                  Unit* reference_unit,
+                                  uint32_t allegiance) {
+  ArenaWriter writer;
+  OrientedRectKernel kernel{center.x,    center.z,  0.0f, 0.0f,
+                            half_length, half_width};
+  if (!flat_direction(forward, kernel.forward_x, kernel.forward_z)) {
+    return writer.commit();
+  }
+
+  // Half extents of the rotated rectangle's bounding box
+  float abs_x = std::abs(kernel.forward_x);
+  float abs_z = std::abs(kernel.forward_z);
+  float extent_x = abs_x * half_length + abs_z * half_width;
+  float extent_z = abs_z * half_length + abs_x * half_width;
+
+  _collect(center.x - extent_x, center.z - extent_z, center.x + extent_x,
+           center.z + extent_z, reference_unit, allegiance, kernel,
+           [&](Unit* unit, float x, float z, int32_t slot) {
+             writer.push(unit);
+           });
+  return writer.commit();
+}
+
+UnitSpan UnitQuery::k_nearest(const Vector3& center,
+                              int32_t k,
+                              float max_range,
+                              Unit* reference_unit,
+                              uint32_t allegiance,
+                              UnitSpan exclude) {
+  ArenaWriter writer;
+  int32_t found = _gather_nearest(center, k, max_range, reference_unit,
+                                  allegiance, exclude);
+  for (int32_t i = 0; i < found; i++) {
+    writer.push(scratch_candidates[i].unit);
+  }
+  return writer.commit();
+}
+
+int32_t UnitQuery::k_nearest(const Vector3& center,
+                             int32_t k,
+                             float max_range,
+                             Unit* reference_unit,
+                             uint32_t allegiance,
+                             UnitSpan exclude,
+                             Unit** out) {
+  if (out == nullptr) {
+    return 0;
+  }
+
+  int32_t found = _gather_nearest(center, k, max_range, reference_unit,
+                                  allegiance, exclude);
+  for (int32_t i = 0; i < found; i++) {
+    out[i] = scratch_candidates[i].unit;
+  }
+  return found;
+}
+
+int32_t UnitQuery::_gather_nearest(const Vector3& center,
+                                   int32_t k,
+                                   float max_range,
+                                   Unit* reference_unit,
+                                   uint32_t allegiance,
+                                   UnitSpan exclude) {
+  std::vector<Candidate>& candidates = scratch_candidates;
+  candidates.clear();
+  if (k <= 0 || !(max_range > 0.0f)) {
+    return 0;
+  }
+
+  // Grow the search circle until it holds k units; anything outside a circle
+  // is farther than everything inside it, so the k nearest are among them
+  float radius = std::min(max_range, K_NEAREST_START_RADIUS);
+  while (true) {
+    float min_x = center.x - radius;
+    float min_z = center.z - radius;
+    float max_x = center.x + radius;
+    float max_z = center.z + radius;
+    // Once the box covers the grid, units clamped into the border cells are
+    // included too, so the last pass uses the full max_range
+    bool last = radius >= max_range ||
+                UnitIndex::covers_grid(min_x, min_z, max_x, max_z);
+    float query_radius = last ? max_range : radius;
+
+    candidates.clear();
+    SphereKernel kernel{center.x, center.z, query_radius * query_radius};
+    _collect(min_x, min_z, max_x, max_z, reference_unit, allegiance, kernel,
+             [&](Unit* unit, float x, float z, int32_t slot) {
+               if (std::find(exclude.begin(), exclude.end(), unit) !=
+                   exclude.end()) {
+                 return;
+               }
+               float dx = x - center.x;
+               float dz = z - center.z;
+               candidates.push_back({dx * dx + dz * dz, slot, unit});
+             });
+
+    if (last || static_cast<int32_t>(candidates.size()) >= k) {
+      break;
+    }
+    radius = std::min(radius * 2.0f, max_range);
+  }
+
+  int32_t found = std::min(k, static_cast<int32_t>(candidates.size()));
+  std::partial_sort(candidates.begin(), candidates.begin() + found,
+                    candidates.end(),
+                    [](const Candidate& a, const Candidate& b) {
+                      if (a.distance_sq != b.distance_sq) {
+                        return a.distance_sq < b.distance_sq;
+                      }
+                      return a.slot < b.slot;
+                    });
+  return found;
+}
+
+int32_t UnitQuery::get_arena_capacity() {
+  int32_t capacity = 0;
+  for (const ArenaBlock& block : arena_blocks) {
+    capacity += block.capacity;
+  }
+  return capacity;
+}
+
+UnitQuery::ArenaWriter::ArenaWriter() {
+  items = _open(capacity);
+}
+
+void UnitQuery::ArenaWriter::push(Unit* unit) {
+  if (count == capacity) {
+    items = _grow(items, count, capacity);
+  }
+  items[count++] = unit;
+}
+
+UnitSpan UnitQuery::ArenaWriter::commit() {
+  arena_block_used += count;
+
+  UnitSpan span;
+  span.data = items;
+  span.count = count;
+  return span;
+}
+
+void UnitQuery::_begin_frame() {
+  uint64_t frame = Engine::get_singleton()->get_physics_frames();
+  if (arena_started && frame == arena_frame) {
+    return;
+  }
+
+  // Spans from the previous frame are dead; reuse every block
+  arena_block_index = 0;
+  arena_block_used = 0;
+  arena_frame = frame;
+  arena_started = true;
+}
+
+Unit** UnitQuery::_open(int32_t& capacity) {
+  _begin_frame();
+
+  if (arena_blocks.empty()) {
+    ArenaBlock block;
+    block.items = std::make_unique<Unit*[]>(ARENA_BLOCK_SIZE);
+    block.capacity = ARENA_BLOCK_SIZE;
+    arena_blocks.push_back(std::move(block));
+  }
+
+  ArenaBlock& block = arena_blocks[arena_block_index];
+  capacity = block.capacity - arena_block_used;
+  return block.items.get() + arena_block_used;
+}
+
+Unit** UnitQuery::_grow(Unit** items, int32_t count, int32_t& capacity) {
+  // Blocks past the cursor are unused this frame, so one that is too small
+  // can be replaced without invalidating any live span
+  int32_t needed = std::max(ARENA_BLOCK_SIZE, count * 2);
+  int32_t next = arena_block_index + 1;
+  if (next == static_cast<int32_t>(arena_blocks.size())) {
+    arena_blocks.emplace_back();
+  }
+
+  ArenaBlock& block = arena_blocks[next];
+  if (block.capacity < needed) {
+    block.items = std::make_unique<Unit*[]>(needed);
+    block.capacity = needed;
+  }
+
+  if (count > 0) {
+    std::memcpy(block.items.get(), items, sizeof(Unit*) * count);
+  }
+  arena_block_index = next;
+  arena_block_used = 0;
+  capacity = block.capacity;
+  return block.items.get();
+}
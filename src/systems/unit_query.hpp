@@ -0,0 +1,181 @@
+#ifndef GDEXTENSION_UNIT_QUERY_H
+#define GDEXTENSION_UNIT_QUERY_H
+
+#include <cstdint>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "../common/allegiance.hpp"
+
+using godot::Array;
+using godot::Vector3;
+
+class Unit;
+
+/// Non-owning view over unit query results
+/// Spans from the frame arena stay valid until the next physics frame.
+struct UnitSpan {
+  Unit* const* data = nullptr;
+  int32_t count = 0;
+
+  Unit* const* begin() const { return data; }
+  Unit* const* end() const { return data + count; }
+  Unit* operator[](int32_t index) const { return data[index]; }
+  int32_t size() const { return count; }
+  bool empty() const { return count == 0; }
+
+  /// Variant copy, for script bindings only
+  Array to_array() const;
+};
+
+/// Allocation-free unit queries for C++ gameplay code
+/// Results are raw Unit pointers (no Variant boxing), written either into a
+/// caller-provided buffer or into a per-tick arena:
+/// - The arena is a chain of blocks reset at the start of every physics
+///   frame; blocks are kept, so once the busiest frame has been seen no query
+///   allocates again
+/// - A result that outgrows its block moves to the next one, so every span
+///   is contiguous
+///
+/// Shapes (sphere, cone, capsule, oriented rect, k-nearest) share one path:
+/// the UnitIndex grid yields the SoA ranges of the cells under the shape's
+/// bounding box, a branch-free kernel marks the hits of a whole range (the
+/// compiler vectorizes these loops), and only hits are resolved to units.
+///
+/// Filtering follows AbilityAPI: factions that can't match the Allegiance
+/// bits toward reference_unit are skipped by the UnitIndex grid; without a
+/// reference unit every living unit matches. Shapes are tested on the XZ
+/// plane; directions are projected onto it.
+class UnitQuery {
+ public:
+  static constexpr int32_t ARENA_BLOCK_SIZE = 1024;
+  static constexpr float K_NEAREST_START_RADIUS = 8.0f;
+
+  /// Units in radius, written into out (at most capacity)
+  /// Returns the number written
+  static int32_t sphere(const Vector3& center,
+                        float radius,
+                        Unit* reference_unit,
+                        uint32_t allegiance,
+                        Unit** out,
+                        int32_t capacity);
+
+  /// Units in radius, stored in the frame arena
+  static UnitSpan sphere(const Vector3& center,
+                         float radius,
+                         Unit* reference_unit = nullptr,
+                         uint32_t allegiance = Allegiance::OTHERS);
+
+  /// Units within range of apex whose bearing is within half_angle
+  /// (radians) of direction
+  static UnitSpan cone(const Vector3& apex,
+                       const Vector3& direction,
+                       float range,
+                       float half_angle,
+                       Unit* reference_unit = nullptr,
+                       uint32_t allegiance = Allegiance::OTHERS);
+
+  /// Units within radius of the segment start-end (line skillshots)
+  static UnitSpan capsule(const Vector3& start,
+                          const Vector3& end,
+                          float radius,
+                          Unit* reference_unit = nullptr,
+                          uint32_t allegiance = Allegiance::OTHERS);
+
+  /// Units inside the rectangle centered on center, half_length along
+  /// forward and half_width across it
+  static UnitSpan oriented_rect(const Vector3& center,
+                                const Vector3& forward,
+                                float half_length,
+                                float half_width,
+                                Unit* reference_unit = nullptr,
+                                uint32_t allegiance = Allegiance::OTHERS);
+
+  /// Up to k units within max_range, nearest first (ties by index slot)
+  /// The search radius starts at K_NEAREST_START_RADIUS and doubles until k
+  /// units are found, so sparse maps never fall back to a full scan early.
+  /// Units in exclude are skipped (kept small: it is scanned linearly).
+  static UnitSpan k_nearest(
+      const Vector3& center,
+      int32_t k,
+      float max_range = std::numeric_limits<float>::infinity(),
+      Unit* reference_unit = nullptr,
+      uint32_t allegiance = Allegiance::OTHERS,
+      UnitSpan exclude = UnitSpan());
+
+  /// Same, written into out (k is the capacity); returns the number written
+  static int32_t k_nearest(const Vector3& center,
+                           int32_t k,
+                           float max_range,
+                           Unit* reference_unit,
+                           uint32_t allegiance,
+                           UnitSpan exclude,
+                           Unit** out);
+
+  /// Arena capacity currently held (Unit pointers, all blocks)
+  static int32_t get_arena_capacity();
+
+ private:
+  struct Candidate {
+    float distance_sq = 0.0f;
+    int32_t slot = 0;
+    Unit* unit = nullptr;
+  };
+
+  /// Sorts the k nearest to the front of scratch_candidates; returns count
+  static int32_t _gather_nearest(const Vector3& center,
+                                 int32_t k,
+                                 float max_range,
+                                 Unit* reference_unit,
+                                 uint32_t allegiance,
+                                 UnitSpan exclude);
+
+  /// Runs kernel over the grid ranges under the XZ box and passes every
+  /// matching unit to sink(Unit* unit, float x, float z, int32_t slot)
+  template <typename Kernel, typename Sink>
+  static void _collect(float min_x,
+                       float min_z,
+                       float max_x,
+                       float max_z,
+                       Unit* reference_unit,
+                       uint32_t allegiance,
+                       const Kernel& kernel,
+                       Sink&& sink);
+
+  struct ArenaBlock {
+    std::unique_ptr<Unit*[]> items;
+    int32_t capacity = 0;
+  };
+
+  /// Appends to the open span at the arena cursor
+  class ArenaWriter {
+   public:
+    ArenaWriter();
+    void push(Unit* unit);
+    UnitSpan commit();
+
+   private:
+    Unit** items = nullptr;
+    int32_t count = 0;
+    int32_t capacity = 0;
+  };
+
+  static void _begin_frame();
+  static Unit** _open(int32_t& capacity);
+  static Unit** _grow(Unit** items, int32_t count, int32_t& capacity);
+
+  // Kept between queries to avoid per-query allocation
+  static std::vector<uint8_t> scratch_hits;
+  static std::vector<Candidate> scratch_candidates;
+
+  static std::vector<ArenaBlock> arena_blocks;
+  static int32_t arena_block_index;
+  static int32_t arena_block_used;
+  static uint64_t arena_frame;
+  static bool arena_started;
+};
+
+#endif  // GDEXTENSION_UNIT_QUERY_H
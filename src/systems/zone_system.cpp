@@ -0,0 +1,547 @@
+#include "zone_system.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/object.hpp>
+
+#include "../core/faction_table.hpp"
+#include "../core/unit.hpp"
+#include "../debug/debug_macros.hpp"
+#include "damage_queue.hpp"
+#include "simulation_clock.hpp"
+#include "status_effect_system.hpp"
+#include "tick_stages.hpp"
+
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::Engine;
+using godot::Object;
+using godot::ObjectDB;
+
+ZoneSystem* ZoneSystem::singleton_instance = nullptr;
+
+namespace {
+Unit* resolve_unit(uint64_t unit_id) {
+  Unit* unit = Object::cast_to<Unit>(ObjectDB::get_instance(unit_id));
+  return unit != nullptr && unit->is_inside_tree() ? unit : nullptr;
+}
+}  // namespace
+
+ZoneSystem::ZoneSystem() {
+  singleton_instance = this;
+}
+
+ZoneSystem::~ZoneSystem() {
+  if (singleton_instance == this) {
+    singleton_instance = nullptr;
+    UnitIndex::set_move_tracking(false);
+  }
+}
+
+void ZoneSystem::_bind_methods() {
+  ClassDB::bind_method(
+      D_METHOD("add_ground_zone", "center", "radius", "duration",
+               "tick_interval", "source", "damage_per_tick", "slow_percent"),
+      &ZoneSystem::add_ground_zone);
+  ClassDB::bind_method(D_METHOD("remove_zone", "handle"),
+                       &ZoneSystem::_remove_zone_bind);
+  ClassDB::bind_method(D_METHOD("set_zone_center", "handle", "center"),
+                       &ZoneSystem::_set_zone_center_bind);
+  ClassDB::bind_method(D_METHOD("has_zone", "handle"),
+                       &ZoneSystem::_has_zone_bind);
+  ClassDB::bind_method(D_METHOD("get_occupant_count", "handle"),
+                       &ZoneSystem::_get_occupant_count_bind);
+
+  ClassDB::bind_method(D_METHOD("get_zone_count"),
+                       &ZoneSystem::get_zone_count);
+  ClassDB::bind_method(D_METHOD("get_last_tick_moves"),
+                       &ZoneSystem::get_last_tick_moves);
+  ClassDB::bind_method(D_METHOD("get_last_tick_tests"),
+                       &ZoneSystem::get_last_tick_tests);
+}
+
+void ZoneSystem::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  singleton_instance = this;
+  set_physics_process_priority(TickStage::ZONES);
+  set_physics_process(true);
+}
+
+void ZoneSystem::_physics_process(double delta) {
+  last_tick_moves = 0;
+  last_tick_tests = 0;
+  if (active_zones == 0) {
+    return;
+  }
+
+  UnitIndex::refresh();
+  UnitIndex::take_cell_moves(moves);
+  last_tick_moves = static_cast<int32_t>(moves.size());
+
+  uint64_t tick = SimulationClock::get_tick();
+  int32_t zone_count = static_cast<int32_t>(zones.size());
+  for (int32_t slot = 0; slot < zone_count; slot++) {
+    Zone& zone = zones[slot];
+    if (zone.handle == INVALID_ZONE) {
+      continue;
+    }
+
+    if (zone.end_tick != 0 && tick >= zone.end_tick) {
+      _release_zone(slot);
+      continue;
+    }
+
+    _update_zone(zone);
+    if (tick >= zone.next_tick) {
+      _apply_tick(zone);
+      zone.next_tick = tick + zone.interval_ticks;
+    }
+  }
+
+  _dispatch_events();
+}
+
+ZoneSystem::ZoneHandle ZoneSystem::add_zone(const ZoneParams& params) {
+  if (params.radius <= 0.0f) {
+    return INVALID_ZONE;
+  }
+
+  int32_t slot = -1;
+  if (!free_zones.empty()) {
+    slot = free_zones.back();
+    free_zones.pop_back();
+  } else {
+    slot = static_cast<int32_t>(zones.size());
+    zones.emplace_back();
+  }
+
+  Zone& zone = zones[slot];
+  zone.generation++;
+  zone.handle = (static_cast<uint64_t>(zone.generation) << 32) |
+                static_cast<uint32_t>(slot);
+  zone.radius = params.radius;
+  _set_geometry(zone, params.center.x, params.center.z);
+
+  // The source itself is matched by id, everyone else by faction
+  zone.source_id = 0;
+  zone.faction_mask = FactionTable::ALL_FACTIONS;
+  zone.include_source = false;
+  if (params.source != nullptr) {
+    zone.source_id = params.source->get_instance_id();
+    zone.faction_mask = FactionTable::get_faction_mask(
+        params.source->get_faction_id(),
+        params.allegiance & ~Allegiance::SELF);
+    zone.include_source = (params.allegiance & Allegiance::SELF) != 0;
+  }
+
+  uint64_t tick = SimulationClock::get_tick();
+  zone.interval_ticks = static_cast<uint64_t>(
+      std::max<int64_t>(1, SimulationClock::seconds_to_ticks(
+                               params.tick_interval)));
+  zone.next_tick = tick;
+  zone.end_tick =
+      params.duration > 0.0
+          ? tick + static_cast<uint64_t>(
+                       SimulationClock::seconds_to_ticks(params.duration))
+          : 0;
+
+  zone.damage_per_tick = params.damage_per_tick;
+  zone.damage_type = params.damage_type;
+  zone.slow_percent = params.slow_percent;
+  // Outlasts the interval by a tick so the slow doesn't flicker between
+  // refreshes; it lingers that long after a unit walks out
+  zone.slow_duration =
+      params.tick_interval + SimulationClock::get_fixed_delta();
+
+  zone.callbacks = std::make_shared<Callbacks>();
+  zone.callbacks->on_enter = params.on_enter;
+  zone.callbacks->on_exit = params.on_exit;
+  zone.callbacks->on_tick = params.on_tick;
+
+  zone.occupants.clear();
+
+  if (active_zones++ == 0) {
+    UnitIndex::set_move_tracking(true);
+  }
+  return zone.handle;
+}
+
+int64_t ZoneSystem::add_ground_zone(const Vector3& center,
+                                    float radius,
+                                    double duration,
+                                    double tick_interval,
+                                    Unit* source,
+                                    float damage_per_tick,
+                                    float slow_percent) {
+  ZoneParams params;
+  params.center = center;
+  params.radius = radius;
+  params.duration = duration;
+  params.tick_interval = tick_interval;
+  params.source = source;
+  params.damage_per_tick = damage_per_tick;
+  params.slow_percent = slow_percent;
+  return static_cast<int64_t>(add_zone(params));
+}
+
+void ZoneSystem::remove_zone(ZoneHandle handle) {
+  int32_t slot = _slot_of(handle);
+  if (slot < 0) {
+    return;
+  }
+
+  _release_zone(slot);
+  // Outside the tick the exit callbacks can run right away
+  _dispatch_events();
+}
+
+void ZoneSystem::set_zone_center(ZoneHandle handle, const Vector3& center) {
+  int32_t slot = _slot_of(handle);
+  if (slot < 0) {
+    return;
+  }
+  _set_geometry(zones[slot], center.x, center.z);
+}
+
+bool ZoneSystem::has_zone(ZoneHandle handle) const {
+  return _slot_of(handle) >= 0;
+}
+
+int32_t ZoneSystem::get_occupant_count(ZoneHandle handle) const {
+  int32_t slot = _slot_of(handle);
+  if (slot < 0) {
+    return 0;
+  }
+  return static_cast<int32_t>(zones[slot].occupants.size());
+}
+
+void ZoneSystem::_set_geometry(Zone& zone, float center_x, float center_z) {
+  constexpr int32_t last = UnitIndex::GRID_DIM - 1;
+  constexpr float cell = UnitIndex::CELL_SIZE;
+  constexpr float origin = -UnitIndex::HALF_EXTENT;
+
+  zone.center_x = center_x;
+  zone.center_z = center_z;
+  float radius = zone.radius;
+  float radius_sq = radius * radius;
+
+  int32_t min_cell = UnitIndex::get_cell(center_x - radius, center_z - radius);
+  int32_t max_cell = UnitIndex::get_cell(center_x + radius, center_z + radius);
+  zone.min_cx = min_cell % UnitIndex::GRID_DIM;
+  zone.min_cz = min_cell / UnitIndex::GRID_DIM;
+  zone.max_cx = max_cell % UnitIndex::GRID_DIM;
+  zone.max_cz = max_cell / UnitIndex::GRID_DIM;
+
+  // Interior cells need no per-unit test and outside cells hold no
+  // occupants, so only boundary cells are re-tested every tick. Grid border
+  // cells also hold clamped out-of-bounds units and are always boundary.
+  zone.boundary_cells.clear();
+  for (int32_t cz = zone.min_cz; cz <= zone.max_cz; cz++) {
+    float z0 = origin + cz * cell - center_z;
+    float z1 = z0 + cell;
+    float near_z = z0 > 0.0f ? z0 : (z1 < 0.0f ? z1 : 0.0f);
+    float far_z = std::max(std::abs(z0), std::abs(z1));
+
+    for (int32_t cx = zone.min_cx; cx <= zone.max_cx; cx++) {
+      float x0 = origin + cx * cell - center_x;
+      float x1 = x0 + cell;
+      float near_x = x0 > 0.0f ? x0 : (x1 < 0.0f ? x1 : 0.0f);
+      float far_x = std::max(std::abs(x0), std::abs(x1));
+
+      bool border = cx == 0 || cz == 0 || cx == last || cz == last;
+      bool outside = near_x * near_x + near_z * near_z > radius_sq;
+      bool interior = far_x * far_x + far_z * far_z <= radius_sq;
+      if (border || (!outside && !interior)) {
+        zone.boundary_cells.push_back(cz * UnitIndex::GRID_DIM + cx);
+      }
+    }
+  }
+
+  zone.needs_scan = true;
+}
+
+void ZoneSystem::_update_zone(Zone& zone) {
+  if (zone.needs_scan) {
+    _scan_zone(zone);
+    return;
+  }
+
+  // Units that changed cell inside the zone's bounds (entered, left, died)
+  for (const UnitIndex::CellMove& move : moves) {
+    if (!_covers_cell(zone, move.from_cell) &&
+        !_covers_cell(zone, move.to_cell)) {
+      continue;
+    }
+    _test_unit(zone, move.unit_id, move.faction_id,
+               move.to_cell != UnitIndex::INVALID_SLOT, move.x, move.z);
+  }
+
+  // Units near the edge can cross it without changing cell; tested last so
+  // the current positions win over the logged ones
+  uint32_t visit_mask = zone.faction_mask;
+  if (zone.include_source) {
+    visit_mask = FactionTable::ALL_FACTIONS;
+  }
+  for (int32_t cell : zone.boundary_cells) {
+    UnitIndex::visit_cell(
+        cell, visit_mask,
+        [&](const float* xs, const float* zs, const int32_t* slots,
+            int32_t count) {
+          for (int32_t i = 0; i < count; i++) {
+            Unit* unit = UnitIndex::get_live_unit(slots[i]);
+            if (unit == nullptr) {
+              continue;
+            }
+            _test_unit(zone, unit->get_instance_id(),
+                       UnitIndex::get_faction(slots[i]), true, xs[i], zs[i]);
+          }
+        });
+  }
+}
+
+void ZoneSystem::_scan_zone(Zone& zone) {
+  zone.needs_scan = false;
+
+  scan_ids.clear();
+  UnitIndex::visit_radius(
+      Vector3(zone.center_x, 0.0f, zone.center_z), zone.radius,
+      FactionTable::ALL_FACTIONS,
+      [&](Unit* unit, float distance_sq, int32_t slot) {
+        uint64_t unit_id = unit->get_instance_id();
+        if (_accepts(zone, unit_id, UnitIndex::get_faction(slot))) {
+          scan_ids.push_back(unit_id);
+        }
+      });
+  last_tick_tests += static_cast<int32_t>(scan_ids.size());
+
+  // Diff against the previous occupants (non-empty after a move); both
+  // lists are sorted, so membership is a binary search
+  std::sort(scan_ids.begin(), scan_ids.end());
+  for (int32_t i = static_cast<int32_t>(zone.occupants.size()) - 1; i >= 0;
+       i--) {
+    uint64_t unit_id = zone.occupants[i];
+    if (!std::binary_search(scan_ids.begin(), scan_ids.end(), unit_id)) {
+      _set_inside(zone, unit_id, false);
+    }
+  }
+
+  for (uint64_t unit_id : scan_ids) {
+    _set_inside(zone, unit_id, true);
+  }
+}
+
+void ZoneSystem::_apply_tick(Zone& zone) {
+  if (zone.occupants.empty()) {
+    return;
+  }
+
+  Unit* source = zone.source_id != 0 ? resolve_unit(zone.source_id) : nullptr;
+  StatusEffectSystem* effects = nullptr;
+  if (zone.slow_percent > 0.0f) {
+    effects = StatusEffectSystem::ensure_singleton(this);
+  }
+
+  // One pass over the occupants: damage is queued for this tick's damage
+  // phase, which runs right after the zones
+  for (uint64_t unit_id : zone.occupants) {
+    if (zone.damage_per_tick > 0.0f || effects != nullptr) {
+      Unit* unit = resolve_unit(unit_id);
+      if (unit == nullptr) {
+        continue;
+      }
+      if (zone.damage_per_tick > 0.0f) {
+        DamageQueue::submit(unit, zone.damage_per_tick, zone.damage_type,
+                            source);
+      }
+      if (effects != nullptr) {
+        effects->apply_slow(unit, zone.slow_percent, zone.slow_duration);
+      }
+    }
+
+    if (zone.callbacks->on_tick) {
+      events.push_back({zone.callbacks, unit_id, EventType::TICK});
+    }
+  }
+}
+
+void ZoneSystem::_release_zone(int32_t slot) {
+  Zone& zone = zones[slot];
+  if (zone.callbacks->on_exit) {
+    for (uint64_t unit_id : zone.occupants) {
+      events.push_back({zone.callbacks, unit_id, EventType::EXIT});
+    }
+  }
+
+  zone.handle = INVALID_ZONE;
+  zone.callbacks.reset();
+  zone.occupants.clear();
+  zone.boundary_cells.clear();
+  free_zones.push_back(slot);
+
+  if (--active_zones == 0) {
+    UnitIndex::set_move_tracking(false);
+  }
+}
+
+void ZoneSystem::_test_unit(Zone& zone,
+                            uint64_t unit_id,
+                            int32_t faction_id,
+                            bool indexed,
+                            float x,
+                            float z) {
+  last_tick_tests++;
+
+  bool inside = false;
+  if (indexed && _accepts(zone, unit_id, faction_id)) {
+    float dx = x - zone.center_x;
+    float dz = z - zone.center_z;
+    inside = dx * dx + dz * dz <= zone.radius * zone.radius;
+  }
+  _set_inside(zone, unit_id, inside);
+}
+
+void ZoneSystem::_set_inside(Zone& zone, uint64_t unit_id, bool inside) {
+  auto found = std::lower_bound(zone.occupants.begin(), zone.occupants.end(),
+                                unit_id);
+  bool was_inside = found != zone.occupants.end() && *found == unit_id;
+  if (inside == was_inside) {
+    return;
+  }
+
+  // Sorted insert / erase; occupant lists are short, so the shift is cheap
+  if (inside) {
+    zone.occupants.insert(found, unit_id);
+    if (zone.callbacks->on_enter) {
+      events.push_back({zone.callbacks, unit_id, EventType::ENTER});
+    }
+    return;
+  }
+
+  zone.occupants.erase(found);
+  if (zone.callbacks->on_exit) {
+    events.push_back({zone.callbacks, unit_id, EventType::EXIT});
+  }
+}
+
+void ZoneSystem::_dispatch_events() {
+  if (events.empty()) {
+    return;
+  }
+
+  // Callbacks may add or remove zones; each event holds its own reference
+  // to the callbacks, so removed zones can still deliver their exits
+  std::vector<ZoneEvent> dispatching;
+  dispatching.swap(events);
+  for (const ZoneEvent& event : dispatching) {
+    Unit* unit = resolve_unit(event.unit_id);
+    if (unit == nullptr) {
+      continue;
+    }
+
+    const Callbacks& callbacks = *event.callbacks;
+    switch (event.type) {
+      case EventType::ENTER:
+        callbacks.on_enter(unit);
+        break;
+      case EventType::EXIT:
+        callbacks.on_exit(unit);
+        break;
+      case EventType::TICK:
+        callbacks.on_tick(unit);
+        break;
+    }
+  }
+
+  // Keep the larger buffer for the next tick
+  dispatching.clear();
+  if (events.empty()) {
+    events.swap(dispatching);
+  }
+}
+
+bool ZoneSystem::_accepts(const Zone& zone,
+                          uint64_t unit_id,
+                          int32_t faction_id) const {
+  if (unit_id == zone.source_id) {
+    return zone.include_source;
+  }
+  return (zone.faction_mask & FactionTable::faction_bit(faction_id)) != 0;
+}
+
+bool ZoneSystem::_covers_cell(const Zone& zone, int32_t cell) const {
+  if (cell == UnitIndex::INVALID_SLOT) {
+    return false;
+  }
+
+  int32_t cx = cell % UnitIndex::GRID_DIM;
+  int32_t cz = cell / UnitIndex::GRID_DIM;
+  return cx >= zone.min_cx && cx <= zone.max_cx && cz >= zone.min_cz &&
+         cz <= zone.max_cz;
+}
+
+int32_t ZoneSystem::_slot_of(ZoneHandle handle) const {
+  if (handle == INVALID_ZONE) {
+    return -1;
+  }
+
+  uint32_t slot = static_cast<uint32_t>(handle & 0xFFFFFFFFu);
+  if (slot >= zones.size() || zones[slot].handle != handle) {
+    return -1;
+  }
+  return static_cast<int32_t>(slot);
+}
+
+void ZoneSystem::_remove_zone_bind(int64_t handle) {
+  remove_zone(static_cast<ZoneHandle>(handle));
+}
+
+void ZoneSystem::_set_zone_center_bind(int64_t handle, const Vector3& center) {
+  set_zone_center(static_cast<ZoneHandle>(handle), center);
+}
+
+bool ZoneSystem::_has_zone_bind(int64_t handle) const {
+  return has_zone(static_cast<ZoneHandle>(handle));
+}
+
+int32_t ZoneSystem::_get_occupant_count_bind(int64_t handle) const {
+  return get_occupant_count(static_cast<ZoneHandle>(handle));
+}
+
+int32_t ZoneSystem::get_zone_count() const {
+  return active_zones;
+}
+
+int32_t ZoneSystem::get_last_tick_moves() const {
+  return last_tick_moves;
+}
+
+int32_t ZoneSystem::get_last_tick_tests() const {
+  return last_tick_tests;
+}
+
+ZoneSystem* ZoneSystem::get_singleton() {
+  return singleton_instance;
+}
+
+ZoneSystem* ZoneSystem::ensure_singleton(Node* context) {
+  if (singleton_instance != nullptr) {
+    return singleton_instance;
+  }
+
+  if (context == nullptr || !context->is_inside_tree()) {
+    return nullptr;
+  }
+
+  ZoneSystem* system = memnew(ZoneSystem);
+  system->set_name("ZoneSystem");
+  context->get_tree()->get_root()->call_deferred("add_child", system);
+  DBG_INFO("ZoneSystem", "Created zone system");
+  return singleton_instance;
+}
@@ -0,0 +1,189 @@
+#ifndef GDEXTENSION_ZONE_SYSTEM_H
+#define GDEXTENSION_ZONE_SYSTEM_H
+
+#include <cstdint>
+#include <functional>
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <memory>
+#include <vector>
+
+#include "../common/allegiance.hpp"
+#include "../common/damage_type.hpp"
+#include "unit_index.hpp"
+
+using godot::Node;
+using godot::Vector3;
+
+class Unit;
+
+/// Persistent ground zones (burning ground, slowing fields, auras)
+/// A zone is a circle on the XZ plane with an occupant set that is kept up to
+/// date incrementally instead of re-queried every tick:
+/// - At creation the zone classifies the UnitIndex cells under it as
+///   interior (fully inside), boundary (partly inside) or outside
+/// - Each tick it only re-tests the units in its boundary cells and the
+///   units UnitIndex logged as changing cell inside its bounds; units moving
+///   around interior cells cost nothing
+/// - Enter/exit callbacks fire on occupancy changes; every tick_interval the
+///   zone applies its damage (one batched pass into the DamageQueue), slow
+///   and on_tick callback to all occupants
+///
+/// Callbacks run after every zone has been updated, so they may add or remove
+/// zones. Units leaving the tree drop out without an exit callback.
+///
+/// Occupants are kept sorted by unit id: membership is a binary search and a
+/// rescan diffs two sorted lists, so updates allocate nothing once the
+/// vectors have grown. Scripts create damage/slow zones with add_ground_zone
+/// (callbacks are C++ only); ExplosionNode's burning ground is built on it.
+class ZoneSystem : public Node {
+  GDCLASS(ZoneSystem, Node)
+
+ public:
+  using ZoneHandle = uint64_t;
+  using UnitCallback = std::function<void(Unit*)>;
+
+  static constexpr ZoneHandle INVALID_ZONE = 0;
+
+  struct ZoneParams {
+    Vector3 center;
+    float radius = 1.0f;
+    double duration = 0.0;       // Seconds; <= 0 lasts until removed
+    double tick_interval = 0.5;  // Seconds between tick effects
+    Unit* source = nullptr;      // Allegiance reference and damage credit
+    uint32_t allegiance = Allegiance::ENEMY;
+    float damage_per_tick = 0.0f;
+    DamageType damage_type = DamageType::MAGICAL;
+    float slow_percent = 0.0f;  // Refreshed every tick while inside
+    UnitCallback on_enter;
+    UnitCallback on_exit;
+    UnitCallback on_tick;  // Per occupant, every tick_interval
+  };
+
+ protected:
+  static void _bind_methods();
+
+  struct Callbacks {
+    UnitCallback on_enter;
+    UnitCallback on_exit;
+    UnitCallback on_tick;
+  };
+
+  struct Zone {
+    ZoneHandle handle = INVALID_ZONE;  // INVALID_ZONE = free slot
+    uint32_t generation = 0;
+
+    // Geometry
+    float center_x = 0.0f;
+    float center_z = 0.0f;
+    float radius = 0.0f;
+    int32_t min_cx = 0;
+    int32_t max_cx = 0;
+    int32_t min_cz = 0;
+    int32_t max_cz = 0;
+    std::vector<int32_t> boundary_cells;
+    bool needs_scan = true;  // Full radius query on the next update
+
+    // Filter (see _accepts)
+    uint64_t source_id = 0;
+    uint32_t faction_mask = 0;
+    bool include_source = false;
+
+    // Timing, in simulation ticks
+    uint64_t next_tick = 0;
+    uint64_t end_tick = 0;  // 0 = no expiry
+    uint64_t interval_ticks = 1;
+
+    // Tick effects
+    float damage_per_tick = 0.0f;
+    DamageType damage_type = DamageType::MAGICAL;
+    float slow_percent = 0.0f;
+    double slow_duration = 0.0;
+    std::shared_ptr<Callbacks> callbacks;
+
+    std::vector<uint64_t> occupants;  // Sorted by unit id
+  };
+
+  enum class EventType : uint8_t { ENTER, EXIT, TICK };
+
+  struct ZoneEvent {
+    std::shared_ptr<Callbacks> callbacks;
+    uint64_t unit_id = 0;
+    EventType type = EventType::ENTER;
+  };
+
+  std::vector<Zone> zones;
+  std::vector<int32_t> free_zones;
+  int32_t active_zones = 0;
+
+  // Reused every tick
+  std::vector<UnitIndex::CellMove> moves;
+  std::vector<ZoneEvent> events;
+  std::vector<uint64_t> scan_ids;  // Sorted after each scan
+
+  int32_t last_tick_moves = 0;
+  int32_t last_tick_tests = 0;
+
+  void _set_geometry(Zone& zone, float center_x, float center_z);
+  void _update_zone(Zone& zone);
+  void _scan_zone(Zone& zone);
+  void _apply_tick(Zone& zone);
+  void _release_zone(int32_t slot);
+  void _test_unit(Zone& zone,
+                  uint64_t unit_id,
+                  int32_t faction_id,
+                  bool indexed,
+                  float x,
+                  float z);
+  void _set_inside(Zone& zone, uint64_t unit_id, bool inside);
+  void _dispatch_events();
+  bool _accepts(const Zone& zone, uint64_t unit_id, int32_t faction_id) const;
+  bool _covers_cell(const Zone& zone, int32_t cell) const;
+  int32_t _slot_of(ZoneHandle handle) const;  // -1 if stale
+
+  // Bound (int64) wrappers for handles
+  void _remove_zone_bind(int64_t handle);
+  void _set_zone_center_bind(int64_t handle, const Vector3& center);
+  bool _has_zone_bind(int64_t handle) const;
+  int32_t _get_occupant_count_bind(int64_t handle) const;
+
+ public:
+  ZoneSystem();
+  ~ZoneSystem();
+
+  void _ready() override;
+  void _physics_process(double delta) override;
+
+  ZoneHandle add_zone(const ZoneParams& params);
+  void remove_zone(ZoneHandle handle);
+
+  /// Script entry point: a zone damaging and/or slowing the enemies of
+  /// source (every unit without one); returns the handle
+  int64_t add_ground_zone(const Vector3& center,
+                          float radius,
+                          double duration,
+                          double tick_interval,
+                          Unit* source,
+                          float damage_per_tick,
+                          float slow_percent);
+
+  /// Move a zone (e.g. an aura following its carrier)
+  /// Re-scans the zone next tick, so prefer calling it only when the
+  /// carrier has moved a meaningful distance
+  void set_zone_center(ZoneHandle handle, const Vector3& center);
+
+  bool has_zone(ZoneHandle handle) const;
+  int32_t get_occupant_count(ZoneHandle handle) const;
+
+  int32_t get_zone_count() const;
+  int32_t get_last_tick_moves() const;
+  int32_t get_last_tick_tests() const;
+
+  static ZoneSystem* get_singleton();
+  static ZoneSystem* ensure_singleton(Node* context);
+
+ private:
+  static ZoneSystem* singleton_instance;
+};
+
+#endif  // GDEXTENSION_ZONE_SYSTEM_H
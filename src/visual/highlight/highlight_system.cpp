@@ -0,0 +1,179 @@
+#include "highlight_system.hpp"
+
+#include <algorithm>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/material.hpp>
+#include <godot_cpp/classes/mesh_instance3d.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/shader.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/property_info.hpp>
+
+#include "../../core/unit.hpp"
+#include "../../debug/debug_macros.hpp"
+
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::Engine;
+using godot::Material;
+using godot::MeshInstance3D;
+using godot::Object;
+using godot::PropertyInfo;
+using godot::Shader;
+using godot::Variant;
+
+HighlightSystem* HighlightSystem::singleton_instance = nullptr;
+
+namespace {
+// Inverted hull: back faces pushed out along the normal. The highlight
+// flag and colour are per-instance, so every mesh shares this material;
+// with the flag off the hull collapses to a point and draws nothing.
+constexpr const char* OUTLINE_SHADER = R"(shader_type spatial;
+render_mode unshaded, cull_front, shadows_disabled;
+
+instance uniform float highlight = 0.0;
+instance uniform vec4 highlight_color : source_color = vec4(1.0);
+uniform float outline_width = 0.04;
+
+void vertex() {
+  VERTEX = highlight > 0.5 ? VERTEX + NORMAL * outline_width : vec3(0.0);
+}
+
+void fragment() {
+  ALBEDO = highlight_color.rgb;
+  ALPHA = highlight_color.a;
+}
+)";
+}  // namespace
+
+HighlightSystem::HighlightSystem() {
+  singleton_instance = this;
+}
+
+HighlightSystem::~HighlightSystem() {
+  if (singleton_instance == this) {
+    singleton_instance = nullptr;
+  }
+}
+
+void HighlightSystem::_bind_methods() {
+  ClassDB::bind_method(D_METHOD("set_outline_width", "width"),
+                       &HighlightSystem::set_outline_width);
+  ClassDB::bind_method(D_METHOD("get_outline_width"),
+                       &HighlightSystem::get_outline_width);
+  ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "outline_width"),
+               "set_outline_width", "get_outline_width");
+
+  ClassDB::bind_method(D_METHOD("get_material_assignments"),
+                       &HighlightSystem::get_material_assignments);
+  ClassDB::bind_method(D_METHOD("get_toggle_count"),
+                       &HighlightSystem::get_toggle_count);
+}
+
+void HighlightSystem::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  singleton_instance = this;
+}
+
+void HighlightSystem::_create_material() {
+  Ref<Shader> shader;
+  shader.instantiate();
+  shader->set_code(OUTLINE_SHADER);
+
+  material.instantiate();
+  material->set_shader(shader);
+  material->set_shader_parameter("outline_width", outline_width);
+}
+
+void HighlightSystem::set_highlighted(Unit* unit,
+                                      bool highlighted,
+                                      const Color& color) {
+  if (unit == nullptr) {
+    return;
+  }
+
+  // The main mesh is the unit's first MeshInstance3D child
+  for (int i = 0; i < unit->get_child_count(); ++i) {
+    auto mesh = Object::cast_to<MeshInstance3D>(unit->get_child(i));
+    if (mesh != nullptr) {
+      set_mesh_highlighted(mesh, highlighted, color);
+      return;
+    }
+  }
+}
+
+bool HighlightSystem::set_mesh_highlighted(MeshInstance3D* mesh,
+                                           bool highlighted,
+                                           const Color& color) {
+  if (mesh == nullptr) {
+    return false;
+  }
+
+  if (material.is_null()) {
+    _create_material();
+  }
+
+  // First highlight of this mesh: attach the shared overlay for good
+  Ref<Material> overlay = mesh->get_material_overlay();
+  if (overlay.ptr() != material.ptr()) {
+    if (overlay.is_valid()) {
+      return false;  // Mesh has its own overlay
+    }
+    if (!highlighted) {
+      return true;  // Never highlighted, nothing to turn off
+    }
+    mesh->set_material_overlay(material);
+    material_assignments++;
+  }
+
+  if (highlighted) {
+    mesh->set_instance_shader_parameter(color_param, color);
+  }
+  mesh->set_instance_shader_parameter(highlight_param,
+                                      highlighted ? 1.0f : 0.0f);
+  toggle_count++;
+  return true;
+}
+
+void HighlightSystem::set_outline_width(float width) {
+  outline_width = std::max(0.0f, width);
+  if (material.is_valid()) {
+    material->set_shader_parameter("outline_width", outline_width);
+  }
+}
+
+float HighlightSystem::get_outline_width() const {
+  return outline_width;
+}
+
+int32_t HighlightSystem::get_material_assignments() const {
+  return material_assignments;
+}
+
+int32_t HighlightSystem::get_toggle_count() const {
+  return toggle_count;
+}
+
+HighlightSystem* HighlightSystem::get_singleton() {
+  return singleton_instance;
+}
+
+HighlightSystem* HighlightSystem::ensure_singleton(Node* context) {
+  if (singleton_instance != nullptr) {
+    return singleton_instance;
+  }
+
+  if (context == nullptr || !context->is_inside_tree()) {
+    return nullptr;
+  }
+
+  HighlightSystem* system = memnew(HighlightSystem);
+  system->set_name("HighlightSystem");
+  context->get_tree()->get_root()->call_deferred("add_child", system);
+  DBG_INFO("HighlightSystem", "Created highlight system");
+  return singleton_instance;
+}
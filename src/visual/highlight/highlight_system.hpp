@@ -0,0 +1,76 @@
+#ifndef GDEXTENSION_HIGHLIGHT_SYSTEM_H
+#define GDEXTENSION_HIGHLIGHT_SYSTEM_H
+
+#include <cstdint>
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/classes/shader_material.hpp>
+#include <godot_cpp/variant/color.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+using godot::Color;
+using godot::Node;
+using godot::Ref;
+using godot::ShaderMaterial;
+using godot::StringName;
+
+namespace godot {
+class MeshInstance3D;
+}  // namespace godot
+
+class Unit;
+
+/// Outline highlight for hovered or selected units
+/// One outline ShaderMaterial is shared by every unit. It is set as the
+/// material_overlay of a unit's main mesh the first time that unit is
+/// highlighted and stays there; turning the outline on or off afterwards
+/// only writes the mesh's `highlight` instance uniform (and its colour), so
+/// hovering allocates no nodes or materials and frees nothing.
+///
+/// While the flag is off the outline shader collapses its vertices, so an
+/// idle overlay rasterizes nothing. Meshes that already carry their own
+/// material_overlay are left alone and never highlight.
+class HighlightSystem : public Node {
+  GDCLASS(HighlightSystem, Node)
+
+ protected:
+  static void _bind_methods();
+
+  Ref<ShaderMaterial> material;
+  StringName highlight_param = "highlight";
+  StringName color_param = "highlight_color";
+  float outline_width = 0.04f;
+
+  int32_t material_assignments = 0;
+  int32_t toggle_count = 0;
+
+  void _create_material();
+
+ public:
+  HighlightSystem();
+  ~HighlightSystem();
+
+  void _ready() override;
+
+  /// Outline the unit's main mesh (its first MeshInstance3D child)
+  void set_highlighted(Unit* unit, bool highlighted, const Color& color);
+  /// Outline a mesh directly; false if it can't carry the shared overlay
+  bool set_mesh_highlighted(godot::MeshInstance3D* mesh,
+                            bool highlighted,
+                            const Color& color);
+
+  void set_outline_width(float width);
+  float get_outline_width() const;
+
+  /// Meshes the shared material was assigned to (once each)
+  int32_t get_material_assignments() const;
+  /// Highlight flag writes since startup
+  int32_t get_toggle_count() const;
+
+  static HighlightSystem* get_singleton();
+  static HighlightSystem* ensure_singleton(Node* context);
+
+ private:
+  static HighlightSystem* singleton_instance;
+};
+
+#endif  // GDEXTENSION_HIGHLIGHT_SYSTEM_H
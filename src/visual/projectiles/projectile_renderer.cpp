@@ -0,0 +1,317 @@
+#include "projectile_renderer.hpp"
+
+#include <algorithm>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/multi_mesh_instance3d.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+#include "../../debug/debug_macros.hpp"
+#include "../../systems/simulation_clock.hpp"
+
+using godot::ClassDB;
+using godot::D_METHOD;
+using godot::Engine;
+using godot::MultiMeshInstance3D;
+
+ProjectileRenderer* ProjectileRenderer::singleton_instance = nullptr;
+
+namespace {
+// MultiMesh TRANSFORM_3D instances are a row-major 3x4 matrix
+constexpr int32_t FLOATS_PER_INSTANCE = 12;
+constexpr int32_t MIN_BATCH_CAPACITY = 32;
+}  // namespace
+
+ProjectileRenderer::ProjectileRenderer() {
+  singleton_instance = this;
+}
+
+ProjectileRenderer::~ProjectileRenderer() {
+  if (singleton_instance == this) {
+    singleton_instance = nullptr;
+  }
+}
+
+void ProjectileRenderer::_bind_methods() {
+  ClassDB::bind_method(D_METHOD("get_batch_count"),
+                       &ProjectileRenderer::get_batch_count);
+  ClassDB::bind_method(D_METHOD("get_instance_count"),
+                       &ProjectileRenderer::get_instance_count);
+  ClassDB::bind_method(D_METHOD("get_last_frame_writes"),
+                       &ProjectileRenderer::get_last_frame_writes);
+}
+
+void ProjectileRenderer::_ready() {
+  if (Engine::get_singleton()->is_editor_hint()) {
+    return;
+  }
+
+  singleton_instance = this;
+  // Dedicated servers draw nothing
+  set_process(!SimulationClock::is_server());
+}
+
+void ProjectileRenderer::_process(double delta) {
+  uint64_t tick = SimulationClock::get_tick();
+  bool interpolating = SimulationClock::is_interpolating();
+  float fraction =
+      interpolating
+          ? static_cast<float>(SimulationClock::get_interpolation_fraction())
+          : 1.0f;
+
+  last_frame_writes = 0;
+  for (Batch& batch : batches) {
+    // Instances written this tick move between frames while interpolating
+    bool moving = interpolating && batch.last_write_tick == tick &&
+                  !batch.owners.empty();
+    if (!batch.dirty && !moving) {
+      continue;
+    }
+
+    _fill_batch(batch, tick, fraction);
+    // Refill once more after the last interpolated frame, so instances come
+    // to rest on their final position
+    batch.dirty = moving;
+  }
+}
+
+int32_t ProjectileRenderer::acquire(const Ref<Mesh>& mesh,
+                                    const Vector3& position,
+                                    const Vector3& direction,
+                                    float scale) {
+  int32_t batch_index = _get_batch(mesh);
+  if (batch_index < 0) {
+    return INVALID_SLOT;
+  }
+
+  int32_t slot;
+  if (!free_slots.empty()) {
+    slot = free_slots.back();
+    free_slots.pop_back();
+  } else {
+    slot = static_cast<int32_t>(slot_batches.size());
+    slot_batches.push_back(-1);
+    slot_indices.push_back(-1);
+  }
+
+  Batch& batch = batches[batch_index];
+  Vector3 facing = direction.length_squared() > 0.000001f
+                       ? direction.normalized()
+                       : Vector3(0, 0, -1);
+  slot_batches[slot] = batch_index;
+  slot_indices[slot] = static_cast<int32_t>(batch.owners.size());
+  batch.owners.push_back(slot);
+  batch.previous_positions.push_back(position);
+  batch.positions.push_back(position);
+  batch.directions.push_back(facing);
+  batch.scales.push_back(std::max(0.001f, scale));
+  batch.write_ticks.push_back(0);
+  batch.dirty = true;
+  _grow_batch(batch, static_cast<int32_t>(batch.owners.size()));
+
+  instance_count++;
+  return slot;
+}
+
+void ProjectileRenderer::release(int32_t slot) {
+  if (slot < 0 || slot >= static_cast<int32_t>(slot_batches.size()) ||
+      slot_batches[slot] < 0) {
+    return;
+  }
+
+  Batch& batch = batches[slot_batches[slot]];
+  int32_t index = slot_indices[slot];
+  int32_t last = static_cast<int32_t>(batch.owners.size()) - 1;
+
+  // Swap-remove keeps the batch packed
+  if (index != last) {
+    int32_t moved = batch.owners[last];
+    batch.owners[index] = moved;
+    batch.previous_positions[index] = batch.previous_positions[last];
+    batch.positions[index] = batch.positions[last];
+    batch.directions[index] = batch.directions[last];
+    batch.scales[index] = batch.scales[last];
+    batch.write_ticks[index] = batch.write_ticks[last];
+    slot_indices[moved] = index;
+  }
+  batch.owners.pop_back();
+  batch.previous_positions.pop_back();
+  batch.positions.pop_back();
+  batch.directions.pop_back();
+  batch.scales.pop_back();
+  batch.write_ticks.pop_back();
+  batch.dirty = true;
+
+  slot_batches[slot] = -1;
+  slot_indices[slot] = -1;
+  free_slots.push_back(slot);
+  instance_count--;
+}
+
+void ProjectileRenderer::write_position(int32_t slot,
+                                        const Vector3& position) {
+  if (slot < 0 || slot >= static_cast<int32_t>(slot_batches.size()) ||
+      slot_batches[slot] < 0) {
+    return;
+  }
+
+  Batch& batch = batches[slot_batches[slot]];
+  int32_t index = slot_indices[slot];
+  uint64_t tick = SimulationClock::get_tick();
+
+  // First write of the tick: the last tick's position becomes the
+  // interpolation start
+  if (batch.write_ticks[index] != tick) {
+    batch.previous_positions[index] = batch.positions[index];
+    batch.write_ticks[index] = tick;
+  }
+
+  Vector3 step = position - batch.positions[index];
+  if (step.length_squared() > 0.000001f) {
+    batch.directions[index] = step.normalized();
+  }
+  batch.positions[index] = position;
+  batch.last_write_tick = tick;
+  batch.dirty = true;
+}
+
+void ProjectileRenderer::teleport(int32_t slot,
+                                  const Vector3& position,
+                                  const Vector3& direction) {
+  if (slot < 0 || slot >= static_cast<int32_t>(slot_batches.size()) ||
+      slot_batches[slot] < 0) {
+    return;
+  }
+
+  Batch& batch = batches[slot_batches[slot]];
+  int32_t index = slot_indices[slot];
+  batch.previous_positions[index] = position;
+  batch.positions[index] = position;
+  if (direction.length_squared() > 0.000001f) {
+    batch.directions[index] = direction.normalized();
+  }
+  batch.write_ticks[index] = SimulationClock::get_tick();
+  batch.dirty = true;
+}
+
+int32_t ProjectileRenderer::_get_batch(const Ref<Mesh>& mesh) {
+  if (mesh.is_null()) {
+    return -1;
+  }
+
+  uint64_t mesh_id = mesh->get_instance_id();
+  auto found = batch_of_mesh.find(mesh_id);
+  if (found != batch_of_mesh.end()) {
+    return found->second;
+  }
+
+  Batch batch;
+  batch.mesh = mesh;
+  batch.multimesh.instantiate();
+  batch.multimesh->set_transform_format(MultiMesh::TRANSFORM_3D);
+  batch.multimesh->set_mesh(mesh);
+  batch.instance = memnew(MultiMeshInstance3D);
+  batch.instance->set_multimesh(batch.multimesh);
+  add_child(batch.instance);
+
+  int32_t batch_index = static_cast<int32_t>(batches.size());
+  batches.push_back(batch);
+  batch_of_mesh[mesh_id] = batch_index;
+  DBG_INFO("ProjectileRenderer",
+           "Added batch " + godot::String::num(batch_index) + " for " +
+               mesh->get_class());
+  return batch_index;
+}
+
+void ProjectileRenderer::_grow_batch(Batch& batch, int32_t capacity) {
+  if (capacity <= batch.capacity) {
+    return;
+  }
+
+  // Doubling keeps MultiMesh reallocations rare
+  int32_t new_capacity =
+      std::max({capacity, batch.capacity * 2, MIN_BATCH_CAPACITY});
+  batch.multimesh->set_instance_count(new_capacity);
+  batch.buffer.resize(new_capacity * FLOATS_PER_INSTANCE);
+  batch.capacity = new_capacity;
+}
+
+void ProjectileRenderer::_fill_batch(Batch& batch,
+                                     uint64_t tick,
+                                     float fraction) {
+  int32_t count = static_cast<int32_t>(batch.owners.size());
+  float* out = count > 0 ? batch.buffer.ptrw() : nullptr;
+  for (int32_t i = 0; i < count; i++) {
+    Vector3 position = batch.write_ticks[i] == tick
+                           ? batch.previous_positions[i].lerp(
+                                 batch.positions[i], fraction)
+                           : batch.positions[i];
+
+    // Basis with -Z along the direction of travel, built without trig
+    Vector3 back = -batch.directions[i];
+    Vector3 side = Vector3(0, 1, 0).cross(back);
+    if (side.length_squared() < 0.000001f) {
+      side = Vector3(1, 0, 0);  // Straight up or down
+    }
+    side.normalize();
+    Vector3 up = back.cross(side);
+
+    float scale = batch.scales[i];
+    out[0] = side.x * scale;
+    out[1] = up.x * scale;
+    out[2] = back.x * scale;
+    out[3] = position.x;
+    out[4] = side.y * scale;
+    out[5] = up.y * scale;
+    out[6] = back.y * scale;
+    out[7] = position.y;
+    out[8] = side.z * scale;
+    out[9] = up.z * scale;
+    out[10] = back.z * scale;
+    out[11] = position.z;
+    out += FLOATS_PER_INSTANCE;
+  }
+
+  if (count == 0 && batch.drawn == 0) {
+    return;
+  }
+  batch.multimesh->set_visible_instance_count(count);
+  if (count > 0) {
+    batch.multimesh->set_buffer(batch.buffer);
+  }
+  batch.drawn = count;
+  last_frame_writes += count;
+}
+
+int32_t ProjectileRenderer::get_batch_count() const {
+  return static_cast<int32_t>(batches.size());
+}
+
+int32_t ProjectileRenderer::get_instance_count() const {
+  return instance_count;
+}
+
+int32_t ProjectileRenderer::get_last_frame_writes() const {
+  return last_frame_writes;
+}
+
+ProjectileRenderer* ProjectileRenderer::get_singleton() {
+  return singleton_instance;
+}
+
+ProjectileRenderer* ProjectileRenderer::ensure_singleton(Node* context) {
+  if (singleton_instance != nullptr) {
+    return singleton_instance;
+  }
+
+  if (context == nullptr || !context->is_inside_tree()) {
+    return nullptr;
+  }
+
+  ProjectileRenderer* renderer = memnew(ProjectileRenderer);
+  renderer->set_name("ProjectileRenderer");
+  context->get_tree()->get_root()->call_deferred("add_child", renderer);
+  DBG_INFO("ProjectileRenderer", "Created projectile renderer");
+  return singleton_instance;
+}
@@ -0,0 +1,113 @@
+#ifndef GDEXTENSION_PROJECTILE_RENDERER_H
+#define GDEXTENSION_PROJECTILE_RENDERER_H
+
+#include <cstdint>
+#include <godot_cpp/classes/mesh.hpp>
+#include <godot_cpp/classes/multi_mesh.hpp>
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <unordered_map>
+#include <vector>
+
+using godot::Mesh;
+using godot::MultiMesh;
+using godot::Node;
+using godot::PackedFloat32Array;
+using godot::Ref;
+using godot::Vector3;
+
+namespace godot {
+class MultiMeshInstance3D;
+}  // namespace godot
+
+/// Batched drawing for in-flight projectiles
+/// Every projectile visual type (one Mesh) is drawn by a single
+/// MultiMeshInstance3D. Projectiles with a batched_mesh (Projectile,
+/// SkillshotProjectile, or handed over by ProjectileVFX) acquire an instance
+/// here and write their simulated position into it instead of moving their
+/// node, so the scene graph sees no transform changes during flight.
+///
+/// Once per frame each batch that changed refills its transform buffer in
+/// one pass and uploads it with a single set_buffer. Positions written this
+/// tick are interpolated from the previous tick, so batched projectiles
+/// move as smoothly as physics-interpolated nodes. Instances face their
+/// direction of travel.
+///
+/// Instances of a batch stay packed at the front of its buffer (swap-remove
+/// on release), so only visible instances are ever written.
+class ProjectileRenderer : public Node {
+  GDCLASS(ProjectileRenderer, Node)
+
+ protected:
+  static void _bind_methods();
+
+  struct Batch {
+    Ref<Mesh> mesh;
+    godot::MultiMeshInstance3D* instance = nullptr;
+    Ref<MultiMesh> multimesh;
+    int32_t capacity = 0;  // MultiMesh instance_count
+    int32_t drawn = 0;     // Visible instances at the last fill
+    bool dirty = false;    // Needs a refill on the next frame
+    uint64_t last_write_tick = 0;
+    PackedFloat32Array buffer;  // 12 floats per instance, reused every frame
+
+    // Packed instances (parallel arrays)
+    std::vector<int32_t> owners;  // Slot of each packed instance
+    std::vector<Vector3> previous_positions;
+    std::vector<Vector3> positions;
+    std::vector<Vector3> directions;  // Normalized direction of travel
+    std::vector<float> scales;
+    std::vector<uint64_t> write_ticks;
+  };
+
+  std::vector<Batch> batches;
+  std::unordered_map<uint64_t, int32_t> batch_of_mesh;  // Mesh instance id
+
+  // Slot -> (batch, packed index); handles stay valid across swap-removes
+  std::vector<int32_t> slot_batches;
+  std::vector<int32_t> slot_indices;
+  std::vector<int32_t> free_slots;
+  int32_t instance_count = 0;
+  int32_t last_frame_writes = 0;
+
+  int32_t _get_batch(const Ref<Mesh>& mesh);
+  void _grow_batch(Batch& batch, int32_t capacity);
+  void _fill_batch(Batch& batch, uint64_t tick, float fraction);
+
+ public:
+  static constexpr int32_t INVALID_SLOT = -1;
+
+  ProjectileRenderer();
+  ~ProjectileRenderer();
+
+  void _ready() override;
+  void _process(double delta) override;
+
+  /// Start drawing mesh at position, facing direction (uniform scale)
+  int32_t acquire(const Ref<Mesh>& mesh,
+                  const Vector3& position,
+                  const Vector3& direction,
+                  float scale);
+  void release(int32_t slot);
+
+  /// Move an instance; it turns to face the step it just took
+  void write_position(int32_t slot, const Vector3& position);
+
+  /// Place an instance without interpolating from its last position
+  void teleport(int32_t slot,
+                const Vector3& position,
+                const Vector3& direction);
+
+  int32_t get_batch_count() const;
+  int32_t get_instance_count() const;
+  int32_t get_last_frame_writes() const;
+
+  static ProjectileRenderer* get_singleton();
+  static ProjectileRenderer* ensure_singleton(Node* context);
+
+ private:
+  static ProjectileRenderer* singleton_instance;
+};
+
+#endif  // GDEXTENSION_PROJECTILE_RENDERER_H
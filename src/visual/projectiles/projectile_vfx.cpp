@@ -1,57 +1,38 @@
 #include "projectile_vfx.hpp"
 
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/property_info.hpp>
 #include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/variant.hpp>
 
+#include "../../components/combat/projectile.hpp"
+#include "../../components/combat/skillshot_projectile.hpp"
 #include "../../debug/debug_macros.hpp"
 
 using godot::ClassDB;
 using godot::D_METHOD;
 using godot::Node3D;
 using godot::Object;
+using godot::PropertyInfo;
 using godot::String;
+using godot::Variant;
 
 ProjectileVFX::ProjectileVFX() = default;
 
 ProjectileVFX::~ProjectileVFX() = default;
 
 void ProjectileVFX::_bind_methods() {
-  // Inherit from VFXNode, no additional methods needed
+  ClassDB::bind_method(D_METHOD("set_batched_mesh", "mesh"),
+                       &ProjectileVFX::set_batched_mesh);
+  ClassDB::bind_method(D_METHOD("get_batched_mesh"),
+                       &ProjectileVFX::get_batched_mesh);
+  ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "batched_mesh",
+                            godot::PROPERTY_HINT_RESOURCE_TYPE, "Mesh"),
+               "set_batched_mesh", "get_batched_mesh");
 }
 
 void ProjectileVFX::_process(double delta) {
-  if (!is_playing_internal) {
-    return;
-  }
-
-  // Check if tracked projectile still exists
-  if (tracked_projectile != nullptr &&
-      tracked_projectile->is_queued_for_deletion()) {
-    // Projectile is being deleted, clean up this VFX
-    DBG_INFO("ProjectileVFX", "Projectile destroyed, cleaning up VFX");
-    _on_finished();
-    return;
-  }
-
-  // If we have a projectile, mirror its position (as backup in case reparenting
-  // didn't work)
-  if (tracked_projectile != nullptr) {
-    Node3D* projectile_node = Object::cast_to<Node3D>(tracked_projectile);
-    if (projectile_node != nullptr && projectile_node->is_inside_tree()) {
-      // Only update position if we're in the tree and not already a child
-      if (is_inside_tree() && get_parent() != projectile_node) {
-        set_global_position(projectile_node->get_global_position());
-        set_global_rotation(projectile_node->get_global_rotation());
-      }
-    } else if (projectile_node != nullptr &&
-               !projectile_node->is_inside_tree()) {
-      // Projectile is no longer in tree, clean up
-      DBG_INFO("ProjectileVFX",
-               "Projectile no longer in tree, cleaning up VFX");
-      _on_finished();
-      return;
-    }
-  }
+  // Lifetime follows the projectile (see play), not duration
 }
 
 void ProjectileVFX::play(const Dictionary& params) {
@@ -83,6 +64,13 @@ void ProjectileVFX::play(const Dictionary& params) {
   // Mark as playing
   is_playing_internal = true;
 
+  // As a child of the projectile there is nothing to sync per frame
+  set_process(false);
+
+  if (batched_mesh.is_valid() && _hand_over_mesh(projectile_node)) {
+    set_visible(false);
+  }
+
   // Make this VFX a child of the projectile so they move together
   // This avoids any position synchronization issues
   if (get_parent() != projectile_node) {
@@ -106,3 +94,27 @@ void ProjectileVFX::play(const Dictionary& params) {
   DBG_INFO("ProjectileVFX",
            "Following projectile: " + projectile_node->get_name());
 }
+
+bool ProjectileVFX::_hand_over_mesh(Node3D* projectile_node) {
+  // Keep the size the mesh had under this node
+  float scale = get_scale().x;
+  if (auto projectile = Object::cast_to<Projectile>(projectile_node)) {
+    projectile->set_batched_scale(scale);
+    projectile->set_batched_mesh(batched_mesh);
+    return true;
+  }
+  if (auto skillshot = Object::cast_to<SkillshotProjectile>(projectile_node)) {
+    skillshot->set_batched_scale(scale);
+    skillshot->set_batched_mesh(batched_mesh);
+    return true;
+  }
+  return false;
+}
+
+void ProjectileVFX::set_batched_mesh(const Ref<Mesh>& mesh) {
+  batched_mesh = mesh;
+}
+
+Ref<Mesh> ProjectileVFX::get_batched_mesh() const {
+  return batched_mesh;
+}
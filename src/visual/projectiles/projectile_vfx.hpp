@@ -1,10 +1,13 @@
 #ifndef GDEXTENSION_PROJECTILE_VFX_H
 #define GDEXTENSION_PROJECTILE_VFX_H
 
+#include <godot_cpp/classes/mesh.hpp>
 #include <godot_cpp/variant/vector3.hpp>
 
 #include "../vfx_node.hpp"
 
+using godot::Mesh;
+using godot::Ref;
 using godot::Vector3;
 
 /// Projectile VFX - Visual representation of a projectile
@@ -19,8 +22,12 @@ using godot::Vector3;
 ///   {"projectile", projectile_node}
 /// });
 ///
-/// The VFX will mirror the projectile's position and be destroyed
-/// when the projectile is destroyed (on hit or max distance)
+/// The VFX becomes a child of the projectile, so it moves with it and is
+/// destroyed with it (on hit or max distance); nothing runs per frame.
+///
+/// With a batched_mesh the VFX hands that mesh to the projectile instead:
+/// the flight is drawn by the ProjectileRenderer (one MultiMesh per mesh)
+/// and the VFX node stays hidden, only driving animation callbacks.
 class ProjectileVFX : public VFXNode {
   GDCLASS(ProjectileVFX, VFXNode)
 
@@ -30,6 +37,11 @@ class ProjectileVFX : public VFXNode {
   // Reference to the projectile we're following
   godot::Object* tracked_projectile = nullptr;
 
+  Ref<Mesh> batched_mesh;
+
+  // Give batched_mesh to the projectile; false if it can't draw batched
+  bool _hand_over_mesh(Node3D* projectile_node);
+
  public:
   ProjectileVFX();
   ~ProjectileVFX();
@@ -38,6 +50,9 @@ class ProjectileVFX : public VFXNode {
 
   // Start following a projectile node
   void play(const Dictionary& params) override;
+
+  void set_batched_mesh(const Ref<Mesh>& mesh);
+  Ref<Mesh> get_batched_mesh() const;
 };
 
 #endif  // GDEXTENSION_PROJECTILE_VFX_H